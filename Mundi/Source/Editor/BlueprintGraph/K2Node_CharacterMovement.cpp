@@ -502,11 +502,13 @@ FBlueprintValue UK2Node_GetIsFinishAnim::EvaluatePin(const UEdGraphPin* OutputPi
             assert(false);
         }
 
+        // 상태마다 이름 문자열을 만들지 않도록 FName끼리 비교 (UAnimationStateMachine::FindState와 같은 규칙)
+        const FName TargetStateName(StateName);
         const TArray<FAnimationState>& States = StateMachine->GetStates();
         FAnimationState TargetState;
         for (const FAnimationState& State : States)
         {
-            if (State.Name.ToString() == StateName)
+            if (State.Name == TargetStateName)
             {
                 TargetState = State;
                 break;
@@ -634,11 +636,13 @@ FBlueprintValue UK2Node_GetRemainAnimLength::EvaluatePin(const UEdGraphPin* Outp
             assert(false);
         }
 
+        // GetIsFinishAnim과 같이 FName으로 비교
+        const FName TargetStateName(StateName);
         const TArray<FAnimationState>& States = StateMachine->GetStates();
         FAnimationState TargetState;
         for (const FAnimationState& State : States)
         {
-            if (State.Name.ToString() == StateName)
+            if (State.Name == TargetStateName)
             {
                 TargetState = State;
                 break;
@@ -2,6 +2,7 @@
 #include "BlendSpace1D.h"
 #include "Source/Runtime/Engine/Animation/AnimSequence.h"
 #include "Source/Runtime/Engine/Animation/AnimDateModel.h"
+#include "VectorBatch.h"
 
 IMPLEMENT_CLASS(UBlendSpace1D)
 
@@ -284,22 +285,8 @@ void UBlendSpace1D::BlendPoses(const TArray<FTransform>& PoseA,
 	int32 NumBones = FMath::Min(PoseA.Num(), PoseB.Num());
 	OutPose.SetNum(NumBones);
 
-	for (int32 i = 0; i < NumBones; ++i)
-	{
-		const FTransform& TransformA = PoseA[i];
-		const FTransform& TransformB = PoseB[i];
-
-		// Linear interpolation for position
-		FVector BlendedPosition = FVector::Lerp(TransformA.Translation, TransformB.Translation, Alpha);
-
-		// Spherical linear interpolation for rotation (Slerp)
-		FQuat BlendedRotation = FQuat::Slerp(TransformA.Rotation, TransformB.Rotation, Alpha);
-
-		// Linear interpolation for scale
-		FVector BlendedScale = FVector::Lerp(TransformA.Scale3D, TransformB.Scale3D, Alpha);
-
-		OutPose[i] = FTransform(BlendedPosition, BlendedRotation, BlendedScale);
-	}
+	// Lerp for position/scale, Slerp for rotation (batched SIMD)
+	FMath::BlendTransforms(PoseA.GetData(), PoseB.GetData(), Alpha, OutPose.GetData(), NumBones, FMath::EQuatBlend::Slerp);
 }
 
 // ============================================================
@@ -2,6 +2,7 @@
 #include "BlendSpace2D.h"
 #include "Source/Runtime/Engine/Animation/AnimSequence.h"
 #include "Source/Runtime/Engine/Animation/AnimDateModel.h"
+#include "VectorBatch.h"
 
 IMPLEMENT_CLASS(UBlendSpace2D)
 
@@ -553,14 +554,7 @@ void UBlendSpace2D::BlendTwoPoses(
 	int32 NumBones = FMath::Min(PoseA.Num(), PoseB.Num());
 	OutPose.SetNum(NumBones);
 
-	for (int32 i = 0; i < NumBones; ++i)
-	{
-		FVector BlendedPos = FVector::Lerp(PoseA[i].Translation, PoseB[i].Translation, Alpha);
-		FQuat BlendedRot = FQuat::Slerp(PoseA[i].Rotation, PoseB[i].Rotation, Alpha);
-		FVector BlendedScale = FVector::Lerp(PoseA[i].Scale3D, PoseB[i].Scale3D, Alpha);
-
-		OutPose[i] = FTransform(BlendedPos, BlendedRot, BlendedScale);
-	}
+	FMath::BlendTransforms(PoseA.GetData(), PoseB.GetData(), Alpha, OutPose.GetData(), NumBones, FMath::EQuatBlend::Slerp);
 }
 
 // ============================================================
@@ -2,16 +2,22 @@
 #include "String.h"
 
 class UAnimSequence;
+class FArchive;
+struct FDerivedDataKey;
 
 class FBXAnimationCache
 {
 public:
-	// 캐시 디렉토리에서 애니메이션 로드 시도
+	// DDC에서 FBX의 애니메이션 목록 로드 시도 (애니메이션이 없는 FBX도 빈 목록으로 캐시됨)
 	static bool TryLoadAnimationsFromCache(const FString& NormalizedPath, TArray<UAnimSequence*>& OutAnimations);
 
-	// 단일 애니메이션을 캐시 파일에 저장
-	static bool SaveAnimationToCache(UAnimSequence* Animation, const FString& CachePath);
+	// FBX에서 추출한 애니메이션 전체를 DDC 엔트리 하나로 저장
+	static bool SaveAnimationsToCache(const FString& NormalizedPath, const TArray<UAnimSequence*>& Animations);
 
-	// 캐시 파일에서 단일 애니메이션 로드
-	static UAnimSequence* LoadAnimationFromCache(const FString& CachePath);
+	// 단일 애니메이션 직렬화 (읽기 실패 시 예외)
+	static void SaveAnimationToCache(UAnimSequence* Animation, FArchive& Writer);
+	static void LoadAnimationFromCache(FArchive& Reader, UAnimSequence* Animation);
+
+private:
+	static FDerivedDataKey MakeCacheKey(const FString& NormalizedPath);
 };
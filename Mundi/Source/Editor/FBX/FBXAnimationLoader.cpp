@@ -200,40 +200,15 @@ void FBXAnimationLoader::ProcessAnimations(FbxScene* Scene, const FSkeletalMeshD
 	}
 
 #ifdef USE_OBJ_CACHE
-	// 애니메이션을 캐시에 저장
-	if (OutAnimations.Num() > 0)
+	// 애니메이션을 캐시에 저장 (애니메이션이 없어도 빈 목록을 저장해 다음 로드 때 FBX 재임포트를 피함)
+	FString NormalizedPath = NormalizePath(FilePath);
+	if (FBXAnimationCache::SaveAnimationsToCache(NormalizedPath, OutAnimations))
 	{
-		FString NormalizedPath = NormalizePath(FilePath);
-		FString CacheBasePath = ConvertDataPathToCachePath(NormalizedPath);
-		FString AnimCacheDir = CacheBasePath + "_Anims";
-
-		// 캐시 디렉토리 생성
-		std::filesystem::create_directories(AnimCacheDir);
-
-		for (int32 i = 0; i < OutAnimations.Num(); ++i)
-		{
-			FString AnimStackName = OutAnimations[i]->ObjectName.ToString();
-			FString SanitizedName = AnimStackName;
-			for (char& ch : SanitizedName)
-			{
-				if (ch == '|' || ch == ':' || ch == '*' || ch == '?' || ch == '"' || ch == '<' || ch == '>' || ch == '/' || ch == '\\')
-				{
-					ch = '_';
-				}
-			}
-			FString AnimCachePath = AnimCacheDir + "/" + SanitizedName + ".anim.bin";
-
-			if (FBXAnimationCache::SaveAnimationToCache(OutAnimations[i], AnimCachePath))
-			{
-				UE_LOG("Saved animation to cache: %s", AnimCachePath.c_str());
-			}
-			else
-			{
-				UE_LOG("Failed to save animation to cache: %s", AnimCachePath.c_str());
-			}
-		}
-
-		UE_LOG("Saved %d animations to cache directory: %s", OutAnimations.Num(), AnimCacheDir.c_str());
+		UE_LOG("Saved %d animations to cache: %s", OutAnimations.Num(), NormalizedPath.c_str());
+	}
+	else
+	{
+		UE_LOG("Failed to save animation cache: %s", NormalizedPath.c_str());
 	}
 #endif
 }
@@ -4,8 +4,7 @@
 #include "fbxsdk/fileio/fbxiosettings.h"
 #include "fbxsdk/scene/geometry/fbxcluster.h"
 #include "ObjectIterator.h"
-#include "WindowsBinReader.h"
-#include "WindowsBinWriter.h"
+#include "DerivedDataCache.h"
 #include "PathUtils.h"
 #include <filesystem>
 #include "Source/Runtime/Engine/Animation/AnimSequence.h"
@@ -13,6 +12,12 @@
 
 IMPLEMENT_CLASS(UFbxLoader)
 
+namespace
+{
+	// 캐시에 저장하는 FSkeletalMeshData/FMaterialInfo 포맷이나 임포트 규칙이 바뀌면 올림
+	constexpr uint32 FbxCacheVersion = 1;
+}
+
 // Smart Texture Matching 맵 정의
 TMap<FString, FString> UFbxLoader::TextureFileNameMap;
 
@@ -148,77 +153,50 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 	FSkeletalMeshData* MeshData = nullptr;
 #ifdef USE_OBJ_CACHE
 	
-	// 1. 캐시 파일 경로 설정
-	FString CachePathStr = ConvertDataPathToCachePath(NormalizedPath);
-	const FString BinPathFileName = CachePathStr + ".bin";
-
-	// 파일 시스템용 wide path
-	FWideString WBinPath = UTF8ToWide(BinPathFileName);
-	std::filesystem::path BinPath(WBinPath);
-
-	// 캐시를 저장할 디렉토리가 없으면 생성
-	std::filesystem::path CacheFileDirPath = BinPath;
+	// 1. DDC 키 (FBX 콘텐츠 해시)
+	FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+	FDerivedDataKey CacheKey{ "FbxMesh", FbxCacheVersion, DDC.HashSourceFile(NormalizedPath) };
 
-	if (CacheFileDirPath.has_parent_path())
+	// 2. 캐시에서 로드 시도 (메시 + 사용하는 머티리얼을 한 엔트리에 저장)
 	{
-		std::filesystem::create_directories(CacheFileDirPath.parent_path());
-	}
+		MeshData = new FSkeletalMeshData();
+		MeshData->PathFileName = NormalizedPath;
 
-	bool bLoadedFromCache = false;
-	
-	// 2. 캐시 유효성 검사
-	bool bShouldRegenerate = true;
-	if (std::filesystem::exists(BinPath))
-	{
-		try
-		{
-			auto binTime = std::filesystem::last_write_time(BinPath);
-			auto fbxTime = std::filesystem::last_write_time(FbxPath);
-			
-			// FBX 파일이 캐시보다 오래되었으면 캐시 사용
-			if (fbxTime <= binTime)
+		TArray<FMaterialInfo> CachedMaterialInfos;
+		FString CachePathStr;
+		const bool bLoadedFromCache = DDC.Load(CacheKey, [&](FArchive& Reader)
 			{
-				bShouldRegenerate = false;
-			}
-		}
-		catch (const std::filesystem::filesystem_error& e)
+				Reader << *MeshData;
+				Serialization::ReadArray<FMaterialInfo>(Reader, CachedMaterialInfos);
+			}, &CachePathStr);
+
+		if (!bLoadedFromCache)
 		{
-			UE_LOG("Filesystem error during cache validation: %s. Forcing regeneration.", e.what());
-			bShouldRegenerate = true;
+			delete MeshData;
+			MeshData = nullptr;
 		}
-	}
-
-	// 3. 캐시에서 로드 시도
-	if (!bShouldRegenerate)
-	{
-		UE_LOG("Attempting to load FBX '%s' from cache.", NormalizedPath.c_str());
-		try
+		else
 		{
-			MeshData = new FSkeletalMeshData();
-			MeshData->PathFileName = NormalizedPath;
-
-			FWindowsBinReader Reader(BinPathFileName);
-			if (!Reader.IsOpen())
-			{
-				throw std::runtime_error("Failed to open bin file for reading.");
-			}
-			Reader << *MeshData;
-			Reader.Close();
-
 			for (int Index = 0; Index < MeshData->GroupInfos.Num(); Index++)
 			{
 				if (MeshData->GroupInfos[Index].InitialMaterialName.empty())
 					continue;
 				const FString& MaterialName = MeshData->GroupInfos[Index].InitialMaterialName;
-				const FString& MaterialFilePath = ConvertDataPathToCachePath(MaterialName + ".mat.bin");
-				FWindowsBinReader MatReader(MaterialFilePath);
-				if (!MatReader.IsOpen())
+
+				const FMaterialInfo* CachedInfo = nullptr;
+				for (const FMaterialInfo& Info : CachedMaterialInfos)
+				{
+					if (Info.MaterialName == MaterialName)
+					{
+						CachedInfo = &Info;
+						break;
+					}
+				}
+				if (!CachedInfo)
 				{
-					throw std::runtime_error("Failed to open material bin file for reading.");
+					continue; // 정보가 없는 머티리얼은 기존 리소스(또는 기본 머티리얼) 사용
 				}
-				// bin 로드용
-				FMaterialInfo MaterialInfo{};
-				Serialization::ReadAsset<FMaterialInfo>(MatReader, &MaterialInfo);
+				const FMaterialInfo& MaterialInfo = *CachedInfo;
 
 				UMaterial* NewMaterial = NewObject<UMaterial>();
 
@@ -230,8 +208,7 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 				UResourceManager::GetInstance().Add<UMaterial>(MaterialInfo.MaterialName, NewMaterial);
 			}
 
-			MeshData->CacheFilePath = BinPathFileName;
-			bLoadedFromCache = true;
+			MeshData->CacheFilePath = CachePathStr;
 
 			UE_LOG("Successfully loaded FBX '%s' from cache.", NormalizedPath.c_str());
 
@@ -271,22 +248,9 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 
 			return MeshData;
 		}
-		catch (const std::exception& e)
-		{
-			UE_LOG("Error loading FBX from cache: %s. Cache might be corrupt or incompatible.", e.what());
-			UE_LOG("Deleting corrupt cache and forcing regeneration for '%s'.", NormalizedPath.c_str());
-
-			std::filesystem::remove(BinPathFileName);
-			if (MeshData)
-			{
-				delete MeshData;
-				MeshData = nullptr;
-			}
-			bLoadedFromCache = false;
-		}
 	}
 
-	// 4. 캐시 로드 실패 시 FBX 파싱
+	// 3. 캐시 로드 실패 시 FBX 파싱
 	UE_LOG("Regenerating cache for FBX '%s'...", NormalizedPath.c_str());
 #endif // USE_OBJ_CACHE
 
@@ -411,29 +375,18 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 	}
 
 #ifdef USE_OBJ_CACHE
-	// 5. 캐시 저장
-	try
-	{
-		FWindowsBinWriter Writer(BinPathFileName);
-		Writer << *MeshData;
-		Writer.Close();
-
-		for (FMaterialInfo& MaterialInfo : MaterialInfos)
+	// 4. 캐시 저장
+	if (DDC.Put(CacheKey, [&](FArchive& Writer)
 		{
-
-			const FString MaterialFilePath = ConvertDataPathToCachePath(MaterialInfo.MaterialName + ".mat.bin");
-			FWindowsBinWriter MatWriter(MaterialFilePath);
-			Serialization::WriteAsset<FMaterialInfo>(MatWriter, &MaterialInfo);
-			MatWriter.Close();
-		}
-
-		MeshData->CacheFilePath = BinPathFileName;
-
+			Writer << *MeshData;
+			Serialization::WriteArray<FMaterialInfo>(Writer, MaterialInfos);
+		}, &MeshData->CacheFilePath))
+	{
 		UE_LOG("Cache regeneration complete for FBX '%s'.", NormalizedPath.c_str());
 	}
-	catch (const std::exception& e)
+	else
 	{
-		UE_LOG("Failed to save FBX cache: %s", e.what());
+		UE_LOG("Failed to save FBX cache: %s", NormalizedPath.c_str());
 	}
 #endif // USE_OBJ_CACHE
 
@@ -74,7 +74,7 @@ void UGizmoArrowComponent::SetDrawScale(float ViewWidth, float ViewHeight, const
 	SetWorldScale(DrawScale);
 }
 
-void UGizmoArrowComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UGizmoArrowComponent::CollectMeshBatches(TArray<FMeshBatchElement, FFrameArenaAllocator>& OutMeshBatchElements, const FSceneView* View)
 {
 	if (!IsVisible() || !StaticMesh)
 	{
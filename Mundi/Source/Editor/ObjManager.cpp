@@ -5,8 +5,8 @@
 #include "ObjectIterator.h"
 #include "StaticMesh.h"
 #include "Enums.h"
-#include "WindowsBinReader.h"
-#include "WindowsBinWriter.h"
+#include "DerivedDataCache.h"
+#include "Hash.h"
 #include <filesystem>
 #include <unordered_set>
 
@@ -17,6 +17,9 @@ TMap<FString, FStaticMesh*> FObjManager::ObjStaticMeshMap;
 // 파일 유틸 함수
 namespace
 {
+	// 캐시에 저장하는 FStaticMesh/FMaterialInfo 포맷이나 임포트 규칙이 바뀌면 올림
+	constexpr uint32 ObjCacheVersion = 1;
+
 	/**
 	 * .mtl 텍스처 맵 라인에서 모든 옵션 토큰과 마지막 파일 경로를 분리하여 추출합니다.
 	 * 예: "-bm 1.0 path/to/file.png" -> OutOptions = ["-bm", "1.0"], OutFilePath = "path/to/file.png"
@@ -127,7 +130,7 @@ static FString FindMtlFilePath(const FString& InObjPath)
  * @param OutMtlFilePaths[out] 발견된 .mtl 파일들의 전체 경로가 저장될 배열입니다.
  * @return 스캔에 성공하면 true, 파일 열기에 실패하면 false를 반환합니다.
  */
-bool GetMtlDependencies(const FString& ObjPath, TArray<FWideString>& OutMtlFilePaths)
+bool GetMtlDependencies(const FString& ObjPath, TArray<FString>& OutMtlFilePaths)
 {
 	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
 	FWideString WPath = UTF8ToWide(ObjPath);
@@ -156,66 +159,13 @@ bool GetMtlDependencies(const FString& ObjPath, TArray<FWideString>& OutMtlFileP
 				fs::path FullPath = fs::weakly_canonical(BaseDir / MtlFileName);
 				FWideString PathStr = FullPath.wstring();
 				std::replace(PathStr.begin(), PathStr.end(), '\\', '/');
-				OutMtlFilePaths.AddUnique(NormalizePath(PathStr));
+				OutMtlFilePaths.AddUnique(NormalizePath(WideToUTF8(PathStr)));
 			}
 		}
 	}
 	return true;
 }
 
-/**
- * @brief 캐시 파일이 원본(.obj) 및 모든 의존성(.mtl) 파일보다 최신인지 검사합니다.
- * @param ObjPath 원본 .obj 파일의 경로입니다.
- * @param BinPath 메쉬 데이터 캐시(.obj.bin) 파일의 경로입니다.
- * @param MatBinPath 머티리얼 데이터 캐시(.mtl.bin) 파일의 경로입니다.
- * @return 캐시를 다시 생성해야 하면 true, 캐시가 유효하면 false를 반환합니다.
- */
-bool ShouldRegenerateCache(const FString& ObjPath, const FString& BinPath, const FString& MatBinPath)
-{
-	// 캐시 파일 중 하나라도 존재하지 않으면 무조건 재생성해야 합니다.
-	if (!fs::exists(BinPath) || !fs::exists(MatBinPath))
-	{
-		return true;
-	}
-
-	try
-	{
-		auto BinTimestamp = fs::last_write_time(BinPath);
-
-		// 1. 원본 .obj 파일의 수정 시간을 캐시 파일과 비교합니다.
-		if (fs::last_write_time(ObjPath) > BinTimestamp)
-		{
-			return true;
-		}
-
-		// 2. .obj 파일을 빠르게 스캔하여 의존하는 .mtl 파일 목록을 가져옵니다.
-		TArray<FWideString> MtlDependencies;
-		if (!GetMtlDependencies(ObjPath, MtlDependencies))
-		{
-			return true; // .obj 파일을 읽을 수 없으면 안전을 위해 캐시를 재생성합니다.
-		}
-
-		// 3. 각 .mtl 파일의 수정 시간을 캐시 파일과 비교합니다.
-		for (const FWideString& MtlPath : MtlDependencies)
-		{
-			// .mtl 파일이 존재하지 않거나 캐시보다 최신 버전이면 재생성합니다.
-			if (!fs::exists(MtlPath) || fs::last_write_time(MtlPath) > BinTimestamp)
-			{
-				return true;
-			}
-		}
-	}
-	catch (const fs::filesystem_error& e)
-	{
-		// 파일 시스템 오류(예: 접근 권한 없음) 발생 시 안전하게 캐시를 재생성합니다.
-		UE_LOG("Filesystem error during cache validation: %s. Forcing regeneration.", e.what());
-		return true;
-	}
-
-	// 모든 검사를 통과하면 캐시는 유효합니다.
-	return false;
-}
-
 void FObjManager::Preload()
 {
 	const fs::path DataDir(GDataDir);
@@ -297,73 +247,51 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	}
 
 #ifdef USE_OBJ_CACHE
-	// 2-1. 캐시 파일 경로 설정
-	FString CachePathStr = ConvertDataPathToCachePath(NormalizedPathStr);
-
-	const FString BinPathFileName = CachePathStr + ".bin";
-	const FString MatBinPathFileName = CachePathStr + ".mat.bin";
+	// 2-1. DDC 키: .obj와 참조하는 모든 .mtl의 콘텐츠 해시 (수정 시각과 무관)
+	FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+	FDerivedDataKey CacheKey{ "ObjMesh", ObjCacheVersion, DDC.HashSourceFile(NormalizedPathStr) };
 
-	// 캐시를 저장할 디렉토리가 없으면 생성
-	fs::path CacheFileDirPath(BinPathFileName);
-	if (CacheFileDirPath.has_parent_path())
+	// mtllib 목록은 .obj의 크기/수정 시각이 같으면 DDC 메모에서 가져옴 (캐시 히트마다 .obj 전체를 다시 스캔하지 않도록)
+	TArray<FString> MtlDependencies;
+	DDC.GetSourceDependencies(NormalizedPathStr, MtlDependencies, GetMtlDependencies);
+	for (const FString& MtlPath : MtlDependencies)
 	{
-		fs::create_directories(CacheFileDirPath.parent_path());
+		CacheKey.SourceHash = HashCombine(CacheKey.SourceHash, DDC.HashSourceFile(MtlPath));
 	}
 
 	// 3. 캐시 데이터 로드 시도 및 실패 시 재생성 로직
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
 	TArray<FMaterialInfo> MaterialInfos;
-	bool bLoadedSuccessfully = false;
-
-	// 캐시가 오래되었는지 먼저 확인
-	bool bShouldRegenerate = ShouldRegenerateCache(NormalizedPathStr, BinPathFileName, MatBinPathFileName);
+	FString CachePathStr;
 
-	if (!bShouldRegenerate)
-	{
-		UE_LOG("Attempting to load '%s' from cache.", NormalizedPathStr.c_str());
-		try
+	// 메시와 머티리얼을 한 엔트리에 저장 (손상된 엔트리는 DDC가 삭제)
+	bool bLoadedSuccessfully = DDC.Load(CacheKey, [&](FArchive& Reader)
 		{
-			// 캐시에서 FStaticMesh 데이터 로드
-			FWindowsBinReader Reader(BinPathFileName);
-			if (!Reader.IsOpen())
-			{
-				// Reader 생성자에서 예외를 던지지 않는 경우를 대비한 명시적 실패 처리
-				throw std::runtime_error("Failed to open bin file for reading.");
-			}
 			Reader << *NewFStaticMesh;
-			Reader.Close();
-
-			// 캐시에서 Material 데이터 로드
-			FWindowsBinReader MatReader(MatBinPathFileName);
-			if (!MatReader.IsOpen())
-			{
-				throw std::runtime_error("Failed to open material bin file for reading.");
-			}
-			Serialization::ReadArray<FMaterialInfo>(MatReader, MaterialInfos);
-			MatReader.Close();
+			Serialization::ReadArray<FMaterialInfo>(Reader, MaterialInfos);
+		}, &CachePathStr);
 
-			NewFStaticMesh->CacheFilePath = BinPathFileName;
+	if (bLoadedSuccessfully)
+	{
+		NewFStaticMesh->CacheFilePath = CachePathStr;
+		UE_LOG("Successfully loaded '%s' from cache.", NormalizedPathStr.c_str());
+	}
+	else
+	{
+		// 읽다 만 데이터가 남지 않도록 새로 만듦
+		delete NewFStaticMesh;
+		NewFStaticMesh = nullptr;
+		MaterialInfos.clear();
+	}
 
-			// 모든 로드가 성공적으로 완료됨
-			bLoadedSuccessfully = true;
-			UE_LOG("Successfully loaded '%s' from cache.", NormalizedPathStr.c_str());
-		}
-		catch (const std::exception& e)
+	auto SaveToCache = [&]()
 		{
-			UE_LOG("Error loading from cache: %s. Cache might be corrupt or incompatible.", e.what());
-			UE_LOG("Deleting corrupt cache and forcing regeneration for '%s'.", NormalizedPathStr.c_str());
-
-			// 실패 시 생성 중이던 객체 메모리 정리
-			delete NewFStaticMesh;
-			NewFStaticMesh = nullptr; // 포인터를 nullptr로 설정하여 이중 삭제 방지
-
-			// 손상된 캐시 파일 삭제
-			fs::remove(BinPathFileName);
-			fs::remove(MatBinPathFileName);
-
-			bLoadedSuccessfully = false;
-		}
-	}
+			return DDC.Put(CacheKey, [&](FArchive& Writer)
+				{
+					Writer << *NewFStaticMesh;
+					Serialization::WriteArray<FMaterialInfo>(Writer, MaterialInfos);
+				}, &NewFStaticMesh->CacheFilePath);
+		};
 #else
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
 	TArray<FMaterialInfo> MaterialInfos;
@@ -414,16 +342,11 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos);
 
 #ifdef USE_OBJ_CACHE
-		// 새로운 캐시 파일(.bin) 저장 (이제 올바른 데이터가 저장됨)
-		FWindowsBinWriter Writer(BinPathFileName);
-		Writer << *NewFStaticMesh;
-		Writer.Close();
-
-		FWindowsBinWriter MatWriter(MatBinPathFileName);
-		Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
-		MatWriter.Close();
-
-		UE_LOG("Cache regeneration complete for '%s'.", NormalizedPathStr.c_str());
+		// 새로운 캐시 엔트리 저장 (이제 올바른 데이터가 저장됨)
+		if (SaveToCache())
+		{
+			UE_LOG("Cache regeneration complete for '%s'.", NormalizedPathStr.c_str());
+		}
 #endif // USE_OBJ_CACHE
 	}
 	else
@@ -435,18 +358,9 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 #ifdef USE_OBJ_CACHE
 			// 변경된 경우, 캐시를 갱신합니다.
 			UE_LOG("Updating outdated cache for '%s' with default material.", NormalizedPathStr.c_str());
-			try
-			{
-				FWindowsBinWriter Writer(BinPathFileName);
-				Writer << *NewFStaticMesh;
-				Writer.Close();
-				FWindowsBinWriter MatWriter(MatBinPathFileName);
-				Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
-				MatWriter.Close();
-			}
-			catch (const std::exception& e)
+			if (!SaveToCache())
 			{
-				UE_LOG("Failed to update cache for default material: %s", e.what());
+				UE_LOG("Failed to update cache for default material: %s", NormalizedPathStr.c_str());
 			}
 #endif // USE_OBJ_CACHE
 		}
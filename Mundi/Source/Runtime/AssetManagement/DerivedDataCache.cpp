@@ -0,0 +1,599 @@
+﻿#include "pch.h"
+#include "DerivedDataCache.h"
+#include "Hash.h"
+#include "MappedFileReader.h"
+#include "WindowsBinWriter.h"
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	constexpr uint32 IndexMagic = 0x49434444;   // "DDCI"
+	constexpr uint32 IndexVersion = 2;
+	constexpr uint32 EntryMagic = 0x45434444;   // "DDCE"
+
+	/** 콘텐츠 해시 (FastHash - 큰 소스 파일은 3레인 루프로 처리) */
+	uint64 HashBytes(const uint8* Data, uint64 Size)
+	{
+		return FastHash::HashBytes(Data, static_cast<SIZE_T>(Size));
+	}
+
+	uint64 HashString(const FString& Str)
+	{
+		return HashBytes(reinterpret_cast<const uint8*>(Str.data()), Str.size());
+	}
+
+	/** 키 문자열이 그대로 파일명이 되므로 경로에 쓸 수 없는 문자는 '_'로 바꿈 */
+	FString SanitizeKeyPart(const FString& InPart)
+	{
+		FString Result = InPart;
+		for (char& Ch : Result)
+		{
+			if (Ch == '|' || Ch == ':' || Ch == '*' || Ch == '?' || Ch == '"' || Ch == '<' || Ch == '>' || Ch == '/' || Ch == '\\' || Ch == ' ')
+			{
+				Ch = '_';
+			}
+		}
+		return Result;
+	}
+
+	/** Temp -> Final 교체 (같은 볼륨 rename이므로 원자적, 기존 파일은 덮어씀) */
+	bool ReplaceFile(const FString& TempPath, const FString& FinalPath)
+	{
+		std::error_code Ec;
+		fs::rename(fs::path(UTF8ToWide(TempPath)), fs::path(UTF8ToWide(FinalPath)), Ec);
+		if (Ec)
+		{
+			fs::remove(fs::path(UTF8ToWide(TempPath)), Ec);
+			return false;
+		}
+		return true;
+	}
+}
+
+FString FDerivedDataKey::ToString() const
+{
+	char HashText[17];
+	std::snprintf(HashText, sizeof(HashText), "%016llx", static_cast<unsigned long long>(SourceHash));
+
+	FString Result = SanitizeKeyPart(Bucket) + "/" + HashText + "_v" + std::to_string(Version);
+	if (!Variant.empty())
+	{
+		Result += "_" + SanitizeKeyPart(Variant);
+	}
+	return Result + Extension;
+}
+
+FDerivedDataCache::FDerivedDataCache()
+	: RootDir(GCacheDir + "/DDC")
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	LoadIndex();
+}
+
+FDerivedDataCache::~FDerivedDataCache()
+{
+	Flush();
+}
+
+uint64 FDerivedDataCache::HashSourceFile(const FString& SourcePath)
+{
+	const FString NormalizedPath = NormalizePath(SourcePath);
+	const uint64 PathHash = HashString(NormalizedPath);
+
+	// 크기/수정 시각은 해시 메모를 다시 계산할지 판단하는 데만 사용 (캐시 유효성과 무관)
+	uint64 FileSize = 0;
+	int64 WriteTime = 0;
+	if (!GetSourceStamp(NormalizedPath, FileSize, WriteTime))
+	{
+		return PathHash;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		const FSourceMemo* Memo = SourceMemos.Find(NormalizedPath);
+		if (Memo && Memo->bHasHash && Memo->FileSize == FileSize && Memo->WriteTime == WriteTime)
+		{
+			return HashCombine(PathHash, Memo->Hash);
+		}
+	}
+
+	FMappedFileReader Reader(NormalizedPath);
+	if (!Reader.IsOpen())
+	{
+		return PathHash;
+	}
+	const uint64 ContentHash = HashBytes(Reader.GetData(), static_cast<uint64>(Reader.GetSize()));
+	Reader.Close();
+
+	std::lock_guard<std::mutex> Lock(Mutex);
+	FSourceMemo& Memo = GetSourceMemo(NormalizedPath, FileSize, WriteTime);
+	Memo.Hash = ContentHash;
+	Memo.bHasHash = true;
+	bDirty = true;
+	return HashCombine(PathHash, ContentHash);
+}
+
+bool FDerivedDataCache::GetSourceDependencies(const FString& SourcePath, TArray<FString>& OutDependencies,
+	const std::function<bool(const FString&, TArray<FString>&)>& Scanner)
+{
+	const FString NormalizedPath = NormalizePath(SourcePath);
+
+	uint64 FileSize = 0;
+	int64 WriteTime = 0;
+	const bool bHasStamp = GetSourceStamp(NormalizedPath, FileSize, WriteTime);
+	if (bHasStamp)
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		const FSourceMemo* Memo = SourceMemos.Find(NormalizedPath);
+		if (Memo && Memo->bHasDependencies && Memo->FileSize == FileSize && Memo->WriteTime == WriteTime)
+		{
+			OutDependencies = Memo->Dependencies;
+			return true;
+		}
+	}
+
+	// 스캔은 잠금 밖에서 (원본 전체를 읽을 수 있음)
+	TArray<FString> Dependencies;
+	if (!Scanner(NormalizedPath, Dependencies))
+	{
+		return false;
+	}
+
+	if (bHasStamp)
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		FSourceMemo& Memo = GetSourceMemo(NormalizedPath, FileSize, WriteTime);
+		Memo.Dependencies = Dependencies;
+		Memo.bHasDependencies = true;
+		bDirty = true;
+	}
+	OutDependencies = std::move(Dependencies);
+	return true;
+}
+
+bool FDerivedDataCache::Find(const FDerivedDataKey& Key, FString& OutPath)
+{
+	const FString KeyString = Key.ToString();
+
+	std::lock_guard<std::mutex> Lock(Mutex);
+	FEntry* Entry = Entries.Find(KeyString);
+	if (!Entry)
+	{
+		return false;
+	}
+
+	Entry->LastAccess = ++AccessCounter;
+	bDirty = true;
+	OutPath = GetEntryPath(KeyString);
+	return true;
+}
+
+bool FDerivedDataCache::Load(const FDerivedDataKey& Key, const std::function<void(FArchive&)>& Reader, FString* OutPath)
+{
+	FString EntryPath;
+	if (!Find(Key, EntryPath))
+	{
+		return false;
+	}
+
+	try
+	{
+		FMappedFileReader Archive(EntryPath);
+		if (!Archive.IsOpen())
+		{
+			throw std::runtime_error("entry file is missing");
+		}
+
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		uint64 SourceHash = 0;
+		Archive << Magic << Version << SourceHash;
+		if (Magic != EntryMagic || Version != Key.Version || SourceHash != Key.SourceHash)
+		{
+			throw std::runtime_error("entry header mismatch");
+		}
+
+		Reader(Archive);
+		Archive.Close();
+	}
+	catch (const std::exception& e)
+	{
+		UE_LOG("[DDC] Failed to load '%s': %s. Removing entry.", Key.ToString().c_str(), e.what());
+		Remove(Key);
+		return false;
+	}
+
+	if (OutPath)
+	{
+		*OutPath = EntryPath;
+	}
+	return true;
+}
+
+bool FDerivedDataCache::Put(const FDerivedDataKey& Key, const std::function<void(FArchive&)>& Writer, FString* OutPath)
+{
+	const FString TempPath = GetTempPath(Key);
+
+	try
+	{
+		FWindowsBinWriter Archive(TempPath);
+
+		uint32 Magic = EntryMagic;
+		uint32 Version = Key.Version;
+		uint64 SourceHash = Key.SourceHash;
+		Archive << Magic << Version << SourceHash;
+
+		Writer(Archive);
+
+		if (Archive.Tell() < 0)
+		{
+			throw std::runtime_error("write failed");
+		}
+		Archive.Close();
+	}
+	catch (const std::exception& e)
+	{
+		UE_LOG("[DDC] Failed to write '%s': %s", Key.ToString().c_str(), e.what());
+		std::error_code Ec;
+		fs::remove(fs::path(UTF8ToWide(TempPath)), Ec);
+		return false;
+	}
+
+	return Commit(Key, TempPath, OutPath);
+}
+
+FString FDerivedDataCache::GetTempPath(const FDerivedDataKey& Key)
+{
+	const FString KeyString = Key.ToString();
+	const FString EntryPath = GetEntryPath(KeyString);
+
+	std::error_code Ec;
+	fs::create_directories(fs::path(UTF8ToWide(EntryPath)).parent_path(), Ec);
+
+	uint32 Counter;
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		Counter = ++TempCounter;
+	}
+
+	// 확장자를 유지해야 하는 도구(DirectXTex 등)를 위해 접미사는 이름 앞쪽에 붙임
+	const fs::path EntryFsPath(UTF8ToWide(EntryPath));
+	const FString Stem = WideToUTF8(EntryFsPath.stem().wstring());
+	const FString Extension = WideToUTF8(EntryFsPath.extension().wstring());
+	return NormalizePath(WideToUTF8(EntryFsPath.parent_path().wstring())) + "/" + Stem + ".tmp" + std::to_string(Counter) + Extension;
+}
+
+bool FDerivedDataCache::Commit(const FDerivedDataKey& Key, const FString& TempPath, FString* OutPath)
+{
+	const FString KeyString = Key.ToString();
+	const FString EntryPath = GetEntryPath(KeyString);
+
+	std::error_code Ec;
+	const uint64 Size = static_cast<uint64>(fs::file_size(fs::path(UTF8ToWide(TempPath)), Ec));
+	if (Ec || !ReplaceFile(TempPath, EntryPath))
+	{
+		UE_LOG("[DDC] Failed to commit '%s'", KeyString.c_str());
+		fs::remove(fs::path(UTF8ToWide(TempPath)), Ec);
+		return false;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		if (const FEntry* Existing = Entries.Find(KeyString))
+		{
+			TotalBytes -= Existing->Size;
+		}
+		Entries[KeyString] = FEntry{ Size, ++AccessCounter };
+		TotalBytes += Size;
+
+		EvictToBudget(KeyString);
+
+		// 쿡 비용에 비하면 인덱스(수십 KB) 기록은 무시할 수준이므로 바로 반영
+		SaveIndex();
+	}
+
+	if (OutPath)
+	{
+		*OutPath = EntryPath;
+	}
+	return true;
+}
+
+void FDerivedDataCache::Remove(const FDerivedDataKey& Key)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	RemoveEntry(Key.ToString());
+	SaveIndex();
+}
+
+void FDerivedDataCache::SetBudgetBytes(uint64 InBudgetBytes)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	BudgetBytes = InBudgetBytes;
+	if (TotalBytes > BudgetBytes)
+	{
+		EvictToBudget(FString());
+		SaveIndex();
+	}
+}
+
+uint64 FDerivedDataCache::GetTotalBytes()
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	return TotalBytes;
+}
+
+uint32 FDerivedDataCache::GetNumEntries()
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	return static_cast<uint32>(Entries.Num());
+}
+
+void FDerivedDataCache::Flush()
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	if (bDirty)
+	{
+		SaveIndex();
+	}
+}
+
+FString FDerivedDataCache::GetEntryPath(const FString& KeyString) const
+{
+	return RootDir + "/" + KeyString;
+}
+
+bool FDerivedDataCache::GetSourceStamp(const FString& NormalizedPath, uint64& OutFileSize, int64& OutWriteTime)
+{
+	const fs::path FilePath(UTF8ToWide(NormalizedPath));
+	std::error_code Ec;
+	OutFileSize = static_cast<uint64>(fs::file_size(FilePath, Ec));
+	if (Ec)
+	{
+		return false;
+	}
+	OutWriteTime = static_cast<int64>(fs::last_write_time(FilePath, Ec).time_since_epoch().count());
+	return !Ec;
+}
+
+FDerivedDataCache::FSourceMemo& FDerivedDataCache::GetSourceMemo(const FString& NormalizedPath, uint64 FileSize, int64 WriteTime)
+{
+	FSourceMemo& Memo = SourceMemos[NormalizedPath];
+	if (Memo.FileSize != FileSize || Memo.WriteTime != WriteTime)
+	{
+		Memo = FSourceMemo{};
+		Memo.FileSize = FileSize;
+		Memo.WriteTime = WriteTime;
+	}
+	return Memo;
+}
+
+void FDerivedDataCache::LoadIndex()
+{
+	Entries.Empty();
+	SourceMemos.Empty();
+	TotalBytes = 0;
+	AccessCounter = 0;
+
+	const FString IndexPath = RootDir + "/Index.bin";
+	try
+	{
+		FMappedFileReader Reader(IndexPath);
+		if (!Reader.IsOpen())
+		{
+			RebuildIndex();
+			return;
+		}
+
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		Reader << Magic << Version;
+		if (Magic != IndexMagic || Version != IndexVersion)
+		{
+			throw std::runtime_error("index header mismatch");
+		}
+
+		Reader << AccessCounter;
+
+		uint32 NumEntries = 0;
+		Reader << NumEntries;
+		for (uint32 i = 0; i < NumEntries; ++i)
+		{
+			FString KeyString;
+			FEntry Entry;
+			Serialization::ReadString(Reader, KeyString);
+			Reader << Entry.Size << Entry.LastAccess;
+			Entries[KeyString] = Entry;
+			TotalBytes += Entry.Size;
+		}
+
+		uint32 NumMemos = 0;
+		Reader << NumMemos;
+		for (uint32 i = 0; i < NumMemos; ++i)
+		{
+			FString SourcePath;
+			FSourceMemo Memo;
+			Serialization::ReadString(Reader, SourcePath);
+			uint8 bHasHash = 0;
+			uint8 bHasDependencies = 0;
+			uint32 NumDependencies = 0;
+			Reader << Memo.FileSize << Memo.WriteTime << Memo.Hash << bHasHash << bHasDependencies << NumDependencies;
+			Memo.bHasHash = bHasHash != 0;
+			Memo.bHasDependencies = bHasDependencies != 0;
+			if (NumDependencies > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+			{
+				throw std::runtime_error("dependency count is unreasonable");
+			}
+			Memo.Dependencies.SetNum(static_cast<int32>(NumDependencies));
+			for (FString& Dependency : Memo.Dependencies)
+			{
+				Serialization::ReadString(Reader, Dependency);
+			}
+			SourceMemos[SourcePath] = std::move(Memo);
+		}
+		bDirty = false;
+	}
+	catch (const std::exception& e)
+	{
+		UE_LOG("[DDC] Index is corrupt (%s). Rebuilding from %s.", e.what(), RootDir.c_str());
+		Entries.Empty();
+		SourceMemos.Empty();
+		TotalBytes = 0;
+		AccessCounter = 0;
+		RebuildIndex();
+	}
+}
+
+void FDerivedDataCache::RebuildIndex()
+{
+	// 인덱스가 없거나 손상된 경우에만 한 번 디렉토리를 훑음 (남은 임시 파일도 정리)
+	const fs::path Root(UTF8ToWide(RootDir));
+	std::error_code Ec;
+	if (!fs::is_directory(Root, Ec))
+	{
+		return;
+	}
+
+	TArray<fs::path> StaleFiles;
+	for (fs::recursive_directory_iterator It(Root, Ec), End; !Ec && It != End; It.increment(Ec))
+	{
+		if (!It->is_regular_file(Ec))
+		{
+			continue;
+		}
+
+		const fs::path& FilePath = It->path();
+		const FString FileName = WideToUTF8(FilePath.filename().wstring());
+		if (FileName.find(".tmp") != FString::npos || FileName.rfind("Index.bin", 0) == 0)
+		{
+			StaleFiles.Add(FilePath);
+			continue;
+		}
+
+		const FString KeyString = NormalizePath(WideToUTF8(fs::relative(FilePath, Root, Ec).wstring()));
+		const uint64 Size = static_cast<uint64>(It->file_size(Ec));
+		Entries[KeyString] = FEntry{ Size, 0 };
+		TotalBytes += Size;
+	}
+
+	for (const fs::path& FilePath : StaleFiles)
+	{
+		fs::remove(FilePath, Ec);
+	}
+
+	bDirty = true;
+	EvictToBudget(FString());
+	SaveIndex();
+}
+
+void FDerivedDataCache::SaveIndex()
+{
+	const FString IndexPath = RootDir + "/Index.bin";
+	const FString TempPath = IndexPath + ".tmp";
+
+	std::error_code Ec;
+	fs::create_directories(fs::path(UTF8ToWide(RootDir)), Ec);
+
+	try
+	{
+		FWindowsBinWriter Writer(TempPath);
+
+		uint32 Magic = IndexMagic;
+		uint32 Version = IndexVersion;
+		Writer << Magic << Version << AccessCounter;
+
+		uint32 NumEntries = static_cast<uint32>(Entries.Num());
+		Writer << NumEntries;
+		for (auto& Pair : Entries)
+		{
+			Serialization::WriteString(Writer, Pair.first);
+			Writer << Pair.second.Size << Pair.second.LastAccess;
+		}
+
+		uint32 NumMemos = static_cast<uint32>(SourceMemos.Num());
+		Writer << NumMemos;
+		for (auto& Pair : SourceMemos)
+		{
+			Serialization::WriteString(Writer, Pair.first);
+			uint8 bHasHash = Pair.second.bHasHash ? 1 : 0;
+			uint8 bHasDependencies = Pair.second.bHasDependencies ? 1 : 0;
+			uint32 NumDependencies = static_cast<uint32>(Pair.second.Dependencies.Num());
+			Writer << Pair.second.FileSize << Pair.second.WriteTime << Pair.second.Hash << bHasHash << bHasDependencies << NumDependencies;
+			for (const FString& Dependency : Pair.second.Dependencies)
+			{
+				Serialization::WriteString(Writer, Dependency);
+			}
+		}
+
+		if (Writer.Tell() < 0)
+		{
+			throw std::runtime_error("write failed");
+		}
+		Writer.Close();
+	}
+	catch (const std::exception&)
+	{
+		fs::remove(fs::path(UTF8ToWide(TempPath)), Ec);
+		return;
+	}
+
+	if (ReplaceFile(TempPath, IndexPath))
+	{
+		bDirty = false;
+	}
+}
+
+void FDerivedDataCache::RemoveEntry(const FString& KeyString)
+{
+	const FEntry* Entry = Entries.Find(KeyString);
+	if (!Entry)
+	{
+		return;
+	}
+
+	TotalBytes -= Entry->Size;
+	Entries.Remove(KeyString);
+
+	// 다른 곳에서 매핑 중이면 삭제가 실패할 수 있음 - 인덱스에서는 빠지므로 다음 재구축 때 정리됨
+	std::error_code Ec;
+	fs::remove(fs::path(UTF8ToWide(GetEntryPath(KeyString))), Ec);
+	bDirty = true;
+}
+
+void FDerivedDataCache::EvictToBudget(const FString& KeepKey)
+{
+	if (TotalBytes <= BudgetBytes)
+	{
+		return;
+	}
+
+	TArray<std::pair<uint64, FString>> ByAccess;
+	ByAccess.Reserve(Entries.Num());
+	for (auto& Pair : Entries)
+	{
+		if (Pair.first != KeepKey)
+		{
+			ByAccess.Add({ Pair.second.LastAccess, Pair.first });
+		}
+	}
+	std::sort(ByAccess.begin(), ByAccess.end());
+
+	uint32 NumEvicted = 0;
+	for (const auto& Candidate : ByAccess)
+	{
+		if (TotalBytes <= BudgetBytes)
+		{
+			break;
+		}
+		RemoveEntry(Candidate.second);
+		++NumEvicted;
+	}
+
+	UE_LOG("[DDC] Evicted %u entries (%.1f MB / %.1f MB budget)", NumEvicted,
+		static_cast<double>(TotalBytes) / (1024.0 * 1024.0), static_cast<double>(BudgetBytes) / (1024.0 * 1024.0));
+}
@@ -0,0 +1,142 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include <functional>
+#include <mutex>
+
+class FArchive;
+
+/**
+ * @brief DDC 엔트리 키
+ * - 원본 콘텐츠 해시 + 쿡 버전(+ 변형)으로 만들어지므로 타임스탬프와 무관합니다.
+ * - 쿡 결과 포맷이나 설정이 바뀌면 해당 쿠커의 Version을 올리면 됩니다. (이전 엔트리는 LRU로 정리)
+ */
+struct FDerivedDataKey
+{
+	FString Bucket;              // 쿠커 이름 (하위 디렉토리로 사용)
+	uint32 Version = 0;          // 쿡 설정/포맷 버전
+	uint64 SourceHash = 0;       // FDerivedDataCache::HashSourceFile 결과 (여러 개면 HashCombine)
+	FString Variant;             // 같은 원본의 다른 쿡 설정 (예: 텍스처 포맷)
+	FString Extension = ".bin";  // 엔트리 파일 확장자 (DDS처럼 확장자로 판별하는 로더용)
+
+	/** 인덱스 키이자 DDC 루트 기준 상대 경로 - "Bucket/0123456789abcdef_v1[_Variant].bin" */
+	FString ToString() const;
+};
+
+/**
+ * @brief 통합 파생 데이터 캐시 (OBJ/FBX 메시, 애니메이션, DDS, PhysX 쿡 데이터)
+ * - 유효성은 키(콘텐츠 해시 + 버전)로만 판단하며, 원본/캐시 파일의 수정 시각은 비교하지 않습니다.
+ * - 엔트리 목록, 크기, 마지막 접근 순번과 원본 해시 메모를 인덱스 파일 하나(DDC/Index.bin)에 보관하므로
+ *   조회 시 캐시 파일을 stat 하지 않습니다. 원본 해시와 참조 목록은 (경로, 크기, 수정 시각)이 바뀔 때만 다시 계산합니다.
+ * - 엔트리와 인덱스는 임시 파일에 쓴 뒤 rename으로 교체합니다. (쓰는 도중 종료돼도 반쯤 쓴 엔트리가 보이지 않음)
+ * - 전체 크기가 예산을 넘으면 가장 오래 접근하지 않은 엔트리부터 삭제합니다.
+ * - 모든 함수는 스레드 안전합니다. (Load/Put 콜백은 잠금 밖에서 실행)
+ */
+class FDerivedDataCache
+{
+public:
+	static FDerivedDataCache& GetInstance()
+	{
+		static FDerivedDataCache Instance;
+		return Instance;
+	}
+
+	/**
+	 * @brief 원본 파일의 콘텐츠 해시 (정규화 경로 포함)
+	 * @return 파일을 읽을 수 없으면 경로만으로 만든 해시 (이 경우 쿡도 실패하므로 엔트리가 생기지 않음)
+	 */
+	uint64 HashSourceFile(const FString& SourcePath);
+
+	/**
+	 * @brief 원본 파일이 참조하는 다른 원본 목록 (예: .obj의 mtllib)
+	 * - 해시와 같이 (크기, 수정 시각)이 바뀔 때만 Scanner로 다시 스캔하고, 결과는 인덱스에 메모합니다.
+	 * @return Scanner가 실패하면 false (메모하지 않음)
+	 */
+	bool GetSourceDependencies(const FString& SourcePath, TArray<FString>& OutDependencies,
+		const std::function<bool(const FString&, TArray<FString>&)>& Scanner);
+
+	/**
+	 * @brief 엔트리가 있으면 경로를 돌려주고 LRU 순번을 갱신 (인덱스만 확인)
+	 */
+	bool Find(const FDerivedDataKey& Key, FString& OutPath);
+
+	/**
+	 * @brief 엔트리를 매핑해 Reader에 넘김
+	 * @return 엔트리가 없거나, 헤더가 맞지 않거나, Reader가 예외를 던지면 엔트리를 지우고 false
+	 */
+	bool Load(const FDerivedDataKey& Key, const std::function<void(FArchive&)>& Reader, FString* OutPath = nullptr);
+
+	/**
+	 * @brief Writer로 엔트리를 써서 원자적으로 등록
+	 * @return 실패 시 false (임시 파일은 삭제됨)
+	 */
+	bool Put(const FDerivedDataKey& Key, const std::function<void(FArchive&)>& Writer, FString* OutPath = nullptr);
+
+	/**
+	 * @brief 외부 도구가 직접 파일을 쓰는 경우 (예: DirectXTex SaveToDDSFile)
+	 * - GetTempPath로 받은 경로에 쓰고 Commit으로 등록합니다. Load/Put의 헤더는 붙지 않습니다.
+	 */
+	FString GetTempPath(const FDerivedDataKey& Key);
+	bool Commit(const FDerivedDataKey& Key, const FString& TempPath, FString* OutPath = nullptr);
+
+	void Remove(const FDerivedDataKey& Key);
+
+	/** 용량 예산 (바이트). 줄이면 즉시 정리 */
+	void SetBudgetBytes(uint64 InBudgetBytes);
+	uint64 GetBudgetBytes() const { return BudgetBytes; }
+	uint64 GetTotalBytes();
+	uint32 GetNumEntries();
+
+	/** LRU 순번 등 변경된 인덱스를 디스크에 기록 (엔진 종료 시 호출) */
+	void Flush();
+
+	static constexpr uint64 DefaultBudgetBytes = 2ull * 1024 * 1024 * 1024;
+
+private:
+	FDerivedDataCache();
+	~FDerivedDataCache();
+
+	FDerivedDataCache(const FDerivedDataCache&) = delete;
+	FDerivedDataCache& operator=(const FDerivedDataCache&) = delete;
+
+	struct FEntry
+	{
+		uint64 Size = 0;
+		uint64 LastAccess = 0;
+	};
+
+	struct FSourceMemo
+	{
+		uint64 FileSize = 0;
+		int64 WriteTime = 0;
+		uint64 Hash = 0;
+		TArray<FString> Dependencies;
+		bool bHasHash = false;
+		bool bHasDependencies = false;
+	};
+
+	FString GetEntryPath(const FString& KeyString) const;
+
+	/** 원본의 (크기, 수정 시각). 파일이 없으면 false */
+	static bool GetSourceStamp(const FString& NormalizedPath, uint64& OutFileSize, int64& OutWriteTime);
+
+	/** 스탬프가 다르면 메모를 비우고 새 스탬프로 초기화 (Mutex를 잡은 상태에서 호출) */
+	FSourceMemo& GetSourceMemo(const FString& NormalizedPath, uint64 FileSize, int64 WriteTime);
+
+	// 아래 함수들은 Mutex를 잡은 상태에서 호출
+	void LoadIndex();
+	void RebuildIndex();
+	void SaveIndex();
+	void RemoveEntry(const FString& KeyString);
+	void EvictToBudget(const FString& KeepKey);
+
+	std::mutex Mutex;
+	TMap<FString, FEntry> Entries;
+	TMap<FString, FSourceMemo> SourceMemos;
+	uint64 AccessCounter = 0;
+	uint64 TotalBytes = 0;
+	uint64 BudgetBytes = DefaultBudgetBytes;
+	uint32 TempCounter = 0;
+	bool bDirty = false;
+
+	FString RootDir;
+};
@@ -119,7 +119,7 @@ protected:
 	ID3D11DeviceContext* Context = nullptr;
 
 	//Resource Type의 개수만큼 Array 생성 및 저장
-	TArray<TMap<FString, UResourceBase*>> Resources;
+	TArray<TFlatMap<FString, UResourceBase*>> Resources;
 
 	TMap<FString, TArray<D3D11_INPUT_ELEMENT_DESC>> ShaderToInputLayoutMap;
 	TMap<FString, FString> TextureToShaderMap;
@@ -137,10 +137,10 @@ private:
 
 	ID3D11ShaderResourceView* CubeMapSRV = nullptr;
 	// --- 비공개 멤버 변수 ---
-	TMap<FString, UMaterial*> MaterialMap;
+	TFlatMap<FString, UMaterial*> MaterialMap;
 
 	// Cache for per-mesh BVHs to avoid rebuilding for identical OBJ assets
-	TMap<FString, FMeshBVH*> MeshBVHCache;
+	TFlatMap<FString, FMeshBVH*> MeshBVHCache;
 
 	UMaterial* DefaultMaterialInstance;
 
@@ -211,6 +211,7 @@ inline T* UResourceManager::Load(const FString& InFilePath, Args && ...InArgs)
 	}
 	else//없으면 해당 리소스의 Load실행
 	{
+		FMemoryTagScope TagScope(EMemoryTag::ResourceManager);
 		T* Resource = NewObject<T>();
 		if (!Resource->Load(NormalizedPath, Device, std::forward<Args>(InArgs)...))
 		{
@@ -243,6 +244,7 @@ inline UShader* UResourceManager::Load(const FString& InFilePath, TArray<FShader
 	else
 	{
 		// 3. 캐시에 없으면 새로 생성하여 로드
+		FMemoryTagScope TagScope(EMemoryTag::ResourceManager);
 		UShader* Resource = NewObject<UShader>();
 		// UShader::Load는 이제 매크로 인자를 받도록 수정되어야 함
 		Resource->Load(NormalizedPath, Device, InMacros);
@@ -6,14 +6,16 @@
 #include "Source/Editor/FBX/FbxLoader.h"
 #include "Source/Runtime/Engine/Physics/BodySetup.h"
 #include "Source/Runtime/Core/Misc/PathUtils.h"
-#include "Source/Runtime/Core/Misc/WindowsBinReader.h"
-#include "Source/Runtime/Core/Misc/WindowsBinWriter.h"
+#include "DerivedDataCache.h"
 #include <filesystem>
 
 IMPLEMENT_CLASS(UStaticMesh)
 
 namespace
 {
+    // PhysX 쿡 옵션/포맷이 바뀌면 올려서 DDC의 convex/trimesh 엔트리를 무효화
+    constexpr uint32 PhysXCookVersion = 1;
+
     // FSkeletalMeshData를 FStaticMesh로 변환 (본 정보 제거)
     FStaticMesh* ConvertSkeletalToStaticMesh(const FSkeletalMeshData& SkeletalData)
     {
@@ -230,50 +232,17 @@ void UStaticMesh::InitConvexMesh()
 		return;
 	}
 
-	FString convexCachePath = ConvertDataPathToCachePath(GetAssetPathFileName()) + ".convex.bin";
-
-	bool bShouldRegenerate = true;
-	if (std::filesystem::exists(convexCachePath))
-	{
-		try
-		{
-			auto cacheTime = std::filesystem::last_write_time(convexCachePath);
-			auto originalTime = std::filesystem::last_write_time(GetAssetPathFileName());
-			if (cacheTime >= originalTime)
-			{
-				bShouldRegenerate = false;
-			}
-		}
-		catch (const std::filesystem::filesystem_error& e)
-		{
-			UE_LOG("Filesystem error during cache validation: %s. Forcing regeneration.", e.what());
-			bShouldRegenerate = true;
-		}
-	}
+	FDerivedDataKey ConvexKey{ "PhysXConvex", PhysXCookVersion, FDerivedDataCache::GetInstance().HashSourceFile(GetAssetPathFileName()) };
 
 	FKConvexElem& convexElem = BodySetup->AggGeom.ConvexElements[0];
 
+	bool bShouldRegenerate = !FDerivedDataCache::GetInstance().Load(ConvexKey, [&](FArchive& reader)
+		{
+			Serialization::ReadArray(reader, convexElem.CookedData);
+		});
 	if (!bShouldRegenerate)
 	{
-		try
-		{
-			FWindowsBinReader reader(convexCachePath);
-			if (reader.IsOpen())
-			{
-				Serialization::ReadArray(reader, convexElem.CookedData);
-				reader.Close();
-				UE_LOG("Loaded convex mesh from cache: %s", convexCachePath.c_str());
-			}
-			else
-			{
-				bShouldRegenerate = true;
-			}
-		}
-		catch (const std::exception& e)
-		{
-			UE_LOG("Error loading convex cache: %s. Forcing regeneration.", e.what());
-			bShouldRegenerate = true;
-		}
+		UE_LOG("Loaded convex mesh from cache: %s", ConvexKey.ToString().c_str());
 	}
 
 	if (bShouldRegenerate)
@@ -331,11 +300,10 @@ void UStaticMesh::InitConvexMesh()
 		convexElem.CookedData.SetNum(buf.getSize());
 		memcpy(convexElem.CookedData.GetData(), buf.getData(), buf.getSize());
 
-		FWindowsBinWriter writer(convexCachePath);
-
-        Serialization::WriteArray(writer, convexElem.CookedData);
-        writer.Close();
-        UE_LOG("Saved cooked convex mesh to cache: %s", convexCachePath.c_str());
+		if (FDerivedDataCache::GetInstance().Put(ConvexKey, [&](FArchive& writer) { Serialization::WriteArray(writer, convexElem.CookedData); }))
+		{
+			UE_LOG("Saved cooked convex mesh to cache: %s", ConvexKey.ToString().c_str());
+		}
 
 		gCooking->release();
 		gPhysics->release();
@@ -350,50 +318,17 @@ void UStaticMesh::InitTriangleMesh()
 		return;
 	}
 
-	FString trimeshCachePath = ConvertDataPathToCachePath(GetAssetPathFileName()) + ".trimesh.bin";
-
-	bool bShouldRegenerate = true;
-	if (std::filesystem::exists(trimeshCachePath))
-	{
-		try
-		{
-			auto cacheTime = std::filesystem::last_write_time(trimeshCachePath);
-			auto originalTime = std::filesystem::last_write_time(GetAssetPathFileName());
-			if (cacheTime >= originalTime)
-			{
-				bShouldRegenerate = false;
-			}
-		}
-		catch (const std::filesystem::filesystem_error& e)
-		{
-			UE_LOG("Filesystem error during cache validation: %s. Forcing regeneration.", e.what());
-			bShouldRegenerate = true;
-		}
-	}
+	FDerivedDataKey TriMeshKey{ "PhysXTriMesh", PhysXCookVersion, FDerivedDataCache::GetInstance().HashSourceFile(GetAssetPathFileName()) };
 
 	FKTriangleMeshElem TriMeshElem;
 
+	bool bShouldRegenerate = !FDerivedDataCache::GetInstance().Load(TriMeshKey, [&](FArchive& reader)
+		{
+			Serialization::ReadArray(reader, TriMeshElem.CookedData);
+		});
 	if (!bShouldRegenerate)
 	{
-		try
-		{
-			FWindowsBinReader reader(trimeshCachePath);
-			if (reader.IsOpen())
-			{
-				Serialization::ReadArray(reader, TriMeshElem.CookedData);
-				reader.Close();
-				UE_LOG("Loaded triangle mesh from cache: %s", trimeshCachePath.c_str());
-			}
-			else
-			{
-				bShouldRegenerate = true;
-			}
-		}
-		catch (const std::exception& e)
-		{
-			UE_LOG("Error loading triangle mesh cache: %s. Forcing regeneration.", e.what());
-			bShouldRegenerate = true;
-		}
+		UE_LOG("Loaded triangle mesh from cache: %s", TriMeshKey.ToString().c_str());
 	}
 
 	if (bShouldRegenerate)
@@ -451,10 +386,10 @@ void UStaticMesh::InitTriangleMesh()
 		TriMeshElem.CookedData.SetNum(buf.getSize());
 		memcpy(TriMeshElem.CookedData.GetData(), buf.getData(), buf.getSize());
 
-		FWindowsBinWriter writer(trimeshCachePath);
-		Serialization::WriteArray(writer, TriMeshElem.CookedData);
-		writer.Close();
-		UE_LOG("Saved cooked triangle mesh to cache: %s", trimeshCachePath.c_str());
+		if (FDerivedDataCache::GetInstance().Put(TriMeshKey, [&](FArchive& writer) { Serialization::WriteArray(writer, TriMeshElem.CookedData); }))
+		{
+			UE_LOG("Saved cooked triangle mesh to cache: %s", TriMeshKey.ToString().c_str());
+		}
 
 		gCooking->release();
 		gPhysics->release();
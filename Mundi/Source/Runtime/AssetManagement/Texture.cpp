@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "Texture.h"
 #include "TextureConverter.h"
+#include "DerivedDataCache.h"
 #include "DDSTextureLoader.h"
 #include "WICTextureLoader.h"
 #include <filesystem>
@@ -19,6 +20,30 @@ UTexture::~UTexture()
 	ReleaseResources();
 }
 
+namespace
+{
+#ifdef USE_DDS_CACHE
+	/** 원본을 DDS로 변환해 DDC에 등록하고 로드할 경로를 반환 (실패 시 원본 경로) */
+	FString ConvertToCachedDDS(const FString& InFilePath, const FDerivedDataKey& DDSKey, DXGI_FORMAT TargetFormat)
+	{
+		UE_LOG("[UTexture] Converting texture to DDS: %s", InFilePath.c_str());
+
+		// 임시 파일로 변환한 뒤 DDC에 원자적으로 등록
+		FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+		const FString TempPath = DDC.GetTempPath(DDSKey);
+		FString DDSCachePath;
+		if (FTextureConverter::ConvertToDDS(InFilePath, TempPath, TargetFormat) && DDC.Commit(DDSKey, TempPath, &DDSCachePath))
+		{
+			return DDSCachePath; // DDS 캐시 사용
+		}
+
+		UE_LOG("[UTexture] DDS conversion failed, loading original format: %s", InFilePath.c_str());
+		// 변환 실패 시 원본 포맷으로 로드 (fallback)
+		return InFilePath;
+	}
+#endif
+}
+
 bool UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRGB)
 {
 	assert(InDevice);
@@ -28,6 +53,9 @@ bool UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 
 #ifdef USE_DDS_CACHE
 	// DDS 캐싱 활성화 시: DDS 변환 및 캐시 사용
+	FDerivedDataKey DDSKey;
+	DXGI_FORMAT TargetFormat = DXGI_FORMAT_UNKNOWN;
+	bool bUsingCachedDDS = false;
 	{
 		// 확장자 판별
 		std::filesystem::path SourcePath(InFilePath);
@@ -37,35 +65,25 @@ bool UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 		// DDS가 아닌 경우 → DDS 캐시 확인 및 생성
 		if (Extension != ".dds")
 		{
-			FString DDSCachePath = FTextureConverter::GetDDSCachePath(InFilePath);
+			// 캐시 유효성 검사 (원본 콘텐츠 해시 + 변환 설정으로 만든 DDC 키)
+			TargetFormat = FTextureConverter::GetRecommendedFormat(true, bSRGB); // 알파는 일단 true로 가정
+			DDSKey = FTextureConverter::MakeDDSCacheKey(InFilePath, TargetFormat);
 
-			// 캐시 유효성 검사
-			if (FTextureConverter::ShouldRegenerateDDS(InFilePath, DDSCachePath))
+			FString DDSCachePath;
+			if (FDerivedDataCache::GetInstance().Find(DDSKey, DDSCachePath))
 			{
-				UE_LOG("[UTexture] Converting texture to DDS: %s", InFilePath.c_str());
-
-					// DDS 변환 시도 (bSRGB 파라미터 전달)
-				DXGI_FORMAT TargetFormat = FTextureConverter::GetRecommendedFormat(true, bSRGB); // 알파는 일단 true로 가정
-				if (FTextureConverter::ConvertToDDS(InFilePath, DDSCachePath, TargetFormat))
-				{
-					ActualLoadPath = DDSCachePath; // DDS 캐시 사용
-				}
-				else
-				{
-					UE_LOG("[UTexture] DDS conversion failed, loading original format: %s", InFilePath.c_str());
-					// 변환 실패 시 원본 포맷으로 로드 (fallback)
-				}
+				// 기존 DDS 캐시 사용 (인덱스만 확인했으므로 파일이 없거나 손상됐으면 아래에서 재변환)
+				ActualLoadPath = DDSCachePath;
+				bUsingCachedDDS = true;
+				UE_LOG("[UTexture] Using cached DDS: %s", DDSCachePath.c_str());
 			}
 			else
 			{
-				// 기존 DDS 캐시 사용
-				ActualLoadPath = DDSCachePath;
-				UE_LOG("[UTexture] Using cached DDS: %s", DDSCachePath.c_str());
+				ActualLoadPath = ConvertToCachedDDS(InFilePath, DDSKey, TargetFormat);
 			}
 
 			// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
-			FString NormalizedCachePath = NormalizePath(DDSCachePath);
-			CacheFilePath = NormalizedCachePath;   // 실제 로드된 경로 저장 (DDS 캐시 사용 시 DDS 경로, 정규화됨)
+			CacheFilePath = NormalizePath(ActualLoadPath);   // 실제 로드된 경로 저장 (DDS 캐시 사용 시 DDS 경로, 변환 실패 시 원본 경로)
 		}
 	}
 #else
@@ -73,26 +91,63 @@ bool UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	UE_LOG("[UTexture] Loading original texture (DDS cache disabled): %s", InFilePath.c_str());
 #endif
 
+	HRESULT hr = CreateFromFile(ActualLoadPath, InDevice, bSRGB);
+
+#ifdef USE_DDS_CACHE
+	// 캐시된 DDS가 삭제/손상된 경우: 엔트리를 지우고 한 번만 다시 변환해서 재시도
+	if (FAILED(hr) && bUsingCachedDDS)
+	{
+		UE_LOG("[UTexture] Cached DDS is missing or corrupt, reconverting: %s", ActualLoadPath.c_str());
+		FDerivedDataCache::GetInstance().Remove(DDSKey);
+
+		ActualLoadPath = ConvertToCachedDDS(InFilePath, DDSKey, TargetFormat);
+		CacheFilePath = NormalizePath(ActualLoadPath);
+		hr = CreateFromFile(ActualLoadPath, InDevice, bSRGB);
+	}
+#endif
+
+	if (SUCCEEDED(hr))
+	{
+		if (Texture2D)
+		{
+			D3D11_TEXTURE2D_DESC desc;
+			Texture2D->GetDesc(&desc);
+			Width = desc.Width;
+			Height = desc.Height;
+			Format = desc.Format;
+		}
+	}
+	else
+	{
+		UE_LOG("[UTexture] Failed to load texture: %s (HRESULT: 0x%08X)", ActualLoadPath.c_str(), hr);
+		return false;
+	}
+	
+	return true;
+}
+
+HRESULT UTexture::CreateFromFile(const FString& InLoadPath, ID3D11Device* InDevice, bool bSRGB)
+{
 	// UTF-8 -> UTF-16 (Windows) 안전 변환: 한글/비ASCII 경로 대응
-	int needed = ::MultiByteToWideChar(CP_UTF8, 0, ActualLoadPath.c_str(), -1, nullptr, 0);
+	int needed = ::MultiByteToWideChar(CP_UTF8, 0, InLoadPath.c_str(), -1, nullptr, 0);
 	std::wstring WFilePath;
 	if (needed > 0)
 	{
 		WFilePath.resize(needed - 1);
-		::MultiByteToWideChar(CP_UTF8, 0, ActualLoadPath.c_str(), -1, WFilePath.data(), needed);
+		::MultiByteToWideChar(CP_UTF8, 0, InLoadPath.c_str(), -1, WFilePath.data(), needed);
 	}
 	else
 	{
-		int needA = ::MultiByteToWideChar(CP_ACP, 0, ActualLoadPath.c_str(), -1, nullptr, 0);
+		int needA = ::MultiByteToWideChar(CP_ACP, 0, InLoadPath.c_str(), -1, nullptr, 0);
 		if (needA > 0)
 		{
 			WFilePath.resize(needA - 1);
-			::MultiByteToWideChar(CP_ACP, 0, ActualLoadPath.c_str(), -1, WFilePath.data(), needA);
+			::MultiByteToWideChar(CP_ACP, 0, InLoadPath.c_str(), -1, WFilePath.data(), needA);
 		}
 	}
 
 	// 최종 로드할 파일의 확장자 재확인
-	std::filesystem::path LoadPath(ActualLoadPath);
+	std::filesystem::path LoadPath(InLoadPath);
 	std::wstring ext = LoadPath.has_extension() ? LoadPath.extension().wstring() : L"";
 	for (auto& ch : ext) ch = static_cast<wchar_t>(::towlower(ch));
 
@@ -130,24 +185,7 @@ bool UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 		);
 	}
 
-	if (SUCCEEDED(hr))
-	{
-		if (Texture2D)
-		{
-			D3D11_TEXTURE2D_DESC desc;
-			Texture2D->GetDesc(&desc);
-			Width = desc.Width;
-			Height = desc.Height;
-			Format = desc.Format;
-		}
-	}
-	else
-	{
-		UE_LOG("[UTexture] Failed to load texture: %s (HRESULT: 0x%08X)", ActualLoadPath.c_str(), hr);
-		return false;
-	}
-	
-	return true;
+	return hr;
 }
 
 void UTexture::ReleaseResources()
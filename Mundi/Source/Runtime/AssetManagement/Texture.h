@@ -27,6 +27,9 @@ public:
 	void ReleaseResources();
 
 private:
+	// 경로의 확장자에 따라 DDS/WIC 로더로 텍스처와 SRV 생성
+	HRESULT CreateFromFile(const FString& InLoadPath, ID3D11Device* InDevice, bool bSRGB);
+
 	FString CacheFilePath;  // 캐시된 소스 경로 (예: DerivedDataCache/cube_texture.png.dds)
 
 	ID3D11Texture2D* Texture2D;
@@ -148,32 +148,15 @@ bool FTextureConverter::ConvertToDDS(
 	return true;
 }
 
-bool FTextureConverter::ShouldRegenerateDDS(
-	const FString& SourcePath,
-	const FString& DDSPath)
+FDerivedDataKey FTextureConverter::MakeDDSCacheKey(const FString& SourcePath, DXGI_FORMAT Format)
 {
-	namespace fs = std::filesystem;
-
-	// DDS 캐시 존재 여부 확인
-	fs::path SourceFile(UTF8ToWide(SourcePath));
-	fs::path DDSFile(UTF8ToWide(DDSPath));
-
-	if (!fs::exists(DDSFile))
-	{
-		return true; // 캐시가 없으면 재생성
-	}
-
-	if (!fs::exists(SourceFile))
-	{
-		return false; // 원본이 없으면 기존 캐시 사용
-	}
-
-	// 타임스탬프 비교
-	auto SourceTime = fs::last_write_time(SourceFile);
-	auto DDSTime = fs::last_write_time(DDSFile);
-
-	// 원본이 캐시보다 최신이면 재생성
-	return SourceTime > DDSTime;
+	FDerivedDataKey Key;
+	Key.Bucket = "Texture";
+	Key.Version = DDSCacheVersion;
+	Key.SourceHash = FDerivedDataCache::GetInstance().HashSourceFile(SourcePath);
+	Key.Variant = "F" + std::to_string(static_cast<int32>(Format)) + (bShouldGenerateMipmaps ? "_Mips" : "");
+	Key.Extension = ".dds";
+	return Key;
 }
 
 FString FTextureConverter::GetDDSCachePath(const FString& SourcePath)
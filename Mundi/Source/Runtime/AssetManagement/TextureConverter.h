@@ -9,6 +9,7 @@
 
 #pragma once
 #include "UEContainer.h"
+#include "DerivedDataCache.h"
 #include <d3d11.h>
 #include <filesystem>
 
@@ -33,15 +34,12 @@ public:
 	);
 
 	/**
-	 * @brief DDS 캐시 재생성이 필요한지 확인
+	 * @brief DDS 변환 결과의 DDC 키 (원본 콘텐츠 해시 + 포맷/밉맵 설정)
 	 * @param SourcePath 원본 텍스처 파일 경로
-	 * @param DDSPath 캐시된 DDS 파일 경로
-	 * @return 캐시가 유효하지 않거나 없으면 true
+	 * @param Format 대상 DXGI 포맷
+	 * @return FDerivedDataCache에서 사용할 키 (확장자 .dds)
 	 */
-	static bool ShouldRegenerateDDS(
-		const FString& SourcePath,
-		const FString& DDSPath
-	);
+	static FDerivedDataKey MakeDDSCacheKey(const FString& SourcePath, DXGI_FORMAT Format);
 
 	/**
 	 * @brief 주어진 원본 텍스처에 대한 DDS 캐시 경로 생성
@@ -84,4 +82,7 @@ private:
 
 	// 설정
 	static inline bool bShouldGenerateMipmaps = true;
+
+	// 변환 코드/옵션이 바뀌면 올려서 기존 DDS 캐시를 무효화
+	static constexpr uint32 DDSCacheVersion = 1;
 };
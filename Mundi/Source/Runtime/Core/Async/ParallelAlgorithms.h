@@ -0,0 +1,446 @@
+﻿#pragma once
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include "UEContainer.h"
+#include "TaskSystem.h"
+
+/**
+ * 태스크 시스템 기반 병렬 알고리즘
+ * - ParallelTransform / ParallelReduce : 구간을 묶음으로 나눠 변환/집계
+ * - ParallelRadixSort : 정수/실수 키 LSD 기수 정렬 (8비트 자릿수, 안정 정렬). 키 추출 함수 오버로드 제공
+ * - ParallelSort      : 비교 정렬. 조각별 std::sort 후, 병합 경로(merge path)로 출력을 나눠 병렬 병합
+ * 요소 수가 임계값 이하이거나 워커가 없으면 직렬로 처리합니다.
+ * 정렬용 임시 버퍼는 TArray<T>로 잡으므로 T는 기본 생성과 이동 대입이 가능해야 합니다.
+ */
+namespace ParallelAlgo
+{
+	/** 변환/집계 묶음의 최소 크기 */
+	constexpr int32 DefaultMinBatchSize = 2048;
+	/** 이하면 std::sort */
+	constexpr int32 SortSerialThreshold = 8192;
+	/** 이하면 기수 정렬 대신 비교 정렬 */
+	constexpr int32 RadixCompareThreshold = 128;
+	/** 이하면 기수 정렬을 한 스레드에서 처리 */
+	constexpr int32 RadixSerialThreshold = 32768;
+}
+
+enum class ESortOrder : uint8
+{
+	Ascending,
+	Descending,
+};
+
+/**
+ * 기수 정렬 키 인코딩 - 부호 없는 정수 비교 순서가 원래 키 순서와 같도록 변환
+ * (부호 있는 정수는 부호 비트 반전, 실수는 음수면 전체 반전/양수면 부호 비트만 반전)
+ */
+template<typename KeyType>
+struct TRadixKeyTraits;
+
+template<>
+struct TRadixKeyTraits<uint32>
+{
+	using RadixType = uint32;
+	static RadixType Encode(uint32 Key) { return Key; }
+};
+
+template<>
+struct TRadixKeyTraits<int32>
+{
+	using RadixType = uint32;
+	static RadixType Encode(int32 Key) { return static_cast<uint32>(Key) ^ 0x80000000u; }
+};
+
+template<>
+struct TRadixKeyTraits<float>
+{
+	using RadixType = uint32;
+	static RadixType Encode(float Key)
+	{
+		uint32 Bits;
+		std::memcpy(&Bits, &Key, sizeof(Bits));
+		return Bits ^ ((Bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u);
+	}
+};
+
+template<>
+struct TRadixKeyTraits<uint64>
+{
+	using RadixType = uint64;
+	static RadixType Encode(uint64 Key) { return Key; }
+};
+
+template<>
+struct TRadixKeyTraits<int64>
+{
+	using RadixType = uint64;
+	static RadixType Encode(int64 Key) { return static_cast<uint64>(Key) ^ 0x8000000000000000ull; }
+};
+
+template<>
+struct TRadixKeyTraits<double>
+{
+	using RadixType = uint64;
+	static RadixType Encode(double Key)
+	{
+		uint64 Bits;
+		std::memcpy(&Bits, &Key, sizeof(Bits));
+		return Bits ^ ((Bits & 0x8000000000000000ull) ? 0xFFFFFFFFFFFFFFFFull : 0x8000000000000000ull);
+	}
+};
+
+namespace ParallelAlgo
+{
+	/** NumBlocks 개 블록을 병렬로 (1개면 호출 스레드에서 바로) */
+	template<typename FuncType>
+	void ForEachBlock(int32 NumBlocks, const FuncType& Func)
+	{
+		if (NumBlocks == 1)
+		{
+			Func(0);
+		}
+		else
+		{
+			ParallelFor(NumBlocks, Func);
+		}
+	}
+
+	/** Src -> Dst 이동 (큰 배열은 병렬) */
+	template<typename T>
+	void MoveRange(T* Src, T* Dst, int32 Num)
+	{
+		ParallelForRange(Num, [Src, Dst](int32 Begin, int32 End)
+		{
+			std::move(Src + Begin, Src + End, Dst + Begin);
+		}, DefaultMinBatchSize * 8);
+	}
+
+	/**
+	 * 키/요소 쌍 LSD 기수 정렬 (결과는 원래 버퍼에 남음)
+	 * 블록별 자릿수 히스토그램 -> (자릿수, 블록) 순서의 누적 오프셋 -> 블록별 분배. 블록 순서를 지키므로 안정 정렬입니다.
+	 */
+	template<typename T, typename RadixType>
+	void RadixSortPairs(RadixType* Keys, T* Items, int32 Num)
+	{
+		constexpr int32 NumDigits = 256;
+		constexpr int32 NumPasses = static_cast<int32>(sizeof(RadixType));
+
+		const int32 NumThreads = FTaskSystem::GetNumWorkers() + 1;
+		const int32 NumBlocks = (Num > RadixSerialThreshold && NumThreads > 1)
+			? std::min(NumThreads * 2, Num / (RadixSerialThreshold / 4))
+			: 1;
+		const int32 BlockSize = (Num + NumBlocks - 1) / NumBlocks;
+
+		TArray<RadixType> KeyScratch;
+		KeyScratch.SetNum(Num);
+		TArray<T> ItemScratch;
+		ItemScratch.SetNum(Num);
+		TArray<uint32> Offsets;
+		Offsets.SetNum(NumBlocks * NumDigits);
+
+		RadixType* SrcKeys = Keys;
+		RadixType* DstKeys = KeyScratch.GetData();
+		T* SrcItems = Items;
+		T* DstItems = ItemScratch.GetData();
+
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			const int32 Shift = Pass * 8;
+
+			ForEachBlock(NumBlocks, [&](int32 Block)
+			{
+				uint32* Counts = Offsets.GetData() + Block * NumDigits;
+				std::fill(Counts, Counts + NumDigits, 0u);
+				const int32 End = std::min(Num, (Block + 1) * BlockSize);
+				for (int32 i = Block * BlockSize; i < End; ++i)
+				{
+					++Counts[(SrcKeys[i] >> Shift) & 0xFF];
+				}
+			});
+
+			// 모든 키의 이번 자릿수가 같으면 건너뜀 (작은 값 범위의 상위 자릿수 등)
+			bool bSkipPass = false;
+			uint32 Running = 0;
+			for (int32 Digit = 0; Digit < NumDigits; ++Digit)
+			{
+				const uint32 DigitStart = Running;
+				for (int32 Block = 0; Block < NumBlocks; ++Block)
+				{
+					uint32& Slot = Offsets[Block * NumDigits + Digit];
+					const uint32 Count = Slot;
+					Slot = Running;
+					Running += Count;
+				}
+				if (Running - DigitStart == static_cast<uint32>(Num))
+				{
+					bSkipPass = true;
+					break;
+				}
+			}
+			if (bSkipPass)
+			{
+				continue;
+			}
+
+			ForEachBlock(NumBlocks, [&](int32 Block)
+			{
+				uint32* BlockOffsets = Offsets.GetData() + Block * NumDigits;
+				const int32 End = std::min(Num, (Block + 1) * BlockSize);
+				for (int32 i = Block * BlockSize; i < End; ++i)
+				{
+					const uint32 Dst = BlockOffsets[(SrcKeys[i] >> Shift) & 0xFF]++;
+					DstKeys[Dst] = SrcKeys[i];
+					DstItems[Dst] = std::move(SrcItems[i]);
+				}
+			});
+
+			std::swap(SrcKeys, DstKeys);
+			std::swap(SrcItems, DstItems);
+		}
+
+		if (SrcItems != Items)
+		{
+			MoveRange(SrcItems, Items, Num);
+		}
+	}
+
+	/**
+	 * 병합 경로 분할 - 정렬된 A, B를 합친 결과의 앞 Diagonal 개에 A가 몇 개 들어가는지
+	 * (같은 값은 A가 먼저 -> std::merge와 같은 순서)
+	 */
+	template<typename T, typename PredicateType>
+	int32 MergePathSplit(const T* A, int32 NumA, const T* B, int32 NumB, int32 Diagonal, const PredicateType& Pred)
+	{
+		int32 Low = std::max(0, Diagonal - NumB);
+		int32 High = std::min(Diagonal, NumA);
+		while (Low < High)
+		{
+			const int32 Mid = (Low + High) / 2;
+			// A[Mid] 가 B[Diagonal - Mid - 1] 보다 앞에 와야 하면 A를 더 가져감
+			if (!Pred(B[Diagonal - Mid - 1], A[Mid]))
+			{
+				Low = Mid + 1;
+			}
+			else
+			{
+				High = Mid;
+			}
+		}
+		return Low;
+	}
+}
+
+/** Out[i] = Func(In[i]) */
+template<typename InType, typename OutType, typename FuncType>
+void ParallelTransform(const InType* In, OutType* Out, int32 Num, const FuncType& Func, int32 MinBatchSize = ParallelAlgo::DefaultMinBatchSize)
+{
+	ParallelForRange(Num, [In, Out, &Func](int32 Begin, int32 End)
+	{
+		for (int32 i = Begin; i < End; ++i)
+		{
+			Out[i] = Func(In[i]);
+		}
+	}, MinBatchSize);
+}
+
+/** Out 크기를 In에 맞춘 뒤 변환 */
+template<typename InType, typename InAllocator, typename OutType, typename OutAllocator, typename FuncType>
+void ParallelTransform(const TArray<InType, InAllocator>& In, TArray<OutType, OutAllocator>& Out, const FuncType& Func, int32 MinBatchSize = ParallelAlgo::DefaultMinBatchSize)
+{
+	Out.SetNum(In.Num());
+	ParallelTransform(In.GetData(), Out.GetData(), In.Num(), Func, MinBatchSize);
+}
+
+/**
+ * Reduce(..., Map(0), Map(1), ..., Map(Num-1)) 집계
+ * - 묶음 분할은 스레드 수로만 정해지고 묶음 결과는 순서대로 합치므로, 같은 환경에서는 결과가 항상 같습니다.
+ * - Reduce 는 결합 법칙을 만족해야 합니다. (Identity 는 항등원)
+ */
+template<typename ResultType, typename MapFuncType, typename ReduceFuncType>
+ResultType ParallelReduce(int32 Num, ResultType Identity, const MapFuncType& Map, const ReduceFuncType& Reduce, int32 MinBatchSize = ParallelAlgo::DefaultMinBatchSize)
+{
+	MinBatchSize = std::max(1, MinBatchSize);
+	const int32 NumThreads = FTaskSystem::GetNumWorkers() + 1;
+	const int32 NumChunks = std::max(1, std::min(NumThreads * 4, Num / MinBatchSize));
+
+	if (Num <= 0)
+	{
+		return Identity;
+	}
+	if (NumChunks == 1 || NumThreads == 1)
+	{
+		ResultType Result = Identity;
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Result = Reduce(Result, Map(i));
+		}
+		return Result;
+	}
+
+	TArray<ResultType> Partials;
+	Partials.SetNum(NumChunks);
+	const int32 ChunkSize = (Num + NumChunks - 1) / NumChunks;
+	ParallelFor(NumChunks, [&](int32 Chunk)
+	{
+		ResultType Partial = Identity;
+		const int32 End = std::min(Num, (Chunk + 1) * ChunkSize);
+		for (int32 i = Chunk * ChunkSize; i < End; ++i)
+		{
+			Partial = Reduce(Partial, Map(i));
+		}
+		Partials[Chunk] = Partial;
+	});
+
+	ResultType Result = Identity;
+	for (const ResultType& Partial : Partials)
+	{
+		Result = Reduce(Result, Partial);
+	}
+	return Result;
+}
+
+/** KeyFunc(Item) 이 돌려주는 정수/실수 키로 안정 정렬 (키는 요소마다 한 번만 계산) */
+template<typename T, typename KeyFuncType>
+void ParallelRadixSort(T* Data, int32 Num, const KeyFuncType& KeyFunc, ESortOrder Order = ESortOrder::Ascending)
+{
+	using KeyType = std::decay_t<decltype(KeyFunc(std::declval<const T&>()))>;
+	using RadixType = typename TRadixKeyTraits<KeyType>::RadixType;
+
+	if (Num < 2)
+	{
+		return;
+	}
+
+	// 내림차순은 인코딩한 키를 뒤집어 오름차순으로 정렬
+	const RadixType Flip = Order == ESortOrder::Descending ? static_cast<RadixType>(~RadixType(0)) : RadixType(0);
+
+	if (Num <= ParallelAlgo::RadixCompareThreshold)
+	{
+		std::stable_sort(Data, Data + Num, [&KeyFunc, Flip](const T& A, const T& B)
+		{
+			return (TRadixKeyTraits<KeyType>::Encode(KeyFunc(A)) ^ Flip) < (TRadixKeyTraits<KeyType>::Encode(KeyFunc(B)) ^ Flip);
+		});
+		return;
+	}
+
+	TArray<RadixType> Keys;
+	Keys.SetNum(Num);
+	ParallelTransform(Data, Keys.GetData(), Num, [&KeyFunc, Flip](const T& Item)
+	{
+		return TRadixKeyTraits<KeyType>::Encode(KeyFunc(Item)) ^ Flip;
+	}, ParallelAlgo::DefaultMinBatchSize * 8);
+
+	ParallelAlgo::RadixSortPairs(Keys.GetData(), Data, Num);
+}
+
+/** 키 배열 자체를 정렬 */
+template<typename KeyType>
+void ParallelRadixSort(KeyType* Data, int32 Num, ESortOrder Order = ESortOrder::Ascending)
+{
+	ParallelRadixSort(Data, Num, [](KeyType Key) { return Key; }, Order);
+}
+
+template<typename T, typename Allocator, typename KeyFuncType>
+void ParallelRadixSort(TArray<T, Allocator>& Array, const KeyFuncType& KeyFunc, ESortOrder Order = ESortOrder::Ascending)
+{
+	ParallelRadixSort(Array.GetData(), Array.Num(), KeyFunc, Order);
+}
+
+template<typename KeyType, typename Allocator>
+void ParallelRadixSort(TArray<KeyType, Allocator>& Array, ESortOrder Order = ESortOrder::Ascending)
+{
+	ParallelRadixSort(Array.GetData(), Array.Num(), Order);
+}
+
+/** 비교 정렬 (std::sort 와 같이 안정 정렬은 아님) */
+template<typename T, typename PredicateType>
+void ParallelSort(T* Data, int32 Num, const PredicateType& Pred)
+{
+	const int32 NumThreads = FTaskSystem::GetNumWorkers() + 1;
+	if (Num <= ParallelAlgo::SortSerialThreshold || NumThreads == 1)
+	{
+		std::sort(Data, Data + Num, Pred);
+		return;
+	}
+
+	// 1) 조각 수는 2의 거듭제곱 (스레드 수 이상, 조각당 SortSerialThreshold/4 이상)
+	int32 NumChunks = 1;
+	while (NumChunks < NumThreads && Num / (NumChunks * 2) >= ParallelAlgo::SortSerialThreshold / 4)
+	{
+		NumChunks *= 2;
+	}
+	const int32 ChunkSize = (Num + NumChunks - 1) / NumChunks;
+
+	ParallelFor(NumChunks, [&](int32 Chunk)
+	{
+		const int32 Begin = std::min(Num, Chunk * ChunkSize);
+		const int32 End = std::min(Num, Begin + ChunkSize);
+		std::sort(Data + Begin, Data + End, Pred);
+	});
+
+	// 2) 폭을 두 배씩 늘리며 병합. 병합 하나를 출력 기준 여러 조각으로 나눠 마지막 단계에서도 모든 스레드가 일함
+	TArray<T> Scratch;
+	Scratch.SetNum(Num);
+	T* Src = Data;
+	T* Dst = Scratch.GetData();
+
+	for (int32 Width = ChunkSize; Width < Num; Width *= 2)
+	{
+		const int32 NumMerges = (Num + Width * 2 - 1) / (Width * 2);
+		const int32 PiecesPerMerge = std::max(1, NumThreads * 4 / NumMerges);
+
+		ParallelFor(NumMerges * PiecesPerMerge, [&](int32 Job)
+		{
+			const int32 Merge = Job / PiecesPerMerge;
+			const int32 Piece = Job % PiecesPerMerge;
+
+			const int32 BeginA = Merge * Width * 2;
+			const int32 BeginB = std::min(Num, BeginA + Width);
+			const int32 EndB = std::min(Num, BeginB + Width);
+			const T* A = Src + BeginA;
+			const T* B = Src + BeginB;
+			const int32 NumA = BeginB - BeginA;
+			const int32 NumB = EndB - BeginB;
+
+			const int64 Total = NumA + NumB;
+			const int32 Diagonal0 = static_cast<int32>(Total * Piece / PiecesPerMerge);
+			const int32 Diagonal1 = static_cast<int32>(Total * (Piece + 1) / PiecesPerMerge);
+			const int32 SplitA0 = ParallelAlgo::MergePathSplit(A, NumA, B, NumB, Diagonal0, Pred);
+			const int32 SplitA1 = ParallelAlgo::MergePathSplit(A, NumA, B, NumB, Diagonal1, Pred);
+
+			T* MutableA = Src + BeginA;
+			T* MutableB = Src + BeginB;
+			std::merge(
+				std::make_move_iterator(MutableA + SplitA0), std::make_move_iterator(MutableA + SplitA1),
+				std::make_move_iterator(MutableB + (Diagonal0 - SplitA0)), std::make_move_iterator(MutableB + (Diagonal1 - SplitA1)),
+				Dst + BeginA + Diagonal0, Pred);
+		});
+
+		std::swap(Src, Dst);
+	}
+
+	if (Src != Data)
+	{
+		ParallelAlgo::MoveRange(Src, Data, Num);
+	}
+}
+
+template<typename T>
+void ParallelSort(T* Data, int32 Num)
+{
+	ParallelSort(Data, Num, std::less<T>());
+}
+
+template<typename T, typename Allocator, typename PredicateType>
+void ParallelSort(TArray<T, Allocator>& Array, const PredicateType& Pred)
+{
+	ParallelSort(Array.GetData(), Array.Num(), Pred);
+}
+
+template<typename T, typename Allocator>
+void ParallelSort(TArray<T, Allocator>& Array)
+{
+	ParallelSort(Array.GetData(), Array.Num(), std::less<T>());
+}
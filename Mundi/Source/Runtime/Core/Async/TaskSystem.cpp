@@ -0,0 +1,638 @@
+﻿#include "pch.h"
+#include "TaskSystem.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/**
+ * 태스크 노드
+ * - RefCount: 핸들 수 + 실행 예약분 1 (실행이 끝나면 해제)
+ * - PendingCount: 아직 끝나지 않은 선행 태스크 수 + Launch 보호용 1. 0이 되는 순간 예약합니다.
+ * - 후속 태스크 목록은 완료 전까지만 추가할 수 있고, 완료와 동시에 닫힙니다.
+ */
+struct FTask
+{
+	std::function<void()> Function;
+	std::atomic<int32> RefCount{ 2 };
+	std::atomic<int32> PendingCount{ 1 };
+	std::atomic<bool> bCompleted{ false };
+
+	std::atomic_flag ContinuationLock = ATOMIC_FLAG_INIT;
+	TArray<FTask*, TInlineAllocator<4>> Continuations;
+
+	void AddRef() { RefCount.fetch_add(1, std::memory_order_relaxed); }
+	void Release()
+	{
+		if (RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			delete this;
+		}
+	}
+
+	void LockContinuations()
+	{
+		while (ContinuationLock.test_and_set(std::memory_order_acquire))
+		{
+			std::this_thread::yield();
+		}
+	}
+	void UnlockContinuations() { ContinuationLock.clear(std::memory_order_release); }
+
+	/** 선행 태스크 하나가 끝남 - 마지막이면 예약 */
+	void OnPrerequisiteDone()
+	{
+		if (PendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			FTaskSystem::Schedule(this);
+		}
+	}
+
+	/** 이 태스크가 끝난 뒤 Successor에 알림. 이미 끝났으면 false */
+	bool AddContinuation(FTask* Successor)
+	{
+		LockContinuations();
+		const bool bAdded = !bCompleted.load(std::memory_order_relaxed);
+		if (bAdded)
+		{
+			Continuations.Add(Successor);
+		}
+		UnlockContinuations();
+		return bAdded;
+	}
+
+	void Execute()
+	{
+		if (Function)
+		{
+			Function();
+			Function = nullptr; // 캡처한 자원을 완료 전에 해제
+		}
+
+		LockContinuations();
+		bCompleted.store(true, std::memory_order_release);
+		UnlockContinuations();
+
+		// 목록은 닫혔으므로 잠금 없이 순회
+		for (FTask* Successor : Continuations)
+		{
+			Successor->OnPrerequisiteDone();
+		}
+		Continuations.Empty();
+		Release();
+	}
+};
+
+namespace
+{
+	/**
+	 * Chase-Lev 작업 훔치기 덱
+	 * - Push/Pop 은 소유 워커만, Steal 은 아무 스레드나 호출합니다.
+	 * - 가득 차면 두 배 배열로 옮기고, 이전 배열은 훔치는 쪽이 읽고 있을 수 있어 종료 시까지 보관합니다.
+	 */
+	class FWorkStealingDeque
+	{
+	public:
+		FWorkStealingDeque() : Buffer(new FRing(InitialCapacity)) {}
+
+		~FWorkStealingDeque()
+		{
+			delete Buffer.load(std::memory_order_relaxed);
+			for (FRing* Ring : RetiredBuffers)
+			{
+				delete Ring;
+			}
+		}
+
+		void Push(FTask* Task)
+		{
+			const int64 B = Bottom.load(std::memory_order_relaxed);
+			const int64 T = Top.load(std::memory_order_acquire);
+			FRing* Ring = Buffer.load(std::memory_order_relaxed);
+			if (B - T > Ring->Mask)
+			{
+				Ring = Grow(Ring, B, T);
+			}
+			Ring->Put(B, Task);
+			std::atomic_thread_fence(std::memory_order_release);
+			Bottom.store(B + 1, std::memory_order_relaxed);
+		}
+
+		FTask* Pop()
+		{
+			const int64 B = Bottom.load(std::memory_order_relaxed) - 1;
+			FRing* Ring = Buffer.load(std::memory_order_relaxed);
+			Bottom.store(B, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64 T = Top.load(std::memory_order_relaxed);
+
+			if (T > B)
+			{
+				// 비어 있음
+				Bottom.store(B + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			FTask* Task = Ring->Get(B);
+			if (T == B)
+			{
+				// 마지막 하나 - 훔치는 쪽과 경쟁
+				if (!Top.compare_exchange_strong(T, T + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					Task = nullptr;
+				}
+				Bottom.store(B + 1, std::memory_order_relaxed);
+			}
+			return Task;
+		}
+
+		FTask* Steal()
+		{
+			int64 T = Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64 B = Bottom.load(std::memory_order_acquire);
+			if (T >= B)
+			{
+				return nullptr;
+			}
+
+			FTask* Task = Buffer.load(std::memory_order_acquire)->Get(T);
+			if (!Top.compare_exchange_strong(T, T + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				return nullptr; // 다른 스레드가 먼저 가져감
+			}
+			return Task;
+		}
+
+	private:
+		static constexpr int64 InitialCapacity = 256;
+
+		struct FRing
+		{
+			int64 Mask;
+			std::atomic<FTask*>* Slots;
+
+			explicit FRing(int64 Capacity) : Mask(Capacity - 1), Slots(new std::atomic<FTask*>[Capacity]) {}
+			~FRing() { delete[] Slots; }
+
+			FTask* Get(int64 Index) const { return Slots[Index & Mask].load(std::memory_order_relaxed); }
+			void Put(int64 Index, FTask* Task) { Slots[Index & Mask].store(Task, std::memory_order_relaxed); }
+		};
+
+		FRing* Grow(FRing* Old, int64 B, int64 T)
+		{
+			FRing* New = new FRing((Old->Mask + 1) * 2);
+			for (int64 i = T; i < B; ++i)
+			{
+				New->Put(i, Old->Get(i));
+			}
+			RetiredBuffers.Add(Old);
+			Buffer.store(New, std::memory_order_release);
+			return New;
+		}
+
+		alignas(LockFree::CacheLineSize) std::atomic<int64> Top{ 0 };
+		alignas(LockFree::CacheLineSize) std::atomic<int64> Bottom{ 0 };
+		std::atomic<FRing*> Buffer;
+		TArray<FRing*> RetiredBuffers;
+	};
+
+	struct alignas(LockFree::CacheLineSize) FWorker
+	{
+		FWorkStealingDeque Deque;
+		std::thread Thread;
+		uint32 RandomState = 0;
+	};
+
+	struct FTaskSystemState
+	{
+		TArray<FWorker*> Workers;
+		/** 워커가 아닌 스레드가 넣은 태스크 */
+		TQueue<FTask*, EQueueMode::Mpmc> InjectionQueue{ 8192 };
+
+		/** 큐에 들어가 아직 꺼내지 않은 태스크 수 (워커 재우기 판단용) */
+		std::atomic<int32> NumQueued{ 0 };
+		/** 큐에 있거나 실행 중인 태스크 수 (실행 중에 후속 태스크를 예약할 수 있어 Shutdown은 이것이 0이 될 때까지 비움) */
+		std::atomic<int32> NumPending{ 0 };
+		std::atomic<int32> NumSleeping{ 0 };
+		std::atomic<bool> bRunning{ false };
+		std::atomic<bool> bStopping{ false };
+		std::mutex SleepMutex;
+		std::condition_variable SleepCondition;
+
+		std::atomic<uint64> NumExecuted{ 0 };
+		std::atomic<uint64> NumStolen{ 0 };
+	};
+
+	FTaskSystemState& GetState()
+	{
+		static FTaskSystemState State;
+		return State;
+	}
+
+	thread_local int32 GWorkerIndex = -1;
+
+	void WakeWorker(FTaskSystemState& State)
+	{
+		if (State.NumSleeping.load(std::memory_order_seq_cst) > 0)
+		{
+			// 잠들기 직전의 워커가 조건을 다시 확인하도록 잠금을 한 번 거쳐서 알림
+			{
+				std::lock_guard<std::mutex> Lock(State.SleepMutex);
+			}
+			State.SleepCondition.notify_one();
+		}
+	}
+
+	/** 자기 덱 -> 공용 큐 -> 다른 워커 덱 순서로 태스크 탐색 */
+	FTask* FindTask(FTaskSystemState& State)
+	{
+		const int32 Self = GWorkerIndex;
+		FTask* Task = nullptr;
+
+		if (Self >= 0)
+		{
+			Task = State.Workers[Self]->Deque.Pop();
+		}
+		if (!Task && State.NumQueued.load(std::memory_order_relaxed) > 0)
+		{
+			State.InjectionQueue.Dequeue(Task);
+		}
+		if (!Task)
+		{
+			const int32 NumWorkers = State.Workers.Num();
+			uint32 Start = 0;
+			if (Self >= 0)
+			{
+				// xorshift로 훔칠 대상을 흩뜨려 같은 덱에 몰리지 않게 함
+				uint32& Random = State.Workers[Self]->RandomState;
+				Random ^= Random << 13;
+				Random ^= Random >> 17;
+				Random ^= Random << 5;
+				Start = Random;
+			}
+			for (int32 i = 0; i < NumWorkers && !Task; ++i)
+			{
+				const int32 Victim = static_cast<int32>((Start + i) % NumWorkers);
+				if (Victim != Self)
+				{
+					Task = State.Workers[Victim]->Deque.Steal();
+				}
+			}
+			if (Task)
+			{
+				State.NumStolen.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		if (Task)
+		{
+			State.NumQueued.fetch_sub(1, std::memory_order_relaxed);
+		}
+		return Task;
+	}
+
+	void RunTask(FTaskSystemState& State, FTask* Task)
+	{
+		Task->Execute();
+		State.NumExecuted.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/** 큐에서 꺼낸 태스크 실행 - 실행이 끝난 뒤에 NumPending을 내림 */
+	void RunQueuedTask(FTaskSystemState& State, FTask* Task)
+	{
+		RunTask(State, Task);
+		State.NumPending.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	void WorkerMain(int32 WorkerIndex)
+	{
+		FTaskSystemState& State = GetState();
+		GWorkerIndex = WorkerIndex;
+
+		constexpr int32 SpinCount = 64;
+		int32 IdleSpins = 0;
+
+		while (!State.bStopping.load(std::memory_order_acquire))
+		{
+			if (FTask* Task = FindTask(State))
+			{
+				RunQueuedTask(State, Task);
+				IdleSpins = 0;
+				continue;
+			}
+
+			if (++IdleSpins < SpinCount)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			// 잠들기 전에 NumSleeping 을 올리고 다시 확인 (WakeWorker 와 짝)
+			std::unique_lock<std::mutex> Lock(State.SleepMutex);
+			State.NumSleeping.fetch_add(1, std::memory_order_seq_cst);
+			State.SleepCondition.wait(Lock, [&State]()
+			{
+				return State.NumQueued.load(std::memory_order_seq_cst) > 0 || State.bStopping.load(std::memory_order_acquire);
+			});
+			State.NumSleeping.fetch_sub(1, std::memory_order_relaxed);
+			IdleSpins = 0;
+		}
+
+		GWorkerIndex = -1;
+	}
+}
+
+// ───────────── FTaskHandle ─────────────
+
+FTaskHandle::FTaskHandle(const FTaskHandle& Other) : Task(Other.Task)
+{
+	if (Task)
+	{
+		Task->AddRef();
+	}
+}
+
+FTaskHandle& FTaskHandle::operator=(const FTaskHandle& Other)
+{
+	if (Task != Other.Task)
+	{
+		FTaskHandle Copy(Other);
+		std::swap(Task, Copy.Task);
+	}
+	return *this;
+}
+
+FTaskHandle& FTaskHandle::operator=(FTaskHandle&& Other) noexcept
+{
+	if (this != &Other)
+	{
+		Reset();
+		Task = Other.Task;
+		Other.Task = nullptr;
+	}
+	return *this;
+}
+
+bool FTaskHandle::IsCompleted() const
+{
+	return !Task || Task->bCompleted.load(std::memory_order_acquire);
+}
+
+void FTaskHandle::Wait() const
+{
+	if (Task)
+	{
+		FTaskSystem::WaitFor(Task);
+	}
+}
+
+FTaskHandle FTaskHandle::Then(std::function<void()> Function) const
+{
+	return FTaskSystem::Launch(std::move(Function), this, 1);
+}
+
+void FTaskHandle::Reset()
+{
+	if (Task)
+	{
+		Task->Release();
+		Task = nullptr;
+	}
+}
+
+// ───────────── FTaskSystem ─────────────
+
+void FTaskSystem::Startup(int32 NumWorkers)
+{
+	FTaskSystemState& State = GetState();
+	if (State.bRunning.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	if (NumWorkers <= 0)
+	{
+		NumWorkers = std::max(1, static_cast<int32>(std::thread::hardware_concurrency()) - 1);
+	}
+
+	State.bStopping.store(false, std::memory_order_relaxed);
+	for (int32 i = 0; i < NumWorkers; ++i)
+	{
+		FWorker* Worker = new FWorker();
+		Worker->RandomState = 0x9E3779B9u * static_cast<uint32>(i + 1);
+		State.Workers.Add(Worker);
+	}
+	// 워커 배열이 다 채워진 뒤 스레드 시작 (훔칠 때 배열을 읽음)
+	for (int32 i = 0; i < NumWorkers; ++i)
+	{
+		State.Workers[i]->Thread = std::thread(WorkerMain, i);
+	}
+	State.bRunning.store(true, std::memory_order_release);
+}
+
+void FTaskSystem::Shutdown()
+{
+	FTaskSystemState& State = GetState();
+	if (!State.bRunning.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	// 남은 태스크를 모두 비운 뒤 종료 (호출 스레드도 실행에 참여)
+	// 실행 중인 태스크가 후속 태스크를 예약할 수 있으므로 큐가 아니라 실행 중인 것까지 기다림
+	while (State.NumPending.load(std::memory_order_acquire) > 0)
+	{
+		if (!TryExecuteOneTask())
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(State.SleepMutex);
+		State.bStopping.store(true, std::memory_order_release);
+	}
+	State.SleepCondition.notify_all();
+
+	// 다른 워커가 아직 훔치는 중일 수 있으므로 모두 멈춘 뒤 해제
+	for (FWorker* Worker : State.Workers)
+	{
+		Worker->Thread.join();
+	}
+	for (FWorker* Worker : State.Workers)
+	{
+		delete Worker;
+	}
+	State.Workers.Empty();
+	State.bRunning.store(false, std::memory_order_release);
+}
+
+bool FTaskSystem::IsRunning()
+{
+	return GetState().bRunning.load(std::memory_order_acquire);
+}
+
+int32 FTaskSystem::GetNumWorkers()
+{
+	FTaskSystemState& State = GetState();
+	return State.bRunning.load(std::memory_order_acquire) ? State.Workers.Num() : 0;
+}
+
+int32 FTaskSystem::GetCurrentWorkerIndex()
+{
+	return GWorkerIndex;
+}
+
+FTaskHandle FTaskSystem::Launch(std::function<void()> Function)
+{
+	return Launch(std::move(Function), nullptr, 0);
+}
+
+FTaskHandle FTaskSystem::Launch(std::function<void()> Function, std::initializer_list<FTaskHandle> Prerequisites)
+{
+	return Launch(std::move(Function), Prerequisites.begin(), static_cast<int32>(Prerequisites.size()));
+}
+
+FTaskHandle FTaskSystem::Launch(std::function<void()> Function, const FTaskHandle* Prerequisites, int32 NumPrerequisites)
+{
+	FTask* Task = new FTask();
+	Task->Function = std::move(Function);
+
+	for (int32 i = 0; i < NumPrerequisites; ++i)
+	{
+		FTask* Prerequisite = Prerequisites[i].Task;
+		if (Prerequisite)
+		{
+			// 추가 전에 카운트를 올려야 선행 태스크가 곧바로 끝나도 0으로 떨어지지 않음
+			Task->PendingCount.fetch_add(1, std::memory_order_relaxed);
+			if (!Prerequisite->AddContinuation(Task))
+			{
+				Task->PendingCount.fetch_sub(1, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	FTaskHandle Handle(Task);
+	Task->OnPrerequisiteDone(); // Launch 보호분 해제
+	return Handle;
+}
+
+void FTaskSystem::Schedule(FTask* Task)
+{
+	FTaskSystemState& State = GetState();
+	if (!State.bRunning.load(std::memory_order_acquire))
+	{
+		// 워커 없음 - 바로 실행
+		RunTask(State, Task);
+		return;
+	}
+
+	State.NumPending.fetch_add(1, std::memory_order_acq_rel);
+	State.NumQueued.fetch_add(1, std::memory_order_seq_cst);
+	const int32 Self = GWorkerIndex;
+	if (Self >= 0)
+	{
+		State.Workers[Self]->Deque.Push(Task);
+	}
+	else if (!State.InjectionQueue.Enqueue(Task))
+	{
+		// 공용 큐가 가득 참 - 호출 스레드에서 실행
+		State.NumQueued.fetch_sub(1, std::memory_order_relaxed);
+		RunQueuedTask(State, Task);
+		return;
+	}
+	WakeWorker(State);
+}
+
+bool FTaskSystem::TryExecuteOneTask()
+{
+	FTaskSystemState& State = GetState();
+	if (FTask* Task = FindTask(State))
+	{
+		RunQueuedTask(State, Task);
+		return true;
+	}
+	return false;
+}
+
+void FTaskSystem::WaitFor(const FTask* Task)
+{
+	// 기다리는 동안 대기 중인 태스크를 대신 실행 (게임 스레드가 놀지 않도록)
+	while (!Task->bCompleted.load(std::memory_order_acquire))
+	{
+		if (!TryExecuteOneTask())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FTaskSystem::WaitAll(const FTaskHandle* Handles, int32 NumHandles)
+{
+	for (int32 i = 0; i < NumHandles; ++i)
+	{
+		Handles[i].Wait();
+	}
+}
+
+uint64 FTaskSystem::GetTotalExecutedTasks()
+{
+	return GetState().NumExecuted.load(std::memory_order_relaxed);
+}
+
+uint64 FTaskSystem::GetTotalStolenTasks()
+{
+	return GetState().NumStolen.load(std::memory_order_relaxed);
+}
+
+// ───────────── ParallelFor ─────────────
+
+void ParallelForRange(int32 Num, const std::function<void(int32 Begin, int32 End)>& Body, int32 MinBatchSize)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	MinBatchSize = std::max(1, MinBatchSize);
+	const int32 NumThreads = FTaskSystem::GetNumWorkers() + 1;
+	if (NumThreads == 1 || Num <= MinBatchSize)
+	{
+		Body(0, Num);
+		return;
+	}
+
+	// 스레드당 4묶음 정도로 나눠 불균형을 흡수
+	constexpr int32 BatchesPerThread = 4;
+	const int32 BatchSize = std::max(MinBatchSize, (Num + NumThreads * BatchesPerThread - 1) / (NumThreads * BatchesPerThread));
+	const int32 NumBatches = (Num + BatchSize - 1) / BatchSize;
+
+	std::atomic<int32> NextBatch{ 0 };
+	auto ProcessBatches = [&]()
+	{
+		for (;;)
+		{
+			const int32 Batch = NextBatch.fetch_add(1, std::memory_order_relaxed);
+			if (Batch >= NumBatches)
+			{
+				return;
+			}
+			const int32 Begin = Batch * BatchSize;
+			Body(Begin, std::min(Num, Begin + BatchSize));
+		}
+	};
+
+	// 도우미 태스크는 (묶음 수 - 1)개까지만. 호출 스레드가 나머지를 맡고, 남은 묶음이 없으면 도우미는 바로 끝남
+	const int32 NumHelpers = std::min(NumThreads - 1, NumBatches - 1);
+	TArray<FTaskHandle, TInlineAllocator<16>> Helpers;
+	Helpers.Reserve(NumHelpers);
+	for (int32 i = 0; i < NumHelpers; ++i)
+	{
+		Helpers.Add(FTaskSystem::Launch(ProcessBatches));
+	}
+
+	ProcessBatches();
+
+	// 도우미가 지역 변수를 참조하므로 모두 끝날 때까지 대기
+	FTaskSystem::WaitAll(Helpers.GetData(), Helpers.Num());
+}
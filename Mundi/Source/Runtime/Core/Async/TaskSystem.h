@@ -0,0 +1,100 @@
+﻿#pragma once
+#include <atomic>
+#include <functional>
+#include <initializer_list>
+#include "UEContainer.h"
+
+struct FTask;
+
+/**
+ * 태스크 핸들 (참조 카운트)
+ * - 핸들이 모두 사라져도 예약된 태스크는 끝까지 실행됩니다.
+ * - 기본 생성된 핸들은 비어 있고, 빈 핸들은 항상 완료된 것으로 취급합니다.
+ */
+class FTaskHandle
+{
+public:
+	FTaskHandle() = default;
+	FTaskHandle(const FTaskHandle& Other);
+	FTaskHandle(FTaskHandle&& Other) noexcept : Task(Other.Task) { Other.Task = nullptr; }
+	FTaskHandle& operator=(const FTaskHandle& Other);
+	FTaskHandle& operator=(FTaskHandle&& Other) noexcept;
+	~FTaskHandle() { Reset(); }
+
+	bool IsValid() const { return Task != nullptr; }
+	bool IsCompleted() const;
+
+	/** 완료될 때까지 대기 - 기다리는 동안 호출 스레드도 다른 태스크를 실행합니다 */
+	void Wait() const;
+
+	/** 이 태스크가 끝난 뒤 실행할 후속 태스크 */
+	FTaskHandle Then(std::function<void()> Function) const;
+
+	void Reset();
+
+private:
+	friend class FTaskSystem;
+	explicit FTaskHandle(FTask* InTask) : Task(InTask) {}
+
+	FTask* Task = nullptr;
+};
+
+/**
+ * 엔진 공용 태스크 시스템
+ * - 고정 개수의 워커 스레드가 각자 작업 훔치기(work-stealing) 덱을 가집니다.
+ *   워커는 자기 덱의 아래쪽(LIFO)에서 꺼내고, 일이 없으면 다른 덱의 위쪽(FIFO)을 훔칩니다.
+ * - 워커가 아닌 스레드(게임 스레드 포함)가 만든 태스크는 공용 큐로 들어갑니다.
+ * - 선행 태스크(Prerequisites)가 모두 끝나야 실행되며, 완료 시 후속 태스크를 예약합니다.
+ * - Startup 전(또는 Shutdown 후)에는 Launch 가 태스크를 즉시 호출 스레드에서 실행합니다.
+ */
+class FTaskSystem
+{
+public:
+	/** NumWorkers <= 0 이면 (코어 수 - 1)개(최소 1개), 게임 스레드가 나머지 하나를 맡습니다 */
+	static void Startup(int32 NumWorkers = -1);
+	static void Shutdown();
+
+	static bool IsRunning();
+	static int32 GetNumWorkers();
+	/** 현재 스레드의 워커 번호 (워커가 아니면 -1) */
+	static int32 GetCurrentWorkerIndex();
+
+	static FTaskHandle Launch(std::function<void()> Function);
+	static FTaskHandle Launch(std::function<void()> Function, std::initializer_list<FTaskHandle> Prerequisites);
+	static FTaskHandle Launch(std::function<void()> Function, const FTaskHandle* Prerequisites, int32 NumPrerequisites);
+
+	/** 모든 핸들이 완료될 때까지 대기 (대기 중 다른 태스크 실행) */
+	static void WaitAll(const FTaskHandle* Handles, int32 NumHandles);
+
+	/** 대기 중인 태스크를 하나 실행 - 실행했으면 true */
+	static bool TryExecuteOneTask();
+
+	/** 통계 */
+	static uint64 GetTotalExecutedTasks();
+	static uint64 GetTotalStolenTasks();
+
+private:
+	friend class FTaskHandle;
+	friend struct FTask;
+	static void Schedule(FTask* Task);
+	static void WaitFor(const FTask* Task);
+};
+
+/**
+ * 0 ~ Num-1 구간을 묶음으로 나눠 태스크 시스템에서 병렬 실행 (호출 스레드도 참여, 모두 끝나야 반환)
+ * - MinBatchSize 보다 작은 묶음은 만들지 않으며, 전체가 MinBatchSize 이하면 바로 직렬 실행합니다.
+ * - 묶음 수는 워커 수의 몇 배로 잡아 작업량이 고르지 않아도 먼저 끝난 스레드가 남은 묶음을 가져갑니다.
+ */
+void ParallelForRange(int32 Num, const std::function<void(int32 Begin, int32 End)>& Body, int32 MinBatchSize = 1);
+
+template<typename FuncType>
+void ParallelFor(int32 Num, const FuncType& Body, int32 MinBatchSize = 1)
+{
+	ParallelForRange(Num, [&Body](int32 Begin, int32 End)
+	{
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			Body(Index);
+		}
+	}, MinBatchSize);
+}
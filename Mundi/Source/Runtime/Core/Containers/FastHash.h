@@ -0,0 +1,331 @@
+﻿#pragma once
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+/**
+ * FastHash - 엔진 키용 64비트 해시 (wyhash final4 기반)
+ *
+ * - 16바이트 이하 키(경로 조각, 식별자 등)는 분기 몇 개와 곱셈 2번으로 끝납니다.
+ * - 48바이트 이상은 서로 독립인 3개 레인을 돌려 64x64->128 곱셈의 지연을 겹칩니다.
+ *   (SSE2에는 64비트 곱셈이 없어 벡터화보다 스칼라 레인 병렬이 빠릅니다.)
+ * - 모든 함수는 constexpr 이므로 문자열 리터럴은 컴파일 타임에 해시할 수 있습니다.
+ * - 결과는 x64 리틀 엔디언 기준으로 실행/빌드 간 동일합니다. (디스크 키로 써도 됨)
+ */
+namespace FastHash
+{
+    namespace Detail
+    {
+        inline constexpr uint64 Secret[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+        /** 64x64 -> 128 곱셈. A = 하위, B = 상위 64비트 */
+        constexpr void Mum(uint64& A, uint64& B)
+        {
+            if (!std::is_constant_evaluated())
+            {
+#if defined(_MSC_VER) && defined(_M_X64)
+                A = _umul128(A, B, &B);
+                return;
+#elif defined(__SIZEOF_INT128__)
+                const unsigned __int128 R = static_cast<unsigned __int128>(A) * B;
+                A = static_cast<uint64>(R);
+                B = static_cast<uint64>(R >> 64);
+                return;
+#endif
+            }
+
+            // 컴파일 타임(또는 128비트 곱셈이 없는 플랫폼)용 32비트 분할 곱셈
+            const uint64 ALo = A & 0xffffffffull, AHi = A >> 32;
+            const uint64 BLo = B & 0xffffffffull, BHi = B >> 32;
+            const uint64 LL = ALo * BLo, LH = ALo * BHi, HL = AHi * BLo, HH = AHi * BHi;
+            const uint64 Mid = (LL >> 32) + (LH & 0xffffffffull) + (HL & 0xffffffffull);
+            A = (Mid << 32) | (LL & 0xffffffffull);
+            B = HH + (LH >> 32) + (HL >> 32) + (Mid >> 32);
+        }
+
+        constexpr uint64 Mix(uint64 A, uint64 B)
+        {
+            Mum(A, B);
+            return A ^ B;
+        }
+
+        /** 8바이트 안의 ASCII 대문자만 소문자로 바꿈 (바이트 간 자리올림 없음) */
+        constexpr uint64 FoldLower(uint64 Word)
+        {
+            const uint64 Low7 = Word & 0x7f7f7f7f7f7f7f7full;
+            const uint64 GeA = Low7 + 0x3f3f3f3f3f3f3f3full;    // 'A' 이상이면 최상위 비트 1
+            const uint64 GtZ = Low7 + 0x2525252525252525ull;    // 'Z' 초과면 최상위 비트 1
+            const uint64 Upper = GeA & ~GtZ & ~Word & 0x8080808080808080ull;
+            return Word | (Upper >> 2);
+        }
+
+        template<SIZE_T N, bool bFoldCase>
+        constexpr uint64 Read(const char* P)
+        {
+            uint64 Value = 0;
+            if (std::is_constant_evaluated())
+            {
+                for (SIZE_T i = 0; i < N; ++i)
+                {
+                    Value |= static_cast<uint64>(static_cast<uint8>(P[i])) << (8 * i);
+                }
+            }
+            else
+            {
+                std::memcpy(&Value, P, N);
+            }
+            return bFoldCase ? FoldLower(Value) : Value;
+        }
+
+        /** 1~3바이트: 첫/가운데/끝 바이트를 모음 */
+        template<bool bFoldCase>
+        constexpr uint64 ReadSmall(const char* P, SIZE_T Len)
+        {
+            const uint64 Value = (static_cast<uint64>(static_cast<uint8>(P[0])) << 16)
+                | (static_cast<uint64>(static_cast<uint8>(P[Len >> 1])) << 8)
+                | static_cast<uint64>(static_cast<uint8>(P[Len - 1]));
+            return bFoldCase ? FoldLower(Value) : Value;
+        }
+
+        template<bool bFoldCase>
+        constexpr uint64 HashImpl(const char* P, SIZE_T Len, uint64 Seed)
+        {
+            Seed ^= Mix(Seed ^ Secret[0], Secret[1]);
+
+            uint64 A = 0, B = 0;
+            if (Len <= 16)
+            {
+                if (Len >= 4)
+                {
+                    const SIZE_T Offset = (Len >> 3) << 2;
+                    A = (Read<4, bFoldCase>(P) << 32) | Read<4, bFoldCase>(P + Offset);
+                    B = (Read<4, bFoldCase>(P + Len - 4) << 32) | Read<4, bFoldCase>(P + Len - 4 - Offset);
+                }
+                else if (Len > 0)
+                {
+                    A = ReadSmall<bFoldCase>(P, Len);
+                }
+            }
+            else
+            {
+                SIZE_T Remaining = Len;
+                if (Remaining > 48)
+                {
+                    // 3개 레인이 서로 의존하지 않도록 시드를 따로 굴림
+                    uint64 Seed1 = Seed, Seed2 = Seed;
+                    do
+                    {
+                        Seed = Mix(Read<8, bFoldCase>(P) ^ Secret[1], Read<8, bFoldCase>(P + 8) ^ Seed);
+                        Seed1 = Mix(Read<8, bFoldCase>(P + 16) ^ Secret[2], Read<8, bFoldCase>(P + 24) ^ Seed1);
+                        Seed2 = Mix(Read<8, bFoldCase>(P + 32) ^ Secret[3], Read<8, bFoldCase>(P + 40) ^ Seed2);
+                        P += 48;
+                        Remaining -= 48;
+                    } while (Remaining > 48);
+                    Seed ^= Seed1 ^ Seed2;
+                }
+                while (Remaining > 16)
+                {
+                    Seed = Mix(Read<8, bFoldCase>(P) ^ Secret[1], Read<8, bFoldCase>(P + 8) ^ Seed);
+                    P += 16;
+                    Remaining -= 16;
+                }
+                // 마지막 16바이트는 앞 블록과 겹쳐 읽음 (Len > 16 이므로 범위 안)
+                A = Read<8, bFoldCase>(P + Remaining - 16);
+                B = Read<8, bFoldCase>(P + Remaining - 8);
+            }
+
+            A ^= Secret[1];
+            B ^= Seed;
+            Mum(A, B);
+            return Mix(A ^ Secret[0] ^ Len, B ^ Secret[1]);
+        }
+    }
+
+    /** 바이트열 해시 */
+    constexpr uint64 Hash(std::string_view Str, uint64 Seed = 0)
+    {
+        return Detail::HashImpl<false>(Str.data(), Str.size(), Seed);
+    }
+
+    inline uint64 HashBytes(const void* Data, SIZE_T Size, uint64 Seed = 0)
+    {
+        return Detail::HashImpl<false>(static_cast<const char*>(Data), Size, Seed);
+    }
+
+    /** ASCII 대소문자를 무시한 해시 (ToLower 후 Hash 한 값과 같음) */
+    constexpr uint64 HashIgnoreCase(std::string_view Str, uint64 Seed = 0)
+    {
+        return Detail::HashImpl<true>(Str.data(), Str.size(), Seed);
+    }
+
+    /** 정수/포인터 키 해시 (128비트 곱셈 2번, 입력 1비트가 모든 출력 비트에 퍼짐) */
+    constexpr uint64 HashInt(uint64 Value)
+    {
+        uint64 A = Value ^ Detail::Secret[0];
+        uint64 B = Detail::Secret[1];
+        Detail::Mum(A, B);
+        return Detail::Mix(A ^ Detail::Secret[2], B ^ Detail::Secret[3]);
+    }
+
+    /** 두 64비트 값을 순서를 구분해 조합 */
+    constexpr uint64 HashPair(uint64 A, uint64 B)
+    {
+        return Detail::Mix(Detail::Mix(A ^ Detail::Secret[0], B ^ Detail::Secret[1]) ^ Detail::Secret[2], A ^ Detail::Secret[3]);
+    }
+
+    /** 문자열 리터럴 전용 - 항상 컴파일 타임에 계산 (예: FastHash::HashLiteral("Diffuse")) */
+    template<SIZE_T N>
+    consteval uint64 HashLiteral(const char (&Str)[N])
+    {
+        return Hash(std::string_view(Str, N - 1));
+    }
+}
+
+/**
+ * TStringKey - 해시를 한 번만 계산해 들고 다니는 문자열 키
+ * 같은 키로 여러 번 조회하거나, 맵 재해시가 잦은 곳에서 문자열 재해시를 없앱니다.
+ */
+template<typename StringType = FString>
+class TStringKey
+{
+public:
+    using CharType = typename StringType::value_type;
+
+    TStringKey()
+        : Hash(ComputeHash(Str))
+    {
+    }
+
+    TStringKey(StringType InStr)
+        : Str(std::move(InStr))
+        , Hash(ComputeHash(Str))
+    {
+    }
+
+    TStringKey(const CharType* InStr)
+        : TStringKey(StringType(InStr))
+    {
+    }
+
+    const StringType& GetString() const { return Str; }
+    uint64 GetHash() const { return Hash; }
+
+    bool operator==(const TStringKey& Other) const
+    {
+        return Hash == Other.Hash && Str == Other.Str;
+    }
+
+private:
+    static uint64 ComputeHash(const StringType& InStr)
+    {
+        return FastHash::HashBytes(InStr.data(), InStr.size() * sizeof(CharType));
+    }
+
+    StringType Str;
+    uint64 Hash;
+};
+
+/**
+ * TDefaultHasher - TMap/TSet/TFlatMap/TFlatSet의 기본 해셔
+ * 문자열/정수/포인터/열거형은 FastHash를, 그 외 타입은 std::hash 특수화를 사용합니다.
+ * is_avalanching 태그가 있으면 비트가 이미 고르게 섞였다는 뜻이라 TFlatMap이 추가 믹싱을 생략합니다.
+ */
+template<typename T>
+struct TDefaultHasher : std::hash<T>
+{
+};
+
+template<typename T>
+    requires (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>)
+struct TDefaultHasher<T>
+{
+    using is_avalanching = void;
+
+    size_t operator()(T Value) const noexcept
+    {
+        if constexpr (std::is_pointer_v<T>)
+        {
+            return static_cast<size_t>(FastHash::HashInt(reinterpret_cast<uintptr_t>(Value)));
+        }
+        else
+        {
+            return static_cast<size_t>(FastHash::HashInt(static_cast<uint64>(Value)));
+        }
+    }
+};
+
+/** 정수/포인터 쌍 - 쌍 자체를 키로 저장하고 해시만 HashPair로 (해시가 겹쳐도 키 비교로 구분) */
+template<typename A, typename B>
+    requires ((std::is_integral_v<A> || std::is_pointer_v<A>) && (std::is_integral_v<B> || std::is_pointer_v<B>))
+struct TDefaultHasher<std::pair<A, B>>
+{
+    using is_avalanching = void;
+
+    size_t operator()(const std::pair<A, B>& Pair) const noexcept
+    {
+        return static_cast<size_t>(FastHash::HashPair(ToKey(Pair.first), ToKey(Pair.second)));
+    }
+
+private:
+    template<typename T>
+    static uint64 ToKey(T Value)
+    {
+        if constexpr (std::is_pointer_v<T>)
+        {
+            return static_cast<uint64>(reinterpret_cast<uintptr_t>(Value));
+        }
+        else
+        {
+            return static_cast<uint64>(Value);
+        }
+    }
+};
+
+template<typename CharType, typename Traits, typename Alloc>
+struct TDefaultHasher<std::basic_string<CharType, Traits, Alloc>>
+{
+    using is_avalanching = void;
+
+    size_t operator()(const std::basic_string<CharType, Traits, Alloc>& Str) const noexcept
+    {
+        return static_cast<size_t>(FastHash::HashBytes(Str.data(), Str.size() * sizeof(CharType)));
+    }
+};
+
+template<typename CharType, typename Traits>
+struct TDefaultHasher<std::basic_string_view<CharType, Traits>>
+{
+    using is_avalanching = void;
+
+    size_t operator()(std::basic_string_view<CharType, Traits> Str) const noexcept
+    {
+        return static_cast<size_t>(FastHash::HashBytes(Str.data(), Str.size() * sizeof(CharType)));
+    }
+};
+
+template<typename StringType>
+struct TDefaultHasher<TStringKey<StringType>>
+{
+    using is_avalanching = void;
+
+    size_t operator()(const TStringKey<StringType>& Key) const noexcept
+    {
+        return static_cast<size_t>(Key.GetHash());
+    }
+};
+
+namespace std
+{
+    template<typename StringType>
+    struct hash<TStringKey<StringType>>
+    {
+        size_t operator()(const TStringKey<StringType>& Key) const noexcept
+        {
+            return static_cast<size_t>(Key.GetHash());
+        }
+    };
+}
@@ -0,0 +1,926 @@
+﻿#pragma once
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <initializer_list>
+#include <stdexcept>
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define FLAT_HASH_USE_SSE2 1
+#else
+#define FLAT_HASH_USE_SSE2 0
+#endif
+#include "UEContainer.h"
+
+/**
+ * TFlatMap / TFlatSet - 오픈 어드레싱 해시 컨테이너 (SwissTable 방식)
+ *
+ * - 키/값은 하나의 연속된 슬롯 배열에 저장되므로 요소당 힙 노드가 없습니다.
+ * - 슬롯마다 1바이트 컨트롤 바이트(해시 하위 7비트 또는 Empty/Deleted)를 두고,
+ *   16개씩 SSE2로 한 번에 비교해 후보 슬롯만 키 비교합니다.
+ * - 삽입/재해시 시 요소가 이동하므로 요소의 주소/반복자는 유지되지 않습니다.
+ *   (삭제는 톰스톤만 남기므로 순회 중 erase(iterator)는 안전합니다.)
+ *
+ * TMap/TSet과 같은 Add/Find/FindRef/Remove/Contains API와 자주 쓰이는
+ * std::unordered_map 부분집합(find/end/insert/erase/operator[] 등)을 제공합니다.
+ */
+namespace FlatHash
+{
+    using ctrl_t = int8_t;
+
+    /** 컨트롤 바이트 값. 0~127 은 사용 중인 슬롯의 H2(해시 하위 7비트) */
+    enum : ctrl_t
+    {
+        Empty = -128,   // 0b10000000
+        Deleted = -2,   // 0b11111110
+    };
+
+    constexpr SIZE_T GroupWidth = 16;
+
+    /** 16바이트 그룹에서 조건에 맞는 슬롯을 비트마스크로 반환 */
+    struct FGroup
+    {
+        explicit FGroup(const ctrl_t* Pos)
+        {
+#if FLAT_HASH_USE_SSE2
+            Ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Pos));
+#else
+            std::memcpy(Ctrl, Pos, GroupWidth);
+#endif
+        }
+
+        uint32 Match(ctrl_t H2) const
+        {
+#if FLAT_HASH_USE_SSE2
+            return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(H2), Ctrl)));
+#else
+            uint32 Mask = 0;
+            for (SIZE_T i = 0; i < GroupWidth; ++i)
+            {
+                Mask |= (Ctrl[i] == H2 ? 1u : 0u) << i;
+            }
+            return Mask;
+#endif
+        }
+
+        uint32 MatchEmpty() const
+        {
+            return Match(Empty);
+        }
+
+        /** Empty 또는 Deleted (최상위 비트가 1인 바이트) */
+        uint32 MatchEmptyOrDeleted() const
+        {
+#if FLAT_HASH_USE_SSE2
+            return static_cast<uint32>(_mm_movemask_epi8(Ctrl));
+#else
+            uint32 Mask = 0;
+            for (SIZE_T i = 0; i < GroupWidth; ++i)
+            {
+                Mask |= (Ctrl[i] < 0 ? 1u : 0u) << i;
+            }
+            return Mask;
+#endif
+        }
+
+#if FLAT_HASH_USE_SSE2
+        __m128i Ctrl;
+#else
+        ctrl_t Ctrl[GroupWidth];
+#endif
+    };
+
+    inline uint32 CountTrailingZeros(uint32 Mask)
+    {
+#if defined(_MSC_VER)
+        unsigned long Index;
+        _BitScanForward(&Index, Mask);
+        return static_cast<uint32>(Index);
+#else
+        return static_cast<uint32>(__builtin_ctz(Mask));
+#endif
+    }
+
+    /** 사용자 해시의 분포가 나빠도(포인터, 정수 항등 해시 등) 상/하위 비트가 고르게 섞이도록 보정 */
+    inline uint64 MixHash(uint64 H)
+    {
+        H ^= H >> 33;
+        H *= 0xff51afd7ed558ccdULL;
+        H ^= H >> 33;
+        return H;
+    }
+
+    /** 크기 0 테이블이 가리키는 공용 컨트롤 그룹 (할당 없이 find/begin 가능) */
+    inline const ctrl_t* EmptyGroup()
+    {
+        alignas(16) static const ctrl_t Group[GroupWidth] = {
+            Empty, Empty, Empty, Empty, Empty, Empty, Empty, Empty,
+            Empty, Empty, Empty, Empty, Empty, Empty, Empty, Empty };
+        return Group;
+    }
+
+    template<typename K, typename V>
+    struct TMapPolicy
+    {
+        using SlotType = std::pair<K, V>;
+        static const K& GetKey(const SlotType& Slot) { return Slot.first; }
+    };
+
+    template<typename K>
+    struct TSetPolicy
+    {
+        using SlotType = K;
+        static const K& GetKey(const SlotType& Slot) { return Slot; }
+    };
+
+    /** TFlatMap / TFlatSet 공용 테이블 구현 */
+    template<typename KeyType, typename Policy, typename Hasher, typename KeyEqual>
+    class TFlatHashTable
+    {
+    public:
+        using key_type = KeyType;
+        using value_type = typename Policy::SlotType;
+        using size_type = SIZE_T;
+        using hasher = Hasher;
+        using key_equal = KeyEqual;
+
+        template<bool bConst>
+        class TIterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename Policy::SlotType;
+            using difference_type = ptrdiff_t;
+            using pointer = std::conditional_t<bConst, const value_type*, value_type*>;
+            using reference = std::conditional_t<bConst, const value_type&, value_type&>;
+
+            TIterator() = default;
+            TIterator(const ctrl_t* InCtrl, const ctrl_t* InEnd, pointer InSlot)
+                : Ctrl(InCtrl), End(InEnd), Slot(InSlot)
+            {
+                SkipEmpty();
+            }
+
+            /** iterator -> const_iterator 변환 */
+            template<bool bOtherConst, typename = std::enable_if_t<bConst && !bOtherConst>>
+            TIterator(const TIterator<bOtherConst>& Other)
+                : Ctrl(Other.Ctrl), End(Other.End), Slot(Other.Slot) {}
+
+            reference operator*() const { return *Slot; }
+            pointer operator->() const { return Slot; }
+
+            TIterator& operator++()
+            {
+                ++Ctrl;
+                ++Slot;
+                SkipEmpty();
+                return *this;
+            }
+
+            TIterator operator++(int)
+            {
+                TIterator Tmp = *this;
+                ++(*this);
+                return Tmp;
+            }
+
+            bool operator==(const TIterator& Other) const { return Ctrl == Other.Ctrl; }
+            bool operator!=(const TIterator& Other) const { return Ctrl != Other.Ctrl; }
+
+        private:
+            template<bool> friend class TIterator;
+            friend class TFlatHashTable;
+
+            void SkipEmpty()
+            {
+                while (Ctrl != End && *Ctrl < 0)
+                {
+                    ++Ctrl;
+                    ++Slot;
+                }
+            }
+
+            const ctrl_t* Ctrl = nullptr;
+            const ctrl_t* End = nullptr;
+            pointer Slot = nullptr;
+        };
+
+        using iterator = TIterator<false>;
+        using const_iterator = TIterator<true>;
+
+        TFlatHashTable() = default;
+
+        TFlatHashTable(const TFlatHashTable& Other)
+        {
+            CopyFrom(Other);
+        }
+
+        TFlatHashTable(TFlatHashTable&& Other) noexcept
+        {
+            StealFrom(Other);
+        }
+
+        ~TFlatHashTable()
+        {
+            DestroyAndFree();
+        }
+
+        TFlatHashTable& operator=(const TFlatHashTable& Other)
+        {
+            if (this != &Other)
+            {
+                DestroyAndFree();
+                CopyFrom(Other);
+            }
+            return *this;
+        }
+
+        TFlatHashTable& operator=(TFlatHashTable&& Other) noexcept
+        {
+            if (this != &Other)
+            {
+                DestroyAndFree();
+                StealFrom(Other);
+            }
+            return *this;
+        }
+
+        /** 반복자 */
+        iterator begin() { return iterator(Ctrl, Ctrl + Capacity, Slots); }
+        iterator end() { return iterator(Ctrl + Capacity, Ctrl + Capacity, Slots + Capacity); }
+        const_iterator begin() const { return const_iterator(Ctrl, Ctrl + Capacity, Slots); }
+        const_iterator end() const { return const_iterator(Ctrl + Capacity, Ctrl + Capacity, Slots + Capacity); }
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+
+        /** 크기 관련 */
+        size_type size() const { return Size; }
+        bool empty() const { return Size == 0; }
+        size_type capacity() const { return Capacity; }
+
+        /** 모든 요소 제거 (버킷 메모리는 유지하여 매 프레임 재사용 가능) */
+        void clear()
+        {
+            if (Capacity == 0)
+            {
+                return;
+            }
+            if constexpr (!std::is_trivially_destructible_v<value_type>)
+            {
+                for (size_type i = 0; i < Capacity; ++i)
+                {
+                    if (Ctrl[i] >= 0)
+                    {
+                        Slots[i].~value_type();
+                    }
+                }
+            }
+            std::memset(Ctrl, Empty, Capacity + GroupWidth);
+            Size = 0;
+            GrowthLeft = MaxLoad(Capacity);
+        }
+
+        /** 최소 Count개의 요소를 재해시 없이 담을 수 있도록 확보 */
+        void reserve(size_type Count)
+        {
+            if (Count > MaxLoad(Capacity))
+            {
+                Resize(CapacityForCount(Count));
+            }
+        }
+
+        iterator find(const KeyType& Key)
+        {
+            const size_type Index = FindIndex(Key);
+            return Index == NotFound ? end() : IteratorAt(Index);
+        }
+
+        const_iterator find(const KeyType& Key) const
+        {
+            const size_type Index = FindIndex(Key);
+            return Index == NotFound ? end() : const_iterator(Ctrl + Index, Ctrl + Capacity, Slots + Index);
+        }
+
+        size_type count(const KeyType& Key) const
+        {
+            return FindIndex(Key) == NotFound ? 0 : 1;
+        }
+
+        bool contains(const KeyType& Key) const
+        {
+            return FindIndex(Key) != NotFound;
+        }
+
+        size_type erase(const KeyType& Key)
+        {
+            const size_type Index = FindIndex(Key);
+            if (Index == NotFound)
+            {
+                return 0;
+            }
+            EraseAt(Index);
+            return 1;
+        }
+
+        /** 삭제 후 다음 요소를 가리키는 반복자를 반환 (다른 요소는 이동하지 않음) */
+        iterator erase(const_iterator It)
+        {
+            const size_type Index = static_cast<size_type>(It.Ctrl - Ctrl);
+            EraseAt(Index);
+            return IteratorAt(Index + 1);
+        }
+
+        iterator erase(iterator It)
+        {
+            return erase(const_iterator(It));
+        }
+
+        void swap(TFlatHashTable& Other) noexcept
+        {
+            std::swap(Ctrl, Other.Ctrl);
+            std::swap(Slots, Other.Slots);
+            std::swap(Capacity, Other.Capacity);
+            std::swap(Size, Other.Size);
+            std::swap(GrowthLeft, Other.GrowthLeft);
+        }
+
+    protected:
+        static constexpr size_type NotFound = static_cast<size_type>(-1);
+
+        iterator IteratorAt(size_type Index)
+        {
+            return iterator(Ctrl + Index, Ctrl + Capacity, Slots + Index);
+        }
+
+        static uint64 HashOf(const KeyType& Key)
+        {
+            if constexpr (requires { typename Hasher::is_avalanching; })
+            {
+                return static_cast<uint64>(Hasher{}(Key));
+            }
+            else
+            {
+                return MixHash(static_cast<uint64>(Hasher{}(Key)));
+            }
+        }
+
+        static ctrl_t H2(uint64 Hash) { return static_cast<ctrl_t>(Hash & 0x7F); }
+        static size_type H1(uint64 Hash) { return static_cast<size_type>(Hash >> 7); }
+
+        /** 최대 부하율 7/8 */
+        static size_type MaxLoad(size_type InCapacity)
+        {
+            return InCapacity - InCapacity / 8;
+        }
+
+        static size_type CapacityForCount(size_type Count)
+        {
+            size_type NewCapacity = GroupWidth;
+            while (MaxLoad(NewCapacity) < Count)
+            {
+                NewCapacity *= 2;
+            }
+            return NewCapacity;
+        }
+
+        size_type FindIndex(const KeyType& Key) const
+        {
+            if (Size == 0)
+            {
+                return NotFound;
+            }
+
+            const uint64 Hash = HashOf(Key);
+            const ctrl_t Tag = H2(Hash);
+            const size_type Mask = Capacity - 1;
+            size_type Pos = H1(Hash) & Mask;
+            size_type Step = 0;
+
+            while (true)
+            {
+                FGroup Group(Ctrl + Pos);
+                for (uint32 Bits = Group.Match(Tag); Bits != 0; Bits &= Bits - 1)
+                {
+                    const size_type Index = (Pos + CountTrailingZeros(Bits)) & Mask;
+                    if (KeyEqual{}(Policy::GetKey(Slots[Index]), Key))
+                    {
+                        return Index;
+                    }
+                }
+                if (Group.MatchEmpty() != 0)
+                {
+                    return NotFound;
+                }
+                // 그룹 단위 삼각수 프로빙: 2의 거듭제곱 용량에서 모든 그룹을 방문
+                Step += GroupWidth;
+                Pos = (Pos + Step) & Mask;
+            }
+        }
+
+        /** 키가 없음을 확인한 뒤 삽입할 빈 슬롯 위치를 찾음 */
+        size_type FindInsertSlot(uint64 Hash) const
+        {
+            const size_type Mask = Capacity - 1;
+            size_type Pos = H1(Hash) & Mask;
+            size_type Step = 0;
+
+            while (true)
+            {
+                FGroup Group(Ctrl + Pos);
+                const uint32 Bits = Group.MatchEmptyOrDeleted();
+                if (Bits != 0)
+                {
+                    return (Pos + CountTrailingZeros(Bits)) & Mask;
+                }
+                Step += GroupWidth;
+                Pos = (Pos + Step) & Mask;
+            }
+        }
+
+        /** 앞쪽 GroupWidth개 바이트는 테이블 끝에 복제해 두어 경계를 넘는 그룹 로드를 처리 */
+        void SetCtrl(size_type Index, ctrl_t Value)
+        {
+            Ctrl[Index] = Value;
+            if (Index < GroupWidth)
+            {
+                Ctrl[Capacity + Index] = Value;
+            }
+        }
+
+        /**
+         * 키를 찾고, 없으면 Construct(void* Slot)로 새 슬롯을 생성합니다.
+         * 반환값: {슬롯 인덱스, 새로 삽입되었는지}
+         */
+        template<typename ConstructFn>
+        std::pair<size_type, bool> FindOrInsert(const KeyType& Key, ConstructFn&& Construct)
+        {
+            const size_type Existing = FindIndex(Key);
+            if (Existing != NotFound)
+            {
+                return { Existing, false };
+            }
+
+            const uint64 Hash = HashOf(Key);
+            if (GrowthLeft == 0)
+            {
+                // 톰스톤이 많으면 같은 크기로 재해시, 아니면 두 배로 확장
+                Resize(Capacity == 0 ? GroupWidth : (Size * 2 <= MaxLoad(Capacity) ? Capacity : Capacity * 2));
+            }
+
+            const size_type Index = FindInsertSlot(Hash);
+            Construct(static_cast<void*>(Slots + Index));
+            if (Ctrl[Index] == Empty)
+            {
+                --GrowthLeft;
+            }
+            SetCtrl(Index, H2(Hash));
+            ++Size;
+            return { Index, true };
+        }
+
+        void EraseAt(size_type Index)
+        {
+            Slots[Index].~value_type();
+            --Size;
+
+            // 이 슬롯을 포함하는 어떤 그룹도 가득 차 있지 않았다면 프로빙 체인이 여기서
+            // 끊길 일이 없으므로 바로 Empty로 되돌려 톰스톤 누적을 줄입니다.
+            const size_type Mask = Capacity - 1;
+            const size_type IndexBefore = (Index - GroupWidth) & Mask;
+            const uint32 EmptyAfter = FGroup(Ctrl + Index).MatchEmpty();
+            const uint32 EmptyBefore = FGroup(Ctrl + IndexBefore).MatchEmpty();
+            const bool bWasNeverFull = EmptyBefore && EmptyAfter &&
+                (CountTrailingZeros(EmptyAfter) + LeadingZeros16(EmptyBefore)) < GroupWidth;
+
+            if (bWasNeverFull)
+            {
+                SetCtrl(Index, Empty);
+                ++GrowthLeft;
+            }
+            else
+            {
+                SetCtrl(Index, Deleted);
+            }
+        }
+
+        static uint32 LeadingZeros16(uint32 Mask)
+        {
+            uint32 Count = 0;
+            for (uint32 Bit = 1u << (GroupWidth - 1); Bit != 0 && (Mask & Bit) == 0; Bit >>= 1)
+            {
+                ++Count;
+            }
+            return Count;
+        }
+
+        void Resize(size_type NewCapacity)
+        {
+            ctrl_t* OldCtrl = Ctrl;
+            value_type* OldSlots = Slots;
+            const size_type OldCapacity = Capacity;
+
+            Allocate(NewCapacity);
+
+            if (OldCapacity > 0)
+            {
+                for (size_type i = 0; i < OldCapacity; ++i)
+                {
+                    if (OldCtrl[i] >= 0)
+                    {
+                        const uint64 Hash = HashOf(Policy::GetKey(OldSlots[i]));
+                        const size_type Index = FindInsertSlot(Hash);
+                        ::new (static_cast<void*>(Slots + Index)) value_type(std::move(OldSlots[i]));
+                        OldSlots[i].~value_type();
+                        SetCtrl(Index, H2(Hash));
+                    }
+                }
+                GrowthLeft -= Size;
+                FreeStorage(OldCtrl, OldSlots);
+            }
+        }
+
+        /** 빈 테이블을 NewCapacity 크기로 할당 (Size는 유지) */
+        void Allocate(size_type NewCapacity)
+        {
+            Ctrl = new ctrl_t[NewCapacity + GroupWidth];
+            std::memset(Ctrl, Empty, NewCapacity + GroupWidth);
+            Slots = static_cast<value_type*>(::operator new(sizeof(value_type) * NewCapacity, std::align_val_t(alignof(value_type))));
+            Capacity = NewCapacity;
+            GrowthLeft = MaxLoad(NewCapacity);
+        }
+
+        static void FreeStorage(ctrl_t* InCtrl, value_type* InSlots)
+        {
+            delete[] InCtrl;
+            ::operator delete(static_cast<void*>(InSlots), std::align_val_t(alignof(value_type)));
+        }
+
+        void DestroyAndFree()
+        {
+            if (Capacity == 0)
+            {
+                return;
+            }
+            clear();
+            FreeStorage(Ctrl, Slots);
+            ResetToEmpty();
+        }
+
+        void ResetToEmpty()
+        {
+            Ctrl = const_cast<ctrl_t*>(EmptyGroup());
+            Slots = nullptr;
+            Capacity = 0;
+            Size = 0;
+            GrowthLeft = 0;
+        }
+
+        void CopyFrom(const TFlatHashTable& Other)
+        {
+            if (Other.Size == 0)
+            {
+                return;
+            }
+            Allocate(CapacityForCount(Other.Size));
+            for (size_type i = 0; i < Other.Capacity; ++i)
+            {
+                if (Other.Ctrl[i] >= 0)
+                {
+                    const uint64 Hash = HashOf(Policy::GetKey(Other.Slots[i]));
+                    const size_type Index = FindInsertSlot(Hash);
+                    ::new (static_cast<void*>(Slots + Index)) value_type(Other.Slots[i]);
+                    SetCtrl(Index, H2(Hash));
+                }
+            }
+            Size = Other.Size;
+            GrowthLeft -= Size;
+        }
+
+        void StealFrom(TFlatHashTable& Other)
+        {
+            Ctrl = Other.Ctrl;
+            Slots = Other.Slots;
+            Capacity = Other.Capacity;
+            Size = Other.Size;
+            GrowthLeft = Other.GrowthLeft;
+            Other.ResetToEmpty();
+        }
+
+        ctrl_t* Ctrl = const_cast<ctrl_t*>(EmptyGroup());
+        value_type* Slots = nullptr;
+        size_type Capacity = 0;
+        size_type Size = 0;
+        size_type GrowthLeft = 0;
+    };
+}
+
+/** TFlatMap - 오픈 어드레싱 해시 맵 (TMap과 동일한 API) */
+template<typename KeyType, typename ValueType, typename Hasher = TDefaultHasher<KeyType>, typename KeyEqual = std::equal_to<KeyType>>
+class TFlatMap : public FlatHash::TFlatHashTable<KeyType, FlatHash::TMapPolicy<KeyType, ValueType>, Hasher, KeyEqual>
+{
+    using Super = FlatHash::TFlatHashTable<KeyType, FlatHash::TMapPolicy<KeyType, ValueType>, Hasher, KeyEqual>;
+
+public:
+    using mapped_type = ValueType;
+    using typename Super::value_type;
+    using typename Super::size_type;
+    using typename Super::iterator;
+    using typename Super::const_iterator;
+
+    TFlatMap() = default;
+
+    TFlatMap(std::initializer_list<value_type> InitList)
+    {
+        this->reserve(InitList.size());
+        for (const value_type& Pair : InitList)
+        {
+            insert(Pair);
+        }
+    }
+
+    /** std::unordered_map 호환 */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const KeyType& Key, Args&&... args)
+    {
+        auto [Index, bInserted] = this->FindOrInsert(Key, [&](void* Slot)
+        {
+            ::new (Slot) value_type(std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple(std::forward<Args>(args)...));
+        });
+        return { this->IteratorAt(Index), bInserted };
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(const KeyType& Key, Args&&... args)
+    {
+        return try_emplace(Key, std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& Pair)
+    {
+        return try_emplace(Pair.first, Pair.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& Pair)
+    {
+        return try_emplace(Pair.first, std::move(Pair.second));
+    }
+
+    template<typename V>
+    std::pair<iterator, bool> insert_or_assign(const KeyType& Key, V&& Value)
+    {
+        auto Result = try_emplace(Key, std::forward<V>(Value));
+        if (!Result.second)
+        {
+            Result.first->second = std::forward<V>(Value);
+        }
+        return Result;
+    }
+
+    ValueType& operator[](const KeyType& Key)
+    {
+        return try_emplace(Key).first->second;
+    }
+
+    ValueType& at(const KeyType& Key)
+    {
+        ValueType* Value = Find(Key);
+        if (!Value)
+        {
+            throw std::out_of_range("TFlatMap::at");
+        }
+        return *Value;
+    }
+
+    const ValueType& at(const KeyType& Key) const
+    {
+        const ValueType* Value = Find(Key);
+        if (!Value)
+        {
+            throw std::out_of_range("TFlatMap::at");
+        }
+        return *Value;
+    }
+
+    /** 요소 추가/수정 */
+    void Add(const KeyType& Key, const ValueType& Value)
+    {
+        insert_or_assign(Key, Value);
+    }
+
+    template<typename... Args>
+    void Emplace(const KeyType& Key, Args&&... args)
+    {
+        try_emplace(Key, std::forward<Args>(args)...);
+    }
+
+    /** 찾거나 기본값으로 추가 */
+    ValueType& FindOrAdd(const KeyType& Key)
+    {
+        return (*this)[Key];
+    }
+
+    /** 제거 */
+    bool Remove(const KeyType& Key)
+    {
+        return this->erase(Key) > 0;
+    }
+
+    /** 크기 관련 */
+    int32 Num() const
+    {
+        return static_cast<int32>(this->size());
+    }
+
+    bool IsEmpty() const
+    {
+        return this->empty();
+    }
+
+    void Empty()
+    {
+        this->clear();
+    }
+
+    void Reserve(int64 Count)
+    {
+        this->reserve(static_cast<size_type>(Count));
+    }
+
+    /** 검색 */
+    bool Contains(const KeyType& Key) const
+    {
+        return this->contains(Key);
+    }
+
+    ValueType* Find(const KeyType& Key)
+    {
+        const size_type Index = this->FindIndex(Key);
+        return Index != Super::NotFound ? &this->Slots[Index].second : nullptr;
+    }
+
+    const ValueType* Find(const KeyType& Key) const
+    {
+        const size_type Index = this->FindIndex(Key);
+        return Index != Super::NotFound ? &this->Slots[Index].second : nullptr;
+    }
+
+    /** 찾거나 기본값 반환 */
+    ValueType FindRef(const KeyType& Key) const
+    {
+        const ValueType* Value = Find(Key);
+        return Value ? *Value : ValueType{};
+    }
+
+    /** 키/값 배열 반환 */
+    TArray<KeyType> GetKeys() const
+    {
+        TArray<KeyType> Keys;
+        Keys.Reserve(this->size());
+        for (const auto& Pair : *this)
+        {
+            Keys.Add(Pair.first);
+        }
+        return Keys;
+    }
+
+    TArray<ValueType> GetValues() const
+    {
+        TArray<ValueType> Values;
+        Values.Reserve(this->size());
+        for (const auto& Pair : *this)
+        {
+            Values.Add(Pair.second);
+        }
+        return Values;
+    }
+};
+
+/** TFlatSet - 오픈 어드레싱 해시 집합 (TSet과 동일한 API) */
+template<typename T, typename Hasher = TDefaultHasher<T>, typename KeyEqual = std::equal_to<T>>
+class TFlatSet : public FlatHash::TFlatHashTable<T, FlatHash::TSetPolicy<T>, Hasher, KeyEqual>
+{
+    using Super = FlatHash::TFlatHashTable<T, FlatHash::TSetPolicy<T>, Hasher, KeyEqual>;
+
+public:
+    using typename Super::value_type;
+    using typename Super::size_type;
+    using typename Super::iterator;
+    using typename Super::const_iterator;
+
+    TFlatSet() = default;
+
+    TFlatSet(std::initializer_list<T> InitList)
+    {
+        this->reserve(InitList.size());
+        for (const T& Item : InitList)
+        {
+            insert(Item);
+        }
+    }
+
+    /** std::unordered_set 호환 */
+    std::pair<iterator, bool> insert(const T& Item)
+    {
+        auto [Index, bInserted] = this->FindOrInsert(Item, [&](void* Slot) { ::new (Slot) T(Item); });
+        return { this->IteratorAt(Index), bInserted };
+    }
+
+    std::pair<iterator, bool> insert(T&& Item)
+    {
+        auto [Index, bInserted] = this->FindOrInsert(Item, [&](void* Slot) { ::new (Slot) T(std::move(Item)); });
+        return { this->IteratorAt(Index), bInserted };
+    }
+
+    std::pair<iterator, bool> emplace(const T& Item)
+    {
+        return insert(Item);
+    }
+
+    /** 요소 추가 */
+    void Add(const T& Item)
+    {
+        insert(Item);
+    }
+
+    /** 제거 */
+    bool Remove(const T& Item)
+    {
+        return this->erase(Item) > 0;
+    }
+
+    /** 크기 관련 */
+    int32 Num() const
+    {
+        return static_cast<int32>(this->size());
+    }
+
+    bool IsEmpty() const
+    {
+        return this->empty();
+    }
+
+    void Empty()
+    {
+        this->clear();
+    }
+
+    void Reserve(int64 Count)
+    {
+        this->reserve(static_cast<size_type>(Count));
+    }
+
+    /** 검색 */
+    bool Contains(const T& Item) const
+    {
+        return this->contains(Item);
+    }
+
+    /** 집합 연산 */
+    TFlatSet Union(const TFlatSet& Other) const
+    {
+        TFlatSet Result = *this;
+        for (const auto& Item : Other)
+        {
+            Result.Add(Item);
+        }
+        return Result;
+    }
+
+    TFlatSet Intersect(const TFlatSet& Other) const
+    {
+        TFlatSet Result;
+        for (const auto& Item : *this)
+        {
+            if (Other.Contains(Item))
+            {
+                Result.Add(Item);
+            }
+        }
+        return Result;
+    }
+
+    TFlatSet Difference(const TFlatSet& Other) const
+    {
+        TFlatSet Result;
+        for (const auto& Item : *this)
+        {
+            if (!Other.Contains(Item))
+            {
+                Result.Add(Item);
+            }
+        }
+        return Result;
+    }
+
+    /** 배열로 변환 */
+    TArray<T> Array() const
+    {
+        TArray<T> Result;
+        Result.Reserve(this->size());
+        for (const auto& Item : *this)
+        {
+            Result.Add(Item);
+        }
+        return Result;
+    }
+};
@@ -0,0 +1,613 @@
+﻿#pragma once
+#include <cassert>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <initializer_list>
+#include <iterator>
+#include "UEContainer.h"
+
+/**
+ * TArray 할당 정책
+ *
+ * - TArray<T, TInlineAllocator<N>> : 처음 N개는 객체 내부 버퍼에 저장하고 N개를 넘으면 힙으로 옮깁니다.
+ * - TArray<T, TFixedAllocator<N>>  : 최대 N개, 절대 힙 할당을 하지 않습니다. (초과 시 assert 후 중단)
+ *
+ * 프레임마다 만들고 버리는 작은 임시 배열(쿼리 결과, 삭제 목록 등)에서 malloc을 없애기 위한 용도입니다.
+ * 기본 TArray<T>와 같은 UE 스타일 API와 std::vector 부분집합을 제공합니다.
+ */
+template<uint32 NumInlineElements>
+struct TInlineAllocator {};
+
+template<uint32 NumInlineElements>
+struct TFixedAllocator {};
+
+/** 내부 버퍼 기반 배열 구현 (bAllowHeap == false 이면 고정 용량) */
+template<typename T, uint32 NumInline, bool bAllowHeap>
+class TInlineStorageArray
+{
+    static_assert(NumInline > 0, "Inline capacity must be greater than zero");
+
+public:
+    using value_type = T;
+    using size_type = SIZE_T;
+    using difference_type = ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    TInlineStorageArray() = default;
+
+    explicit TInlineStorageArray(size_type Count)
+    {
+        resize(Count);
+    }
+
+    TInlineStorageArray(size_type Count, const T& Value)
+    {
+        resize(Count, Value);
+    }
+
+    TInlineStorageArray(std::initializer_list<T> InitList)
+    {
+        AppendRange(InitList.begin(), InitList.end());
+    }
+
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    TInlineStorageArray(InputIt First, InputIt Last)
+    {
+        AppendRange(First, Last);
+    }
+
+    TInlineStorageArray(const TInlineStorageArray& Other)
+    {
+        AppendRange(Other.begin(), Other.end());
+    }
+
+    TInlineStorageArray(TInlineStorageArray&& Other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        MoveFrom(Other);
+    }
+
+    ~TInlineStorageArray()
+    {
+        clear();
+        FreeHeap();
+    }
+
+    TInlineStorageArray& operator=(const TInlineStorageArray& Other)
+    {
+        if (this != &Other)
+        {
+            clear();
+            AppendRange(Other.begin(), Other.end());
+        }
+        return *this;
+    }
+
+    TInlineStorageArray& operator=(TInlineStorageArray&& Other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &Other)
+        {
+            clear();
+            FreeHeap();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+
+    TInlineStorageArray& operator=(std::initializer_list<T> InitList)
+    {
+        clear();
+        AppendRange(InitList.begin(), InitList.end());
+        return *this;
+    }
+
+    /** 반복자 */
+    iterator begin() { return Data; }
+    iterator end() { return Data + Count; }
+    const_iterator begin() const { return Data; }
+    const_iterator end() const { return Data + Count; }
+    const_iterator cbegin() const { return Data; }
+    const_iterator cend() const { return Data + Count; }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    /** 크기/용량 */
+    size_type size() const { return Count; }
+    size_type capacity() const { return Capacity; }
+    bool empty() const { return Count == 0; }
+    static constexpr size_type inline_capacity() { return NumInline; }
+
+    /** 현재 내부 버퍼를 사용 중인지 (힙으로 넘어가지 않았는지) */
+    bool IsInline() const { return Data == InlineData(); }
+
+    /** 접근 */
+    T& operator[](size_type Index) { return Data[Index]; }
+    const T& operator[](size_type Index) const { return Data[Index]; }
+    T& front() { return Data[0]; }
+    const T& front() const { return Data[0]; }
+    T& back() { return Data[Count - 1]; }
+    const T& back() const { return Data[Count - 1]; }
+    T* data() { return Data; }
+    const T* data() const { return Data; }
+
+    /** 수정 */
+    void push_back(const T& Item)
+    {
+        emplace_back(Item);
+    }
+
+    void push_back(T&& Item)
+    {
+        emplace_back(std::move(Item));
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (Count == Capacity)
+        {
+            // 인자가 자기 자신의 요소를 참조할 수 있으므로 먼저 임시 객체로 만든 뒤 재할당
+            T Tmp(std::forward<Args>(args)...);
+            Grow(Count + 1);
+            ::new (static_cast<void*>(Data + Count)) T(std::move(Tmp));
+        }
+        else
+        {
+            ::new (static_cast<void*>(Data + Count)) T(std::forward<Args>(args)...);
+        }
+        return Data[Count++];
+    }
+
+    void pop_back()
+    {
+        Data[--Count].~T();
+    }
+
+    iterator insert(const_iterator Pos, const T& Item)
+    {
+        return emplace(Pos, Item);
+    }
+
+    iterator insert(const_iterator Pos, T&& Item)
+    {
+        return emplace(Pos, std::move(Item));
+    }
+
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    iterator insert(const_iterator Pos, InputIt First, InputIt Last)
+    {
+        const size_type Index = static_cast<size_type>(Pos - Data);
+        const size_type OldCount = Count;
+        AppendRange(First, Last);
+        std::rotate(Data + Index, Data + OldCount, Data + Count);
+        return Data + Index;
+    }
+
+    template<typename... Args>
+    iterator emplace(const_iterator Pos, Args&&... args)
+    {
+        const size_type Index = static_cast<size_type>(Pos - Data);
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(Data + Index, Data + Count - 1, Data + Count);
+        return Data + Index;
+    }
+
+    iterator erase(const_iterator Pos)
+    {
+        return erase(Pos, Pos + 1);
+    }
+
+    iterator erase(const_iterator First, const_iterator Last)
+    {
+        T* Dst = Data + (First - Data);
+        T* Src = Data + (Last - Data);
+        const size_type NumErased = static_cast<size_type>(Src - Dst);
+        if (NumErased == 0)
+        {
+            return Dst;
+        }
+        std::move(Src, Data + Count, Dst);
+        DestroyRange(Data + Count - NumErased, Data + Count);
+        Count -= NumErased;
+        return Dst;
+    }
+
+    void clear()
+    {
+        DestroyRange(Data, Data + Count);
+        Count = 0;
+    }
+
+    void reserve(size_type NewCapacity)
+    {
+        if (NewCapacity > Capacity)
+        {
+            Grow(NewCapacity);
+        }
+    }
+
+    void resize(size_type NewCount)
+    {
+        ResizeWith(NewCount, [](void* Slot) { ::new (Slot) T(); });
+    }
+
+    void resize(size_type NewCount, const T& Value)
+    {
+        ResizeWith(NewCount, [&Value](void* Slot) { ::new (Slot) T(Value); });
+    }
+
+    /** 요소 수가 내부 용량 이하라면 힙 버퍼를 반납하고 내부 버퍼로 돌아옴 */
+    void shrink_to_fit()
+    {
+        if (IsInline() || Count > NumInline)
+        {
+            return;
+        }
+        T* HeapData = Data;
+        Data = InlineData();
+        for (size_type i = 0; i < Count; ++i)
+        {
+            ::new (static_cast<void*>(Data + i)) T(std::move(HeapData[i]));
+            HeapData[i].~T();
+        }
+        ::operator delete(static_cast<void*>(HeapData), std::align_val_t(alignof(T)));
+        Capacity = NumInline;
+    }
+
+    void swap(TInlineStorageArray& Other)
+    {
+        TInlineStorageArray Tmp(std::move(Other));
+        Other = std::move(*this);
+        *this = std::move(Tmp);
+    }
+
+protected:
+    template<typename InputIt>
+    void AppendRange(InputIt First, InputIt Last)
+    {
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+        {
+            reserve(Count + static_cast<size_type>(std::distance(First, Last)));
+        }
+        for (; First != Last; ++First)
+        {
+            emplace_back(*First);
+        }
+    }
+
+private:
+    T* InlineData()
+    {
+        return reinterpret_cast<T*>(InlineBuffer);
+    }
+
+    const T* InlineData() const
+    {
+        return reinterpret_cast<const T*>(InlineBuffer);
+    }
+
+    static void DestroyRange(T* First, T* Last)
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (; First != Last; ++First)
+            {
+                First->~T();
+            }
+        }
+    }
+
+    template<typename ConstructFn>
+    void ResizeWith(size_type NewCount, ConstructFn&& Construct)
+    {
+        if (NewCount < Count)
+        {
+            DestroyRange(Data + NewCount, Data + Count);
+            Count = NewCount;
+            return;
+        }
+        reserve(NewCount);
+        for (; Count < NewCount; ++Count)
+        {
+            Construct(static_cast<void*>(Data + Count));
+        }
+    }
+
+    void Grow(size_type MinCapacity)
+    {
+        if constexpr (!bAllowHeap)
+        {
+            if (MinCapacity > NumInline)
+            {
+                assert(false && "TFixedAllocator capacity exceeded");
+                std::abort();
+            }
+        }
+        else
+        {
+            size_type NewCapacity = Capacity + Capacity / 2;
+            if (NewCapacity < MinCapacity)
+            {
+                NewCapacity = MinCapacity;
+            }
+
+            T* NewData = static_cast<T*>(::operator new(sizeof(T) * NewCapacity, std::align_val_t(alignof(T))));
+            for (size_type i = 0; i < Count; ++i)
+            {
+                ::new (static_cast<void*>(NewData + i)) T(std::move_if_noexcept(Data[i]));
+                Data[i].~T();
+            }
+            FreeHeap();
+            Data = NewData;
+            Capacity = NewCapacity;
+        }
+    }
+
+    void FreeHeap()
+    {
+        if (!IsInline())
+        {
+            ::operator delete(static_cast<void*>(Data), std::align_val_t(alignof(T)));
+            Data = InlineData();
+            Capacity = NumInline;
+        }
+    }
+
+    /** 대상은 비어 있고 내부 버퍼를 가리키는 상태여야 함 */
+    void MoveFrom(TInlineStorageArray& Other)
+    {
+        if (!Other.IsInline())
+        {
+            // 힙 버퍼는 포인터만 넘겨받음
+            Data = Other.Data;
+            Capacity = Other.Capacity;
+            Count = Other.Count;
+            Other.Data = Other.InlineData();
+            Other.Capacity = NumInline;
+            Other.Count = 0;
+            return;
+        }
+
+        for (size_type i = 0; i < Other.Count; ++i)
+        {
+            ::new (static_cast<void*>(Data + i)) T(std::move(Other.Data[i]));
+        }
+        Count = Other.Count;
+        Other.clear();
+    }
+
+    alignas(T) unsigned char InlineBuffer[sizeof(T) * NumInline];
+    T* Data = InlineData();
+    size_type Count = 0;
+    size_type Capacity = NumInline;
+};
+
+/** TArray의 UE 스타일 API를 내부 버퍼 배열 위에 구현 */
+template<typename T, uint32 NumInline, bool bAllowHeap>
+class TInlineArrayBase : public TInlineStorageArray<T, NumInline, bAllowHeap>
+{
+    using Super = TInlineStorageArray<T, NumInline, bAllowHeap>;
+
+public:
+    using Super::Super;
+
+    /** 기본 TArray에서 복사 */
+    TInlineArrayBase(const TArray<T>& Other)
+        : Super(Other.begin(), Other.end())
+    {
+    }
+
+    /** 기본 TArray로 복사 (힙 배열이 필요한 API에 넘길 때) */
+    TArray<T> ToArray() const
+    {
+        return TArray<T>(this->begin(), this->end());
+    }
+
+    /** 요소 추가 */
+    int32 Add(const T& Item)
+    {
+        this->push_back(Item);
+        return static_cast<int32>(this->size() - 1);
+    }
+
+    template<typename... Args>
+    int32 Emplace(Args&&... args)
+    {
+        this->emplace_back(std::forward<Args>(args)...);
+        return static_cast<int32>(this->size() - 1);
+    }
+
+    /** 고유 요소만 추가 */
+    int32 AddUnique(const T& Item)
+    {
+        const int32 Index = Find(Item);
+        return Index != -1 ? Index : Add(Item);
+    }
+
+    /** 배열 병합 (임의의 TArray/컨테이너) */
+    template<typename ContainerType>
+    void Append(const ContainerType& Other)
+    {
+        this->AppendRange(std::begin(Other), std::end(Other));
+    }
+
+    /** 삽입 */
+    void Insert(const T& Item, int32 Index)
+    {
+        this->insert(this->begin() + Index, Item);
+    }
+
+    /** 제거 */
+    void RemoveAt(int32 Index)
+    {
+        this->erase(this->begin() + Index);
+    }
+
+    /** 빠르게 제거 (순서 보존 X) */
+    void RemoveAtSwap(int32 Index, int32 Count = 1, bool bAllowShrinking = false)
+    {
+        int32 NumElements = Num();
+        if (Index < 0 || Count <= 0 || Index >= NumElements)
+        {
+            return;
+        }
+
+        int32 NumToRemove = Count;
+        if (Index + NumToRemove > NumElements)
+        {
+            NumToRemove = NumElements - Index;
+        }
+
+        for (int32 i = 0; i < NumToRemove; ++i)
+        {
+            int32 LastIndex = Num() - 1;
+            if (Index < LastIndex)
+            {
+                std::swap((*this)[Index], (*this)[LastIndex]);
+            }
+            this->pop_back();
+        }
+
+        if (bAllowShrinking)
+        {
+            this->shrink_to_fit();
+        }
+    }
+
+    bool Remove(const T& Item)
+    {
+        const int32 Index = Find(Item);
+        if (Index != -1)
+        {
+            RemoveAt(Index);
+            return true;
+        }
+        return false;
+    }
+
+    int32 RemoveAll(const T& Item)
+    {
+        auto OldSize = this->size();
+        this->erase(std::remove(this->begin(), this->end(), Item), this->end());
+        return static_cast<int32>(OldSize - this->size());
+    }
+
+    /** 크기 관련 */
+    int32 Num() const
+    {
+        return static_cast<int32>(this->size());
+    }
+
+    bool IsEmpty() const
+    {
+        return this->empty();
+    }
+
+    void Empty()
+    {
+        this->clear();
+    }
+
+    void Shrink()
+    {
+        this->shrink_to_fit();
+    }
+
+    void Reserve(int64 Capacity)
+    {
+        this->reserve(static_cast<SIZE_T>(Capacity));
+    }
+
+    void SetNum(int32 NewSize)
+    {
+        this->resize(static_cast<SIZE_T>(NewSize));
+    }
+
+    void SetNum(int32 NewSize, const T& DefaultValue)
+    {
+        this->resize(static_cast<SIZE_T>(NewSize), DefaultValue);
+    }
+
+    /** 접근 */
+    T& Last()
+    {
+        return this->back();
+    }
+
+    const T& Last() const
+    {
+        return this->back();
+    }
+
+    T* GetData()
+    {
+        return this->data();
+    }
+
+    const T* GetData() const
+    {
+        return this->data();
+    }
+
+    /** Stack 기능 */
+    void Push(const T& Item)
+    {
+        this->push_back(Item);
+    }
+
+    T Pop()
+    {
+        T Item = std::move(this->back());
+        this->pop_back();
+        return Item;
+    }
+
+    /** 검색 */
+    int32 Find(const T& Item) const
+    {
+        auto It = std::find(this->begin(), this->end(), Item);
+        return (It != this->end()) ? static_cast<int32>(It - this->begin()) : -1;
+    }
+
+    bool Contains(const T& Item) const
+    {
+        return Find(Item) != -1;
+    }
+
+    /** 정렬 */
+    void Sort()
+    {
+        std::sort(this->begin(), this->end());
+    }
+
+    template<typename Predicate>
+    void Sort(Predicate Pred)
+    {
+        std::sort(this->begin(), this->end(), Pred);
+    }
+};
+
+/** TArray<T, TInlineAllocator<N>> - N개까지 내부 버퍼, 초과 시 힙 */
+template<typename T, uint32 NumInlineElements>
+class TArray<T, TInlineAllocator<NumInlineElements>> : public TInlineArrayBase<T, NumInlineElements, true>
+{
+public:
+    using TInlineArrayBase<T, NumInlineElements, true>::TInlineArrayBase;
+};
+
+/** TArray<T, TFixedAllocator<N>> - 최대 N개, 힙 할당 없음 */
+template<typename T, uint32 NumElements>
+class TArray<T, TFixedAllocator<NumElements>> : public TInlineArrayBase<T, NumElements, false>
+{
+public:
+    using TInlineArrayBase<T, NumElements, false>::TInlineArrayBase;
+};
@@ -0,0 +1,563 @@
+﻿#pragma once
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include "UEContainer.h"
+
+/**
+ * 스레드 간 데이터 전달용 잠금 없는(lock-free) 큐 구현
+ *
+ * - TSpscRingQueue      : 생산자 1 / 소비자 1, 고정 크기 링버퍼
+ * - TMpmcQueue          : 생산자 N / 소비자 N, 고정 크기 (Vyukov bounded MPMC)
+ * - TIntrusiveMpscQueue : 생산자 N / 소비자 1, 노드 내장형 무제한 큐 (Vyukov intrusive MPSC)
+ *
+ * TQueue<T, EQueueMode::Spsc/Mpmc/Mpsc/Spmc>는 아래 구현들로 특수화되며
+ * 기존과 같은 Enqueue/Dequeue/Peek API를 제공합니다.
+ * 고정 크기 큐의 Enqueue는 가득 차 있으면 false를 반환합니다.
+ */
+namespace LockFree
+{
+    constexpr SIZE_T CacheLineSize = 64;
+
+    inline SIZE_T RoundUpToPowerOfTwo(SIZE_T Value)
+    {
+        SIZE_T Result = 2;
+        while (Result < Value)
+        {
+            Result <<= 1;
+        }
+        return Result;
+    }
+}
+
+/** 단일 생산자 / 단일 소비자 고정 크기 링버퍼 */
+template<typename T>
+class TSpscRingQueue
+{
+public:
+    static constexpr uint32 DefaultCapacity = 1024;
+
+    explicit TSpscRingQueue(uint32 InCapacity = DefaultCapacity)
+        : Capacity(LockFree::RoundUpToPowerOfTwo(InCapacity))
+        , Mask(Capacity - 1)
+    {
+        Slots = static_cast<T*>(::operator new(sizeof(T) * Capacity, std::align_val_t(alignof(T))));
+    }
+
+    ~TSpscRingQueue()
+    {
+        Empty();
+        ::operator delete(static_cast<void*>(Slots), std::align_val_t(alignof(T)));
+    }
+
+    TSpscRingQueue(const TSpscRingQueue&) = delete;
+    TSpscRingQueue& operator=(const TSpscRingQueue&) = delete;
+
+    /** 생산자 스레드 전용. 가득 차 있으면 false */
+    bool Enqueue(const T& Item)
+    {
+        return EmplaceInternal(Item);
+    }
+
+    bool Enqueue(T&& Item)
+    {
+        return EmplaceInternal(std::move(Item));
+    }
+
+    /** 소비자 스레드 전용 */
+    bool Dequeue(T& OutItem)
+    {
+        const SIZE_T CurrentHead = Head.load(std::memory_order_relaxed);
+        if (CurrentHead == CachedTail)
+        {
+            CachedTail = Tail.load(std::memory_order_acquire);
+            if (CurrentHead == CachedTail)
+            {
+                return false;
+            }
+        }
+
+        T* Slot = Slots + (CurrentHead & Mask);
+        OutItem = std::move(*Slot);
+        Slot->~T();
+        Head.store(CurrentHead + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** 소비자 스레드 전용 */
+    bool Peek(T& OutItem) const
+    {
+        const SIZE_T CurrentHead = Head.load(std::memory_order_relaxed);
+        if (CurrentHead == CachedTail)
+        {
+            CachedTail = Tail.load(std::memory_order_acquire);
+            if (CurrentHead == CachedTail)
+            {
+                return false;
+            }
+        }
+
+        OutItem = Slots[CurrentHead & Mask];
+        return true;
+    }
+
+    /** 다른 스레드에서 호출하면 근사값 */
+    int32 Num() const
+    {
+        return static_cast<int32>(Tail.load(std::memory_order_acquire) - Head.load(std::memory_order_acquire));
+    }
+
+    bool IsEmpty() const
+    {
+        return Num() == 0;
+    }
+
+    /** 소비자 스레드 전용 - 남은 요소 모두 버림 */
+    void Empty()
+    {
+        const SIZE_T CurrentTail = Tail.load(std::memory_order_acquire);
+        SIZE_T CurrentHead = Head.load(std::memory_order_relaxed);
+        for (; CurrentHead != CurrentTail; ++CurrentHead)
+        {
+            Slots[CurrentHead & Mask].~T();
+        }
+        CachedTail = CurrentTail;
+        Head.store(CurrentTail, std::memory_order_release);
+    }
+
+    SIZE_T GetCapacity() const { return Capacity; }
+
+private:
+    template<typename U>
+    bool EmplaceInternal(U&& Item)
+    {
+        const SIZE_T CurrentTail = Tail.load(std::memory_order_relaxed);
+        if (CurrentTail - CachedHead == Capacity)
+        {
+            CachedHead = Head.load(std::memory_order_acquire);
+            if (CurrentTail - CachedHead == Capacity)
+            {
+                return false;
+            }
+        }
+
+        ::new (static_cast<void*>(Slots + (CurrentTail & Mask))) T(std::forward<U>(Item));
+        Tail.store(CurrentTail + 1, std::memory_order_release);
+        return true;
+    }
+
+    const SIZE_T Capacity;
+    const SIZE_T Mask;
+    T* Slots = nullptr;
+
+    // 소비자가 쓰는 값과 생산자가 쓰는 값을 서로 다른 캐시 라인에 두어 false sharing 방지
+    alignas(LockFree::CacheLineSize) std::atomic<SIZE_T> Head{ 0 };
+    mutable SIZE_T CachedTail = 0;
+
+    alignas(LockFree::CacheLineSize) std::atomic<SIZE_T> Tail{ 0 };
+    SIZE_T CachedHead = 0;
+};
+
+/** 다중 생산자 / 다중 소비자 고정 크기 큐 (셀마다 시퀀스 번호를 두는 Vyukov 방식) */
+template<typename T>
+class TMpmcQueue
+{
+public:
+    static constexpr uint32 DefaultCapacity = 1024;
+
+    explicit TMpmcQueue(uint32 InCapacity = DefaultCapacity)
+        : Capacity(LockFree::RoundUpToPowerOfTwo(InCapacity))
+        , Mask(Capacity - 1)
+    {
+        Cells = new FCell[Capacity];
+        for (SIZE_T i = 0; i < Capacity; ++i)
+        {
+            Cells[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~TMpmcQueue()
+    {
+        Empty();
+        delete[] Cells;
+    }
+
+    TMpmcQueue(const TMpmcQueue&) = delete;
+    TMpmcQueue& operator=(const TMpmcQueue&) = delete;
+
+    /** 가득 차 있으면 false */
+    bool Enqueue(const T& Item)
+    {
+        return EmplaceInternal(Item);
+    }
+
+    bool Enqueue(T&& Item)
+    {
+        return EmplaceInternal(std::move(Item));
+    }
+
+    bool Dequeue(T& OutItem)
+    {
+        SIZE_T Pos;
+        FCell* Cell = ClaimDequeueCell(Pos);
+        if (!Cell)
+        {
+            return false;
+        }
+
+        T* Value = Cell->GetValue();
+        OutItem = std::move(*Value);
+        Value->~T();
+        Cell->Sequence.store(Pos + Mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * 맨 앞 요소를 복사만 하고 제거하지 않음.
+     * 다른 소비자가 동시에 꺼낼 수 있으므로 값 복사 후 셀 시퀀스가 바뀌지 않았는지 재확인하며,
+     * 이 검증이 의미가 있도록 trivially copyable 타입에만 허용합니다.
+     */
+    bool Peek(T& OutItem) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "TMpmcQueue::Peek requires a trivially copyable type");
+
+        while (true)
+        {
+            const SIZE_T Pos = DequeuePos.load(std::memory_order_acquire);
+            const FCell& Cell = Cells[Pos & Mask];
+            const SIZE_T Sequence = Cell.Sequence.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(Sequence) - static_cast<intptr_t>(Pos + 1) < 0)
+            {
+                return false;
+            }
+
+            std::memcpy(static_cast<void*>(&OutItem), Cell.Storage, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (Cell.Sequence.load(std::memory_order_relaxed) == Sequence &&
+                DequeuePos.load(std::memory_order_relaxed) == Pos)
+            {
+                return true;
+            }
+        }
+    }
+
+    /** 동시 접근 중에는 근사값 */
+    int32 Num() const
+    {
+        const SIZE_T Enq = EnqueuePos.load(std::memory_order_acquire);
+        const SIZE_T Deq = DequeuePos.load(std::memory_order_acquire);
+        return Enq > Deq ? static_cast<int32>(Enq - Deq) : 0;
+    }
+
+    bool IsEmpty() const
+    {
+        return Num() == 0;
+    }
+
+    void Empty()
+    {
+        SIZE_T Pos;
+        while (FCell* Cell = ClaimDequeueCell(Pos))
+        {
+            Cell->GetValue()->~T();
+            Cell->Sequence.store(Pos + Mask + 1, std::memory_order_release);
+        }
+    }
+
+    SIZE_T GetCapacity() const { return Capacity; }
+
+private:
+    struct FCell
+    {
+        std::atomic<SIZE_T> Sequence;
+        alignas(T) unsigned char Storage[sizeof(T)];
+
+        T* GetValue() { return reinterpret_cast<T*>(Storage); }
+    };
+
+    /** 꺼낼 셀의 소유권을 얻음. 비어 있으면 nullptr */
+    FCell* ClaimDequeueCell(SIZE_T& OutPos)
+    {
+        SIZE_T Pos = DequeuePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            FCell* Cell = &Cells[Pos & Mask];
+            const SIZE_T Sequence = Cell->Sequence.load(std::memory_order_acquire);
+            const intptr_t Diff = static_cast<intptr_t>(Sequence) - static_cast<intptr_t>(Pos + 1);
+            if (Diff == 0)
+            {
+                if (DequeuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+                {
+                    OutPos = Pos;
+                    return Cell;
+                }
+            }
+            else if (Diff < 0)
+            {
+                return nullptr;
+            }
+            else
+            {
+                Pos = DequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    template<typename U>
+    bool EmplaceInternal(U&& Item)
+    {
+        SIZE_T Pos = EnqueuePos.load(std::memory_order_relaxed);
+        FCell* Cell;
+        while (true)
+        {
+            Cell = &Cells[Pos & Mask];
+            const SIZE_T Sequence = Cell->Sequence.load(std::memory_order_acquire);
+            const intptr_t Diff = static_cast<intptr_t>(Sequence) - static_cast<intptr_t>(Pos);
+            if (Diff == 0)
+            {
+                if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (Diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                Pos = EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        ::new (static_cast<void*>(Cell->Storage)) T(std::forward<U>(Item));
+        Cell->Sequence.store(Pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    const SIZE_T Capacity;
+    const SIZE_T Mask;
+    FCell* Cells = nullptr;
+
+    alignas(LockFree::CacheLineSize) std::atomic<SIZE_T> EnqueuePos{ 0 };
+    alignas(LockFree::CacheLineSize) std::atomic<SIZE_T> DequeuePos{ 0 };
+};
+
+/**
+ * 다중 생산자 / 단일 소비자 무제한 큐 (Vyukov intrusive MPSC)
+ * NodeType은 std::atomic<NodeType*> Next 멤버를 가져야 하며, 큐는 노드를 할당/해제하지 않습니다.
+ * Push는 wait-free(원자적 exchange 1회), Pop은 소비자 스레드 전용입니다.
+ */
+template<typename NodeType>
+class TIntrusiveMpscQueue
+{
+public:
+    TIntrusiveMpscQueue()
+    {
+        Stub.Next.store(nullptr, std::memory_order_relaxed);
+        Head.store(&Stub, std::memory_order_relaxed);
+        Tail = &Stub;
+    }
+
+    TIntrusiveMpscQueue(const TIntrusiveMpscQueue&) = delete;
+    TIntrusiveMpscQueue& operator=(const TIntrusiveMpscQueue&) = delete;
+
+    void Push(NodeType* Node)
+    {
+        Node->Next.store(nullptr, std::memory_order_relaxed);
+        NodeType* Prev = Head.exchange(Node, std::memory_order_acq_rel);
+        Prev->Next.store(Node, std::memory_order_release);
+    }
+
+    /**
+     * 소비자 스레드 전용. 비어 있거나 생산자가 연결을 마치지 않았다면 nullptr.
+     */
+    NodeType* Pop()
+    {
+        NodeType* CurrentTail = Tail;
+        NodeType* Next = CurrentTail->Next.load(std::memory_order_acquire);
+
+        if (CurrentTail == &Stub)
+        {
+            if (!Next)
+            {
+                return nullptr;
+            }
+            Tail = Next;
+            CurrentTail = Next;
+            Next = Next->Next.load(std::memory_order_acquire);
+        }
+
+        if (Next)
+        {
+            Tail = Next;
+            return CurrentTail;
+        }
+
+        // 마지막 노드를 꺼내려면 Stub을 다시 넣어 뒤쪽 연결을 확보해야 함
+        if (CurrentTail != Head.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+
+        Push(&Stub);
+        Next = CurrentTail->Next.load(std::memory_order_acquire);
+        if (Next)
+        {
+            Tail = Next;
+            return CurrentTail;
+        }
+        return nullptr;
+    }
+
+    /** 소비자 스레드 전용. 다음에 Pop될 노드 (제거하지 않음) */
+    NodeType* PeekNode() const
+    {
+        NodeType* First = Tail;
+        if (First == &Stub)
+        {
+            First = Stub.Next.load(std::memory_order_acquire);
+        }
+        return First;
+    }
+
+    bool IsEmpty() const
+    {
+        return PeekNode() == nullptr;
+    }
+
+private:
+    alignas(LockFree::CacheLineSize) std::atomic<NodeType*> Head;
+    alignas(LockFree::CacheLineSize) NodeType* Tail;
+    NodeType Stub;
+};
+
+/** 값 타입 T를 노드에 담아 TIntrusiveMpscQueue 위에서 사용하는 MPSC 큐 */
+template<typename T>
+class TMpscQueue
+{
+public:
+    TMpscQueue() = default;
+
+    ~TMpscQueue()
+    {
+        Empty();
+    }
+
+    TMpscQueue(const TMpscQueue&) = delete;
+    TMpscQueue& operator=(const TMpscQueue&) = delete;
+
+    /** 무제한 큐이므로 항상 true */
+    bool Enqueue(const T& Item)
+    {
+        return EmplaceInternal(Item);
+    }
+
+    bool Enqueue(T&& Item)
+    {
+        return EmplaceInternal(std::move(Item));
+    }
+
+    /** 소비자 스레드 전용 */
+    bool Dequeue(T& OutItem)
+    {
+        FNode* Node = Queue.Pop();
+        if (!Node)
+        {
+            return false;
+        }
+
+        OutItem = std::move(*Node->GetValue());
+        Node->GetValue()->~T();
+        delete Node;
+        Count.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /** 소비자 스레드 전용 */
+    bool Peek(T& OutItem) const
+    {
+        FNode* Node = Queue.PeekNode();
+        if (!Node)
+        {
+            return false;
+        }
+        OutItem = *Node->GetValue();
+        return true;
+    }
+
+    /** 동시 접근 중에는 근사값 */
+    int32 Num() const
+    {
+        return Count.load(std::memory_order_relaxed);
+    }
+
+    bool IsEmpty() const
+    {
+        return Queue.IsEmpty();
+    }
+
+    /** 소비자 스레드 전용 */
+    void Empty()
+    {
+        while (FNode* Node = Queue.Pop())
+        {
+            Node->GetValue()->~T();
+            delete Node;
+            Count.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct FNode
+    {
+        std::atomic<FNode*> Next{ nullptr };
+        alignas(T) unsigned char Storage[sizeof(T)];
+
+        T* GetValue() { return reinterpret_cast<T*>(Storage); }
+    };
+
+    template<typename U>
+    bool EmplaceInternal(U&& Item)
+    {
+        FNode* Node = new FNode();
+        ::new (static_cast<void*>(Node->Storage)) T(std::forward<U>(Item));
+        Count.fetch_add(1, std::memory_order_relaxed);
+        Queue.Push(Node);
+        return true;
+    }
+
+    TIntrusiveMpscQueue<FNode> Queue;
+    std::atomic<int32> Count{ 0 };
+};
+
+/** TQueue 동시성 모드 특수화 */
+template<typename T, typename Compare>
+class TQueue<T, EQueueMode::Spsc, Compare> : public TSpscRingQueue<T>
+{
+public:
+    using TSpscRingQueue<T>::TSpscRingQueue;
+};
+
+template<typename T, typename Compare>
+class TQueue<T, EQueueMode::Mpmc, Compare> : public TMpmcQueue<T>
+{
+public:
+    using TMpmcQueue<T>::TMpmcQueue;
+};
+
+/** 단일 생산자 / 다중 소비자는 MPMC 구현을 그대로 사용 */
+template<typename T, typename Compare>
+class TQueue<T, EQueueMode::Spmc, Compare> : public TMpmcQueue<T>
+{
+public:
+    using TMpmcQueue<T>::TMpmcQueue;
+};
+
+template<typename T, typename Compare>
+class TQueue<T, EQueueMode::Mpsc, Compare> : public TMpscQueue<T>
+{
+public:
+    using TMpscQueue<T>::TMpscQueue;
+};
@@ -19,44 +19,10 @@ typedef wchar_t WIDECHAR;
 typedef std::string FString;
 typedef std::wstring FWideString;
 
-// Lightweight weak object pointer compatible with engine UObject lifetime
-// - Stores a raw pointer (non-owning)
-// - Provides IsValid(), Get(), operators for containers
-// - Hash specialization provided below for unordered_map/set
-template<typename T>
-class TWeakObjectPtr
-{
-public:
-    using ElementType = T;
-
-    TWeakObjectPtr() : Ptr(nullptr) {}
-    TWeakObjectPtr(std::nullptr_t) : Ptr(nullptr) {}
-    explicit TWeakObjectPtr(T* InPtr) : Ptr(InPtr) {}
-
-    bool IsValid() const { return Ptr != nullptr; }
-    T* Get() const { return Ptr; }
-
-    T& operator*() const { return *Ptr; }
-    T* operator->() const { return Ptr; }
-
-    bool operator==(const TWeakObjectPtr& Other) const { return Ptr == Other.Ptr; }
-    bool operator!=(const TWeakObjectPtr& Other) const { return Ptr != Other.Ptr; }
-
-private:
-    T* Ptr;
-};
-
-namespace std {
-    template <typename T>
-    struct hash<TWeakObjectPtr<T>>
-    {
-        size_t operator()(const TWeakObjectPtr<T>& Key) const noexcept
-        {
-            return hash<const void*>()(static_cast<const void*>(Key.Get()));
-        }
-    };
-}
+/** 기본 해셔(TDefaultHasher)와 FastHash */
+#include "FastHash.h"
 
+/** TWeakObjectPtr는 WeakObjectPtr.h (GUObjectArray 세대 기반) */
 template<typename T>
 using TUniqueObjectPtr = std::unique_ptr<T>;
 
@@ -68,9 +34,15 @@ using TPair = std::pair<T1, T2>;
 template<typename T, SIZE_T N>
 using TStaticArray = std::array<T, N>;
 
+/** TArray 할당 정책 - 기본은 std::vector 힙 할당 (TInlineAllocator/TFixedAllocator는 InlineArray.h) */
+struct FDefaultAllocator {};
+
+template<typename T, typename Allocator = FDefaultAllocator>
+class TArray;
+
 /** TArray 구현 */
 template<typename T>
-class TArray : public std::vector<T>
+class TArray<T, FDefaultAllocator> : public std::vector<T>
 {
 public:
     using std::vector<T>::vector; /** 생성자 상속 */
@@ -266,10 +238,10 @@ public:
 
 /** TSet - 해시 기반 집합 */
 template<typename T>
-class TSet : public std::unordered_set<T>
+class TSet : public std::unordered_set<T, TDefaultHasher<T>>
 {
 public:
-    using std::unordered_set<T>::unordered_set;
+    using std::unordered_set<T, TDefaultHasher<T>>::unordered_set;
 
     /** 요소 추가 */
     void Add(const T& Item)
@@ -357,10 +329,10 @@ public:
 
 /** TMap - 해시 기반 연관 컨테이너 */
 template<typename KeyType, typename ValueType>
-class TMap : public std::unordered_map<KeyType, ValueType>
+class TMap : public std::unordered_map<KeyType, ValueType, TDefaultHasher<KeyType>>
 {
 public:
-    using std::unordered_map<KeyType, ValueType>::unordered_map;
+    using std::unordered_map<KeyType, ValueType, TDefaultHasher<KeyType>>::unordered_map;
 
     /** 요소 추가/수정 */
     void Add(const KeyType& Key, const ValueType& Value)
@@ -544,13 +516,14 @@ using TLinkedList = std::list<T>;
 template<typename T>
 using TDoubleLinkedList = std::list<T>;
 
-/** 큐 모드 열거형 */
+/** 큐 모드 열거형 (Spsc/Mpmc/Mpsc/Spmc 구현은 LockFreeQueue.h) */
 enum class EQueueMode
 {
-    Spsc,           /** Single Producer Single Consumer (기본 FIFO) */
-    Mpmc,           /** Multiple Producer Multiple Consumer */
-    Mpsc,           /** Multiple Producer Single Consumer */
-    Spmc,           /** Single Producer Multiple Consumer */
+    Fifo,           /** 단일 스레드 FIFO (기본, std::queue) */
+    Spsc,           /** Single Producer Single Consumer (lock-free 고정 크기 링버퍼) */
+    Mpmc,           /** Multiple Producer Multiple Consumer (lock-free 고정 크기) */
+    Mpsc,           /** Multiple Producer Single Consumer (lock-free 무제한) */
+    Spmc,           /** Single Producer Multiple Consumer (Mpmc 구현 사용) */
     Priority        /** Priority Queue */
 };
 
@@ -564,8 +537,8 @@ struct TDefaultCompare
     }
 };
 
-/** 기본 TQueue - FIFO 큐 */
-template<typename T, EQueueMode Mode = EQueueMode::Spsc, typename Compare = TDefaultCompare<T>>
+/** 기본 TQueue - 단일 스레드 FIFO 큐 */
+template<typename T, EQueueMode Mode = EQueueMode::Fifo, typename Compare = TDefaultCompare<T>>
 class TQueue : public std::queue<T>
 {
 public:
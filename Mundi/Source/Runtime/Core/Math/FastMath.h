@@ -0,0 +1,366 @@
+﻿#pragma once
+#include "Vector.h"
+#include <immintrin.h>
+#include <cstring>
+
+/**
+ * 근사 초월 함수 (FMath::Fast*)
+ *
+ * - 파티클 스폰처럼 원소마다 sin/cos 등을 부르는 곳을 위한 다항식 근사입니다.
+ *   정확도가 중요한 곳(애니메이션, 물리, 직렬화)에는 std:: 함수를 그대로 쓰세요.
+ * - 스칼라 / Fast4(__m128) / Fast8(__m256) 버전은 같은 구현을 공유하므로 같은 입력에 비트 단위로 같은 값을 냅니다.
+ * - 각 함수 주석의 최대 오차는 libm(double) 대비 측정값입니다.
+ *   abs = 절대 오차, rel = 상대 오차, ulp = 결과 float 기준 ulp 단위.
+ * - Fast8은 AVX 명령을 쓰므로 GetSimdLevel() == ESimdLevel::AVX일 때만 호출하세요.
+ */
+namespace FMath
+{
+	namespace FastMathDetail
+	{
+		/** 폭별 연산 (정수 연산은 AVX2 없이도 되도록 float <-> int32 변환만 사용) */
+		template<typename V> struct TOps;
+
+		template<> struct TOps<__m128>
+		{
+			using V = __m128;
+			static V Set1(float F) { return _mm_set1_ps(F); }
+			static V Add(V A, V B) { return _mm_add_ps(A, B); }
+			static V Sub(V A, V B) { return _mm_sub_ps(A, B); }
+			static V Mul(V A, V B) { return _mm_mul_ps(A, B); }
+			static V Div(V A, V B) { return _mm_div_ps(A, B); }
+			static V Min(V A, V B) { return _mm_min_ps(A, B); }
+			static V Max(V A, V B) { return _mm_max_ps(A, B); }
+			static V Sqrt(V A) { return _mm_sqrt_ps(A); }
+			static V RsqrtEstimate(V A) { return _mm_rsqrt_ps(A); }
+			static V And(V A, V B) { return _mm_and_ps(A, B); }
+			static V Or(V A, V B) { return _mm_or_ps(A, B); }
+			static V Xor(V A, V B) { return _mm_xor_ps(A, B); }
+			static V CmpLt(V A, V B) { return _mm_cmplt_ps(A, B); }
+			static V Select(V Mask, V A, V B) { return _mm_or_ps(_mm_and_ps(Mask, A), _mm_andnot_ps(Mask, B)); }
+			/** 가장 가까운 정수로 반올림 (짝수 우선, MXCSR 기본값) */
+			static V Round(V A) { return _mm_cvtepi32_ps(_mm_cvtps_epi32(A)); }
+			/** 정수 값 float -> 같은 비트 패턴의 float (A는 [0, 2^31) 범위의 정수) */
+			static V FromBits(V A) { return _mm_castsi128_ps(_mm_cvtps_epi32(A)); }
+			/** 비트 패턴 -> 정수 값 float (A의 비트는 [0, 2^31) 범위) */
+			static V ToBits(V A) { return _mm_cvtepi32_ps(_mm_castps_si128(A)); }
+			static V Bits(uint32 B) { return _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(B))); }
+		};
+
+		template<> struct TOps<__m256>
+		{
+			using V = __m256;
+			static V Set1(float F) { return _mm256_set1_ps(F); }
+			static V Add(V A, V B) { return _mm256_add_ps(A, B); }
+			static V Sub(V A, V B) { return _mm256_sub_ps(A, B); }
+			static V Mul(V A, V B) { return _mm256_mul_ps(A, B); }
+			static V Div(V A, V B) { return _mm256_div_ps(A, B); }
+			static V Min(V A, V B) { return _mm256_min_ps(A, B); }
+			static V Max(V A, V B) { return _mm256_max_ps(A, B); }
+			static V Sqrt(V A) { return _mm256_sqrt_ps(A); }
+			static V RsqrtEstimate(V A) { return _mm256_rsqrt_ps(A); }
+			static V And(V A, V B) { return _mm256_and_ps(A, B); }
+			static V Or(V A, V B) { return _mm256_or_ps(A, B); }
+			static V Xor(V A, V B) { return _mm256_xor_ps(A, B); }
+			static V CmpLt(V A, V B) { return _mm256_cmp_ps(A, B, _CMP_LT_OQ); }
+			static V Select(V Mask, V A, V B) { return _mm256_blendv_ps(B, A, Mask); }
+			static V Round(V A) { return _mm256_cvtepi32_ps(_mm256_cvtps_epi32(A)); }
+			static V FromBits(V A) { return _mm256_castsi256_ps(_mm256_cvtps_epi32(A)); }
+			static V ToBits(V A) { return _mm256_cvtepi32_ps(_mm256_castps_si256(A)); }
+			static V Bits(uint32 B) { return _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(B))); }
+		};
+
+		/** 스칼라 - 반올림/추정 명령은 SSE 스칼라 버전을 써서 벡터 레인과 같은 값을 냄 */
+		template<> struct TOps<float>
+		{
+			using V = float;
+			static uint32 AsBits(V A) { uint32 B; std::memcpy(&B, &A, sizeof(B)); return B; }
+			static V FromU(uint32 B) { V A; std::memcpy(&A, &B, sizeof(A)); return A; }
+			static V Set1(float F) { return F; }
+			static V Add(V A, V B) { return A + B; }
+			static V Sub(V A, V B) { return A - B; }
+			static V Mul(V A, V B) { return A * B; }
+			static V Div(V A, V B) { return A / B; }
+			static V Min(V A, V B) { return _mm_cvtss_f32(_mm_min_ss(_mm_set_ss(A), _mm_set_ss(B))); }
+			static V Max(V A, V B) { return _mm_cvtss_f32(_mm_max_ss(_mm_set_ss(A), _mm_set_ss(B))); }
+			static V Sqrt(V A) { return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(A))); }
+			static V RsqrtEstimate(V A) { return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(A))); }
+			static V And(V A, V B) { return FromU(AsBits(A) & AsBits(B)); }
+			static V Or(V A, V B) { return FromU(AsBits(A) | AsBits(B)); }
+			static V Xor(V A, V B) { return FromU(AsBits(A) ^ AsBits(B)); }
+			static V CmpLt(V A, V B) { return FromU(A < B ? 0xFFFFFFFFu : 0u); }
+			static V Select(V Mask, V A, V B) { return AsBits(Mask) ? A : B; }
+			static V Round(V A) { return static_cast<float>(_mm_cvtss_si32(_mm_set_ss(A))); }
+			static V FromBits(V A) { return FromU(static_cast<uint32>(_mm_cvtss_si32(_mm_set_ss(A)))); }
+			static V ToBits(V A) { return static_cast<float>(static_cast<int32>(AsBits(A))); }
+			static V Bits(uint32 B) { return FromU(B); }
+		};
+
+		template<typename V>
+		inline V Abs(V X)
+		{
+			using O = TOps<V>;
+			return O::And(X, O::Bits(0x7FFFFFFFu));
+		}
+
+		template<typename V>
+		inline V SignBit(V X)
+		{
+			using O = TOps<V>;
+			return O::And(X, O::Bits(0x80000000u));
+		}
+
+		/** X를 [-PI/2, PI/2]로 접은 값과 cos 부호(+-1) */
+		template<typename V>
+		inline void ReduceSinCos(V X, V& OutY, V& OutCosSign)
+		{
+			using O = TOps<V>;
+
+			// X - 2PI * Q (Cody-Waite: 6.28125는 유효 비트가 적어 |Q| < 2^16이면 곱이 정확)
+			const V Q = O::Round(O::Mul(X, O::Set1(1.0f / TWO_PI)));
+			V Y = O::Sub(X, O::Mul(Q, O::Set1(6.28125f)));
+			Y = O::Sub(Y, O::Mul(Q, O::Set1(1.9353071795864769e-3f)));
+
+			// |Y| > PI/2이면 +-PI - Y (sin은 그대로, cos는 부호 반전)
+			const V Fold = O::CmpLt(O::Set1(HALF_PI), Abs(Y));
+			const V Folded = O::Sub(O::Or(O::Set1(PI), SignBit(Y)), Y);
+			OutY = O::Select(Fold, Folded, Y);
+			OutCosSign = O::Select(Fold, O::Set1(-1.0f), O::Set1(1.0f));
+		}
+
+		/** sin(Y), Y in [-PI/2, PI/2] (11차 minimax) */
+		template<typename V>
+		inline V SinPoly(V Y)
+		{
+			using O = TOps<V>;
+			const V Y2 = O::Mul(Y, Y);
+			V P = O::Set1(-2.3889859e-08f);
+			P = O::Add(O::Mul(P, Y2), O::Set1(2.7525562e-06f));
+			P = O::Add(O::Mul(P, Y2), O::Set1(-1.9840874e-04f));
+			P = O::Add(O::Mul(P, Y2), O::Set1(8.3333310e-03f));
+			P = O::Add(O::Mul(P, Y2), O::Set1(-1.6666667e-01f));
+			P = O::Add(O::Mul(P, Y2), O::Set1(1.0f));
+			return O::Mul(P, Y);
+		}
+
+		/** cos(Y), Y in [-PI/2, PI/2] (10차 minimax) */
+		template<typename V>
+		inline V CosPoly(V Y)
+		{
+			using O = TOps<V>;
+			const V Y2 = O::Mul(Y, Y);
+			V P = O::Set1(-2.6051615e-07f);
+			P = O::Add(O::Mul(P, Y2), O::Set1(2.4760495e-05f));
+			P = O::Add(O::Mul(P, Y2), O::Set1(-1.3888378e-03f));
+			P = O::Add(O::Mul(P, Y2), O::Set1(4.1666638e-02f));
+			P = O::Add(O::Mul(P, Y2), O::Set1(-0.5f));
+			P = O::Add(O::Mul(P, Y2), O::Set1(1.0f));
+			return P;
+		}
+
+		template<typename V>
+		inline V Sin(V X)
+		{
+			V Y, CosSign;
+			ReduceSinCos(X, Y, CosSign);
+			return SinPoly(Y);
+		}
+
+		template<typename V>
+		inline V Cos(V X)
+		{
+			V Y, CosSign;
+			ReduceSinCos(X, Y, CosSign);
+			return TOps<V>::Mul(CosPoly(Y), CosSign);
+		}
+
+		template<typename V>
+		inline void SinCos(V X, V& OutSin, V& OutCos)
+		{
+			V Y, CosSign;
+			ReduceSinCos(X, Y, CosSign);
+			OutSin = SinPoly(Y);
+			OutCos = TOps<V>::Mul(CosPoly(Y), CosSign);
+		}
+
+		/** atan(T), T in [0, 1] (Abramowitz-Stegun 4.4.49 계열 17차) */
+		template<typename V>
+		inline V AtanPoly(V T)
+		{
+			using O = TOps<V>;
+			const V T2 = O::Mul(T, T);
+			V P = O::Set1(0.0028662257f);
+			P = O::Add(O::Mul(P, T2), O::Set1(-0.0161657367f));
+			P = O::Add(O::Mul(P, T2), O::Set1(0.0429096138f));
+			P = O::Add(O::Mul(P, T2), O::Set1(-0.0752896400f));
+			P = O::Add(O::Mul(P, T2), O::Set1(0.1065626393f));
+			P = O::Add(O::Mul(P, T2), O::Set1(-0.1420889944f));
+			P = O::Add(O::Mul(P, T2), O::Set1(0.1999355085f));
+			P = O::Add(O::Mul(P, T2), O::Set1(-0.3333314528f));
+			P = O::Add(O::Mul(P, T2), O::Set1(1.0f));
+			return O::Mul(P, T);
+		}
+
+		template<typename V>
+		inline V Atan2(V Y, V X)
+		{
+			using O = TOps<V>;
+			const V AbsX = Abs(X);
+			const V AbsY = Abs(Y);
+			const V Hi = O::Max(AbsX, AbsY);
+			const V Lo = O::Min(AbsX, AbsY);
+
+			// 0/0은 NaN이므로 Hi == 0이면 0으로 가림
+			const V T = O::And(O::CmpLt(O::Set1(0.0f), Hi), O::Div(Lo, Hi));
+			V A = AtanPoly(T);
+			A = O::Select(O::CmpLt(AbsX, AbsY), O::Sub(O::Set1(HALF_PI), A), A);
+			A = O::Select(O::CmpLt(X, O::Set1(0.0f)), O::Sub(O::Set1(PI), A), A);
+			return O::Xor(A, SignBit(Y));
+		}
+
+		/** acos(X), |X| <= 1 (Abramowitz-Stegun 4.4.46 계열 7차 * sqrt(1-|X|)) */
+		template<typename V>
+		inline V Acos(V X)
+		{
+			using O = TOps<V>;
+			const V AbsX = Abs(X);
+			const V Root = O::Sqrt(O::Max(O::Sub(O::Set1(1.0f), AbsX), O::Set1(0.0f)));
+
+			V P = O::Set1(-0.0012624911f);
+			P = O::Add(O::Mul(P, AbsX), O::Set1(0.0066700901f));
+			P = O::Add(O::Mul(P, AbsX), O::Set1(-0.0170881256f));
+			P = O::Add(O::Mul(P, AbsX), O::Set1(0.0308918810f));
+			P = O::Add(O::Mul(P, AbsX), O::Set1(-0.0501743046f));
+			P = O::Add(O::Mul(P, AbsX), O::Set1(0.0889789874f));
+			P = O::Add(O::Mul(P, AbsX), O::Set1(-0.2145988016f));
+			P = O::Add(O::Mul(P, AbsX), O::Set1(1.5707963050f));
+			P = O::Mul(P, Root);
+
+			// acos(-X) = PI - acos(X)
+			return O::Select(O::CmpLt(X, O::Set1(0.0f)), O::Sub(O::Set1(PI), P), P);
+		}
+
+		/** 하드웨어 추정값(12비트) + 뉴턴 1회 */
+		template<typename V>
+		inline V Rsqrt(V X)
+		{
+			using O = TOps<V>;
+			const V Y = O::RsqrtEstimate(X);
+			const V HalfXYY = O::Mul(O::Mul(O::Mul(O::Set1(0.5f), X), Y), Y);
+			return O::Mul(Y, O::Sub(O::Set1(1.5f), HalfXYY));
+		}
+
+		template<typename V>
+		inline V Exp2(V X)
+		{
+			using O = TOps<V>;
+
+			// 2^X = 2^N * 2^F, N = round(X), F in [-0.5, 0.5]
+			// X >= 128은 지수 255(무한대), X < -126은 2^-126으로 고정 (비정규 수는 만들지 않음)
+			X = O::Min(O::Max(X, O::Set1(-126.0f)), O::Set1(128.0f));
+			const V N = O::Round(X);
+			const V F = O::Sub(X, N);
+
+			V P = O::Set1(1.535336188e-4f);
+			P = O::Add(O::Mul(P, F), O::Set1(1.339887440e-3f));
+			P = O::Add(O::Mul(P, F), O::Set1(9.618437357e-3f));
+			P = O::Add(O::Mul(P, F), O::Set1(5.550332471e-2f));
+			P = O::Add(O::Mul(P, F), O::Set1(2.402264791e-1f));
+			P = O::Add(O::Mul(P, F), O::Set1(6.931472028e-1f));
+			P = O::Add(O::Mul(P, F), O::Set1(1.0f));
+
+			// 지수 비트 (N + 127) << 23을 float 곱으로 만듦 (최대 254 * 2^23 < 2^31이라 정확)
+			// N == 128은 2^127 * 2로 나눠 곱해야 X in [127.5, 128)이 무한대가 되지 않음
+			const V Extra = O::Max(O::Sub(N, O::Set1(127.0f)), O::Set1(0.0f));
+			const V Scale = O::FromBits(O::Mul(O::Add(O::Sub(N, Extra), O::Set1(127.0f)), O::Set1(8388608.0f)));
+			return O::Mul(O::Mul(P, Scale), O::Add(Extra, O::Set1(1.0f)));
+		}
+
+		template<typename V>
+		inline V Log2(V X)
+		{
+			using O = TOps<V>;
+
+			// X = M * 2^E, M in [1, 2) -> M > sqrt(2)이면 M/2, E+1로 옮겨 M in [sqrt(1/2), sqrt(2))
+			V E = O::Sub(O::Mul(O::ToBits(O::And(X, O::Bits(0x7F800000u))), O::Set1(1.0f / 8388608.0f)), O::Set1(127.0f));
+			V M = O::Or(O::And(X, O::Bits(0x007FFFFFu)), O::Bits(0x3F800000u));
+			const V Shift = O::CmpLt(O::Set1(1.41421356f), M);
+			M = O::Select(Shift, O::Mul(M, O::Set1(0.5f)), M);
+			E = O::Select(Shift, O::Add(E, O::Set1(1.0f)), E);
+
+			// Cephes logf: ln(1 + T) = T - T^2/2 + T^3 * P(T)
+			const V T = O::Sub(M, O::Set1(1.0f));
+			const V T2 = O::Mul(T, T);
+			V P = O::Set1(7.0376836292e-2f);
+			P = O::Add(O::Mul(P, T), O::Set1(-1.1514610310e-1f));
+			P = O::Add(O::Mul(P, T), O::Set1(1.1676998740e-1f));
+			P = O::Add(O::Mul(P, T), O::Set1(-1.2420140846e-1f));
+			P = O::Add(O::Mul(P, T), O::Set1(1.4249322787e-1f));
+			P = O::Add(O::Mul(P, T), O::Set1(-1.6668057665e-1f));
+			P = O::Add(O::Mul(P, T), O::Set1(2.0000714765e-1f));
+			P = O::Add(O::Mul(P, T), O::Set1(-2.4999993993e-1f));
+			P = O::Add(O::Mul(P, T), O::Set1(3.3333331174e-1f));
+			const V Y = O::Sub(O::Mul(O::Mul(T, T2), P), O::Mul(O::Set1(0.5f), T2));
+
+			// log2 = (Y + T) * log2(e) + E, log2(e) = 1 + LOG2EA로 나눠 정밀도 유지
+			const V Log2EA = O::Set1(0.44269504088896340736f);
+			V R = O::Mul(Y, Log2EA);
+			R = O::Add(R, O::Mul(T, Log2EA));
+			R = O::Add(R, Y);
+			R = O::Add(R, T);
+			return O::Add(R, E);
+		}
+	}
+
+	/** 4개씩 (__m128) */
+	namespace Fast4
+	{
+		inline __m128 Sin(__m128 X) { return FastMathDetail::Sin(X); }
+		inline __m128 Cos(__m128 X) { return FastMathDetail::Cos(X); }
+		inline void SinCos(__m128 X, __m128& OutSin, __m128& OutCos) { FastMathDetail::SinCos(X, OutSin, OutCos); }
+		inline __m128 Atan2(__m128 Y, __m128 X) { return FastMathDetail::Atan2(Y, X); }
+		inline __m128 Acos(__m128 X) { return FastMathDetail::Acos(X); }
+		inline __m128 Rsqrt(__m128 X) { return FastMathDetail::Rsqrt(X); }
+		inline __m128 Exp2(__m128 X) { return FastMathDetail::Exp2(X); }
+		inline __m128 Log2(__m128 X) { return FastMathDetail::Log2(X); }
+	}
+
+	/** 8개씩 (__m256, AVX 전용) */
+	namespace Fast8
+	{
+		inline __m256 Sin(__m256 X) { return FastMathDetail::Sin(X); }
+		inline __m256 Cos(__m256 X) { return FastMathDetail::Cos(X); }
+		inline void SinCos(__m256 X, __m256& OutSin, __m256& OutCos) { FastMathDetail::SinCos(X, OutSin, OutCos); }
+		inline __m256 Atan2(__m256 Y, __m256 X) { return FastMathDetail::Atan2(Y, X); }
+		inline __m256 Acos(__m256 X) { return FastMathDetail::Acos(X); }
+		inline __m256 Rsqrt(__m256 X) { return FastMathDetail::Rsqrt(X); }
+		inline __m256 Exp2(__m256 X) { return FastMathDetail::Exp2(X); }
+		inline __m256 Log2(__m256 X) { return FastMathDetail::Log2(X); }
+	}
+
+	/** sin(X). |X| < 2^16 * 2PI. 최대 오차: abs 2.2e-7 (|X| <= 100), 4.4e-6 (|X| ~ 3e5) */
+	inline float FastSin(float X) { return FastMathDetail::Sin(X); }
+
+	/** cos(X). |X| < 2^16 * 2PI. 최대 오차: abs 2.7e-7 (|X| <= 100), 4.5e-6 (|X| ~ 3e5) */
+	inline float FastCos(float X) { return FastMathDetail::Cos(X); }
+
+	/** sin/cos 동시 계산 (범위 축소 1회). 오차는 FastSin/FastCos와 같음 */
+	inline void FastSinCos(float X, float& OutSin, float& OutCos)
+	{
+		FastMathDetail::SinCos(X, OutSin, OutCos);
+	}
+
+	/** atan2(Y, X). 최대 오차: abs 3.1e-7 rad. 부호 있는 0은 구분하지 않음 (atan2(0, -0) = 0) */
+	inline float FastAtan2(float Y, float X) { return FastMathDetail::Atan2(Y, X); }
+
+	/** acos(X). |X| > 1은 0 또는 PI로 고정. 최대 오차: abs 4.1e-7 rad */
+	inline float FastAcos(float X) { return FastMathDetail::Acos(X); }
+
+	/** 1 / sqrt(X), X > 0 (정규 수). 최대 오차: rel 2.7e-7 (4 ulp) */
+	inline float FastRsqrt(float X) { return FastMathDetail::Rsqrt(X); }
+
+	/** 2^X. X >= 128은 무한대, X < -126은 2^-126. 최대 오차: rel 9.7e-8 (1.2 ulp) */
+	inline float FastExp2(float X) { return FastMathDetail::Exp2(X); }
+
+	/** log2(X), X는 양의 정규 수 (0, 음수, 비정규 수, 무한대, NaN은 정의하지 않음). 최대 오차: abs 6.3e-8 ([0.5, 2]), 그 밖은 rel 4.5e-8 */
+	inline float FastLog2(float X) { return FastMathDetail::Log2(X); }
+}
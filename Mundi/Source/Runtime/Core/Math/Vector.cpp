@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "Vector.h"
+#include "VectorBatch.h"
 
 void FVector::Log()
 {
@@ -8,6 +9,20 @@ void FVector::Log()
 	UE_LOG(buf);
 }
 
+FMatrix FMatrix::Inverse() const
+{
+	FMatrix Result;
+	FMath::InverseMatrices(this, &Result, 1);
+	return Result;
+}
+
+FMatrix FMatrix::InverseAffine() const
+{
+	FMatrix Result;
+	FMath::InverseAffineMatrices(this, &Result, 1);
+	return Result;
+}
+
 FQuat::FQuat(const FMatrix& M)
 {
 	// (M은 스케일이 제거된 3x3 회전 행렬이라고 가정)
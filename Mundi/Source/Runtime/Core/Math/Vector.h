@@ -915,8 +915,11 @@ struct alignas(16) FMatrix
 		return Result;
 	}
 
-	// Affine 역행렬 (마지막 행 = [0,0,0,1] 가정)
-	FMatrix InverseAffine() const
+	// Affine 역행렬 (마지막 열 = [0,0,0,1] 가정) - FMath::InverseAffineMatrices (SIMD)
+	FMatrix InverseAffine() const;
+
+	// 스칼라 참조 구현
+	FMatrix InverseAffineScalar() const
 	{
 		// 상단 3x3 역행렬
 		float A00 = M[0][0], A01 = M[0][1], A02 = M[0][2];
@@ -1021,7 +1024,11 @@ struct alignas(16) FMatrix
 		return rot;
 	}
 
-	FMatrix Inverse() const
+	// 일반 역행렬 - FMath::InverseMatrices (SIMD), 특이 행렬은 단위 행렬
+	FMatrix Inverse() const;
+
+	// 스칼라 참조 구현 (여인수 전개)
+	FMatrix InverseScalar() const
 	{
 		FMatrix InverseMatrix;
 		// 원본 행렬(VP_Matrix)의 요소를 로컬 변수로 복사
@@ -0,0 +1,1200 @@
+﻿#include "pch.h"
+#include "VectorBatch.h"
+#include "AABB.h"
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+static_assert(sizeof(FVector) == sizeof(float) * 3, "Batch kernels read FVector arrays as packed floats");
+static_assert(sizeof(FAABB) == sizeof(FVector) * 2, "Batch kernels read FAABB arrays as packed Min/Max pairs");
+static_assert(sizeof(FQuat) == sizeof(float) * 4, "Batch kernels read FQuat arrays as packed floats");
+static_assert(sizeof(FTransform) == sizeof(float) * 10 && offsetof(FTransform, Rotation) == sizeof(float) * 3
+	&& offsetof(FTransform, Scale3D) == sizeof(float) * 7, "Batch kernels read FTransform as packed T(3) R(4) S(3)");
+
+namespace
+{
+	FMath::ESimdLevel DetectSimdLevel()
+	{
+#if defined(_MSC_VER)
+		// AVX 명령 지원 + OS가 YMM 레지스터를 저장/복원하는지(XCR0) 모두 확인
+		int CpuInfo[4];
+		__cpuid(CpuInfo, 1);
+		const bool bOSXSave = (CpuInfo[2] & (1 << 27)) != 0;
+		const bool bAVX = (CpuInfo[2] & (1 << 28)) != 0;
+		if (bOSXSave && bAVX && (_xgetbv(0) & 0x6) == 0x6)
+		{
+			return FMath::ESimdLevel::AVX;
+		}
+		return FMath::ESimdLevel::SSE;
+#else
+		return __builtin_cpu_supports("avx") ? FMath::ESimdLevel::AVX : FMath::ESimdLevel::SSE;
+#endif
+	}
+
+	FMath::ESimdLevel GetSupportedLevel()
+	{
+		static const FMath::ESimdLevel Supported = DetectSimdLevel();
+		return Supported;
+	}
+
+	std::atomic<FMath::ESimdLevel>& GetActiveLevel()
+	{
+		static std::atomic<FMath::ESimdLevel> Active{ GetSupportedLevel() };
+		return Active;
+	}
+
+	/** 4개 단위 (SSE) - 행렬은 한 번에 1개 */
+	struct FSimd4
+	{
+		using V = __m128;
+		static constexpr int32 Width = 4;
+		static constexpr int32 MatrixWidth = 1;
+
+		static V Set1(float F) { return _mm_set1_ps(F); }
+		static V SetLanes(float X, float Y, float Z, float W) { return _mm_setr_ps(X, Y, Z, W); }
+		static V Add(V A, V B) { return _mm_add_ps(A, B); }
+		static V Sub(V A, V B) { return _mm_sub_ps(A, B); }
+		static V Mul(V A, V B) { return _mm_mul_ps(A, B); }
+		static V Div(V A, V B) { return _mm_div_ps(A, B); }
+		static V Min(V A, V B) { return _mm_min_ps(A, B); }
+		static V Max(V A, V B) { return _mm_max_ps(A, B); }
+		static V Sqrt(V A) { return _mm_sqrt_ps(A); }
+		static V And(V A, V B) { return _mm_and_ps(A, B); }
+		static V AndNot(V A, V B) { return _mm_andnot_ps(A, B); }
+		static V Xor(V A, V B) { return _mm_xor_ps(A, B); }
+		static V CmpLt(V A, V B) { return _mm_cmplt_ps(A, B); }
+		/** Mask ? A : B */
+		static V Select(V Mask, V A, V B) { return _mm_or_ps(_mm_and_ps(Mask, A), _mm_andnot_ps(Mask, B)); }
+		static V UnpackLo(V A, V B) { return _mm_unpacklo_ps(A, B); }
+		static V UnpackHi(V A, V B) { return _mm_unpackhi_ps(A, B); }
+		template<int Imm> static V Shuffle(V A, V B) { return _mm_shuffle_ps(A, B, Imm); }
+		template<int Imm> static V Swizzle(V A) { return _mm_shuffle_ps(A, A, Imm); }
+
+		static V LoadRow(const FMatrix* Matrices, int32 Row) { return Matrices[0].Rows[Row]; }
+		static void StoreRow(FMatrix* Matrices, int32 Row, V Value) { Matrices[0].Rows[Row] = Value; }
+
+		static V Load(const float* P) { return _mm_loadu_ps(P); }
+		static void Store(float* P, V A) { _mm_storeu_ps(P, A); }
+
+		/** 원소 하나의 16바이트 청크 (Stride는 원소 간격, float 단위) */
+		static V LoadLane(const float* P, int32 /*Stride*/) { return _mm_loadu_ps(P); }
+		static void StoreLane(float* P, int32 /*Stride*/, V A) { _mm_storeu_ps(P, A); }
+
+		/** FVector 4개(float 12개)를 16바이트 청크 3개로 */
+		static void LoadChunks(const float* P, V& A, V& B, V& C)
+		{
+			A = _mm_loadu_ps(P);
+			B = _mm_loadu_ps(P + 4);
+			C = _mm_loadu_ps(P + 8);
+		}
+
+		static void StoreChunks(float* P, V A, V B, V C)
+		{
+			_mm_storeu_ps(P, A);
+			_mm_storeu_ps(P + 4, B);
+			_mm_storeu_ps(P + 8, C);
+		}
+	};
+
+	/**
+	 * 8개 단위 (AVX) - 128비트 레인마다 FVector 4개씩 (하위: 0~3, 상위: 4~7)
+	 * 행렬은 레인마다 1개씩 한 번에 2개 (하위: 행렬 0의 행, 상위: 행렬 1의 행)
+	 */
+	struct FSimd8
+	{
+		using V = __m256;
+		static constexpr int32 Width = 8;
+		static constexpr int32 MatrixWidth = 2;
+
+		static V Set1(float F) { return _mm256_set1_ps(F); }
+		static V SetLanes(float X, float Y, float Z, float W) { return _mm256_setr_ps(X, Y, Z, W, X, Y, Z, W); }
+		static V Add(V A, V B) { return _mm256_add_ps(A, B); }
+		static V Sub(V A, V B) { return _mm256_sub_ps(A, B); }
+		static V Mul(V A, V B) { return _mm256_mul_ps(A, B); }
+		static V Div(V A, V B) { return _mm256_div_ps(A, B); }
+		static V Min(V A, V B) { return _mm256_min_ps(A, B); }
+		static V Max(V A, V B) { return _mm256_max_ps(A, B); }
+		static V Sqrt(V A) { return _mm256_sqrt_ps(A); }
+		static V And(V A, V B) { return _mm256_and_ps(A, B); }
+		static V AndNot(V A, V B) { return _mm256_andnot_ps(A, B); }
+		static V Xor(V A, V B) { return _mm256_xor_ps(A, B); }
+		static V CmpLt(V A, V B) { return _mm256_cmp_ps(A, B, _CMP_LT_OQ); }
+		static V Select(V Mask, V A, V B) { return _mm256_blendv_ps(B, A, Mask); }
+		static V UnpackLo(V A, V B) { return _mm256_unpacklo_ps(A, B); }
+		static V UnpackHi(V A, V B) { return _mm256_unpackhi_ps(A, B); }
+		template<int Imm> static V Shuffle(V A, V B) { return _mm256_shuffle_ps(A, B, Imm); }
+		template<int Imm> static V Swizzle(V A) { return _mm256_permute_ps(A, Imm); }
+
+		static V LoadRow(const FMatrix* Matrices, int32 Row)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(Matrices[0].Rows[Row]), Matrices[1].Rows[Row], 1);
+		}
+
+		static void StoreRow(FMatrix* Matrices, int32 Row, V Value)
+		{
+			Matrices[0].Rows[Row] = _mm256_castps256_ps128(Value);
+			Matrices[1].Rows[Row] = _mm256_extractf128_ps(Value, 1);
+		}
+
+		static V Load(const float* P) { return _mm256_loadu_ps(P); }
+		static void Store(float* P, V A) { _mm256_storeu_ps(P, A); }
+
+		/** 원소 k와 k + 4의 청크를 하위/상위 레인에 */
+		static V LoadLane(const float* P, int32 Stride)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(P)), _mm_loadu_ps(P + Stride * 4), 1);
+		}
+
+		static void StoreLane(float* P, int32 Stride, V A)
+		{
+			_mm_storeu_ps(P, _mm256_castps256_ps128(A));
+			_mm_storeu_ps(P + Stride * 4, _mm256_extractf128_ps(A, 1));
+		}
+
+		static void LoadChunks(const float* P, V& A, V& B, V& C)
+		{
+			A = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(P)), _mm_loadu_ps(P + 12), 1);
+			B = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(P + 4)), _mm_loadu_ps(P + 16), 1);
+			C = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(P + 8)), _mm_loadu_ps(P + 20), 1);
+		}
+
+		static void StoreChunks(float* P, V A, V B, V C)
+		{
+			_mm_storeu_ps(P, _mm256_castps256_ps128(A));
+			_mm_storeu_ps(P + 4, _mm256_castps256_ps128(B));
+			_mm_storeu_ps(P + 8, _mm256_castps256_ps128(C));
+			_mm_storeu_ps(P + 12, _mm256_extractf128_ps(A, 1));
+			_mm_storeu_ps(P + 16, _mm256_extractf128_ps(B, 1));
+			_mm_storeu_ps(P + 20, _mm256_extractf128_ps(C, 1));
+		}
+	};
+
+	/**
+	 * AoS -> SoA 전치 (레인마다)
+	 * A = [x0 y0 z0 x1], B = [y1 z1 x2 y2], C = [z2 x3 y3 z3]  ->  X = [x0 x1 x2 x3], Y, Z
+	 */
+	template<typename S>
+	inline void LoadSoA(const float* P, typename S::V& X, typename S::V& Y, typename S::V& Z)
+	{
+		typename S::V A, B, C;
+		S::LoadChunks(P, A, B, C);
+		const typename S::V XY = S::template Shuffle<_MM_SHUFFLE(2, 1, 3, 2)>(B, C);   // x2 y2 x3 y3
+		const typename S::V YZ = S::template Shuffle<_MM_SHUFFLE(1, 0, 2, 1)>(A, B);   // y0 z0 y1 z1
+		X = S::template Shuffle<_MM_SHUFFLE(2, 0, 3, 0)>(A, XY);
+		Y = S::template Shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(YZ, XY);
+		Z = S::template Shuffle<_MM_SHUFFLE(3, 0, 3, 1)>(YZ, C);
+	}
+
+	/** SoA -> AoS 전치 (LoadSoA의 역) */
+	template<typename S>
+	inline void StoreSoA(float* P, typename S::V X, typename S::V Y, typename S::V Z)
+	{
+		const typename S::V XY = S::template Shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(X, Y);   // x0 x2 y0 y2
+		const typename S::V YZ = S::template Shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(Y, Z);   // y1 y3 z1 z3
+		const typename S::V ZX = S::template Shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(Z, X);   // z0 z2 x1 x3
+		S::StoreChunks(P,
+			S::template Shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(XY, ZX),
+			S::template Shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(YZ, XY),
+			S::template Shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(ZX, YZ));
+	}
+
+	/** 행렬 원소를 레인 전체에 복제 (AbsValue면 절댓값) */
+	template<typename S>
+	struct TBroadcastMatrix
+	{
+		typename S::V E[4][3];
+
+		TBroadcastMatrix(const FMatrix& M, bool bAbsolute)
+		{
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Col = 0; Col < 3; ++Col)
+				{
+					E[Row][Col] = S::Set1(bAbsolute ? std::fabs(M.M[Row][Col]) : M.M[Row][Col]);
+				}
+			}
+		}
+	};
+
+	/** ((X * M0j + Y * M1j) + Z * M2j) [+ M3j] - 스칼라 구현과 같은 순서 */
+	template<typename S, bool bTranslate>
+	inline void TransformSoA(const TBroadcastMatrix<S>& M, typename S::V X, typename S::V Y, typename S::V Z,
+		typename S::V& OutX, typename S::V& OutY, typename S::V& OutZ)
+	{
+		typename S::V* Outs[3] = { &OutX, &OutY, &OutZ };
+		for (int32 Col = 0; Col < 3; ++Col)
+		{
+			typename S::V R = S::Add(S::Add(S::Mul(X, M.E[0][Col]), S::Mul(Y, M.E[1][Col])), S::Mul(Z, M.E[2][Col]));
+			if constexpr (bTranslate)
+			{
+				R = S::Add(R, M.E[3][Col]);
+			}
+			*Outs[Col] = R;
+		}
+	}
+
+	template<typename S, bool bTranslate>
+	int32 TransformVectorsSimd(const FMatrix& Matrix, const FVector* In, FVector* Out, int32 Count)
+	{
+		const TBroadcastMatrix<S> M(Matrix, false);
+		const float* Src = reinterpret_cast<const float*>(In);
+		float* Dst = reinterpret_cast<float*>(Out);
+
+		int32 Index = 0;
+		for (; Index + S::Width <= Count; Index += S::Width)
+		{
+			typename S::V X, Y, Z, OutX, OutY, OutZ;
+			LoadSoA<S>(Src + Index * 3, X, Y, Z);
+			TransformSoA<S, bTranslate>(M, X, Y, Z, OutX, OutY, OutZ);
+			StoreSoA<S>(Dst + Index * 3, OutX, OutY, OutZ);
+		}
+		return Index;
+	}
+
+	template<typename S>
+	int32 TransformAABBsSimd(const FMatrix& Matrix, const FAABB* In, FAABB* Out, int32 Count)
+	{
+		const TBroadcastMatrix<S> M(Matrix, false);
+		const TBroadcastMatrix<S> AbsM(Matrix, true);
+		const typename S::V Half = S::Set1(0.5f);
+		const float* Src = reinterpret_cast<const float*>(In);
+		float* Dst = reinterpret_cast<float*>(Out);
+
+		// 박스 Width개 = FVector 2*Width개 (Min, Max 교대)
+		int32 Index = 0;
+		for (; Index + S::Width <= Count; Index += S::Width)
+		{
+			typename S::V X0, Y0, Z0, X1, Y1, Z1;
+			LoadSoA<S>(Src + Index * 6, X0, Y0, Z0);
+			LoadSoA<S>(Src + Index * 6 + S::Width * 3, X1, Y1, Z1);
+
+			// [mn0 mx0 mn1 mx1] [mn2 mx2 mn3 mx3] -> Min / Max 분리
+			const typename S::V MinX = S::template Shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(X0, X1);
+			const typename S::V MaxX = S::template Shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(X0, X1);
+			const typename S::V MinY = S::template Shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Y0, Y1);
+			const typename S::V MaxY = S::template Shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(Y0, Y1);
+			const typename S::V MinZ = S::template Shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Z0, Z1);
+			const typename S::V MaxZ = S::template Shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(Z0, Z1);
+
+			typename S::V CX, CY, CZ, EX, EY, EZ;
+			TransformSoA<S, true>(M, S::Mul(S::Add(MinX, MaxX), Half), S::Mul(S::Add(MinY, MaxY), Half), S::Mul(S::Add(MinZ, MaxZ), Half), CX, CY, CZ);
+			TransformSoA<S, false>(AbsM, S::Mul(S::Sub(MaxX, MinX), Half), S::Mul(S::Sub(MaxY, MinY), Half), S::Mul(S::Sub(MaxZ, MinZ), Half), EX, EY, EZ);
+
+			const typename S::V OutMinX = S::Sub(CX, EX), OutMaxX = S::Add(CX, EX);
+			const typename S::V OutMinY = S::Sub(CY, EY), OutMaxY = S::Add(CY, EY);
+			const typename S::V OutMinZ = S::Sub(CZ, EZ), OutMaxZ = S::Add(CZ, EZ);
+
+			StoreSoA<S>(Dst + Index * 6, S::UnpackLo(OutMinX, OutMaxX), S::UnpackLo(OutMinY, OutMaxY), S::UnpackLo(OutMinZ, OutMaxZ));
+			StoreSoA<S>(Dst + Index * 6 + S::Width * 3, S::UnpackHi(OutMinX, OutMaxX), S::UnpackHi(OutMinY, OutMaxY), S::UnpackHi(OutMinZ, OutMaxZ));
+		}
+		return Index;
+	}
+
+	/** 박스별 행렬 - 행렬 행을 그대로 쓰므로 박스 하나씩 SSE로 처리 */
+	void TransformAABBsPerMatrixSSE(const FMatrix* Matrices, const FAABB* In, FAABB* Out, int32 Count)
+	{
+		const __m128 AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const FMatrix& M = Matrices[Index];
+			const FAABB& Box = In[Index];
+
+			const float CX = (Box.Min.X + Box.Max.X) * 0.5f, EX = (Box.Max.X - Box.Min.X) * 0.5f;
+			const float CY = (Box.Min.Y + Box.Max.Y) * 0.5f, EY = (Box.Max.Y - Box.Min.Y) * 0.5f;
+			const float CZ = (Box.Min.Z + Box.Max.Z) * 0.5f, EZ = (Box.Max.Z - Box.Min.Z) * 0.5f;
+
+			const __m128 Center = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+				_mm_mul_ps(_mm_set1_ps(CX), M.Rows[0]),
+				_mm_mul_ps(_mm_set1_ps(CY), M.Rows[1])),
+				_mm_mul_ps(_mm_set1_ps(CZ), M.Rows[2])),
+				M.Rows[3]);
+			const __m128 Extent = _mm_add_ps(_mm_add_ps(
+				_mm_mul_ps(_mm_set1_ps(EX), _mm_and_ps(M.Rows[0], AbsMask)),
+				_mm_mul_ps(_mm_set1_ps(EY), _mm_and_ps(M.Rows[1], AbsMask))),
+				_mm_mul_ps(_mm_set1_ps(EZ), _mm_and_ps(M.Rows[2], AbsMask)));
+
+			alignas(16) float Result[8];
+			_mm_store_ps(Result, _mm_sub_ps(Center, Extent));
+			_mm_store_ps(Result + 4, _mm_add_ps(Center, Extent));
+			Out[Index].Min = FVector(Result[0], Result[1], Result[2]);
+			Out[Index].Max = FVector(Result[4], Result[5], Result[6]);
+		}
+	}
+
+	/**
+	 * 점 Width개(float 3*Width개)를 그대로 읽어 레인별 최소/최대를 누적
+	 * (float 인덱스 k의 성분은 항상 k % 3 이므로 전치가 필요 없음)
+	 */
+	template<typename S>
+	int32 ComputeBoundsSimd(const FVector* Points, int32 Count, FVector& InOutMin, FVector& InOutMax)
+	{
+		const float* Src = reinterpret_cast<const float*>(Points);
+		typename S::V Min[3], Max[3];
+		for (int32 i = 0; i < 3; ++i)
+		{
+			Min[i] = S::Set1(FLT_MAX);
+			Max[i] = S::Set1(-FLT_MAX);
+		}
+
+		int32 Index = 0;
+		for (; Index + S::Width <= Count; Index += S::Width)
+		{
+			for (int32 i = 0; i < 3; ++i)
+			{
+				const typename S::V P = S::Load(Src + Index * 3 + i * S::Width);
+				Min[i] = S::Min(P, Min[i]);
+				Max[i] = S::Max(P, Max[i]);
+			}
+		}
+
+		float MinLanes[3 * S::Width], MaxLanes[3 * S::Width];
+		for (int32 i = 0; i < 3; ++i)
+		{
+			S::Store(MinLanes + i * S::Width, Min[i]);
+			S::Store(MaxLanes + i * S::Width, Max[i]);
+		}
+		for (int32 k = 0; k < 3 * S::Width; ++k)
+		{
+			float& OutMin = (&InOutMin.X)[k % 3];
+			float& OutMax = (&InOutMax.X)[k % 3];
+			OutMin = MinLanes[k] < OutMin ? MinLanes[k] : OutMin;
+			OutMax = MaxLanes[k] > OutMax ? MaxLanes[k] : OutMax;
+		}
+		return Index;
+	}
+
+	/** 레인 안 재배치 - 결과 = (A[X], A[Y], A[Z], A[W]) */
+	template<typename S, int X, int Y, int Z, int W>
+	inline typename S::V Swz(typename S::V A)
+	{
+		return S::template Swizzle<_MM_SHUFFLE(W, Z, Y, X)>(A);
+	}
+
+	/** 레인 안 두 벡터 섞기 - 결과 = (A[X], A[Y], B[Z], B[W]) */
+	template<typename S, int X, int Y, int Z, int W>
+	inline typename S::V Shuf(typename S::V A, typename S::V B)
+	{
+		return S::template Shuffle<_MM_SHUFFLE(W, Z, Y, X)>(A, B);
+	}
+
+	/** 레인 4개 합을 모든 레인에 */
+	template<typename S>
+	inline typename S::V HorizontalSum(typename S::V A)
+	{
+		A = S::Add(A, Swz<S, 2, 3, 0, 1>(A));
+		return S::Add(A, Swz<S, 1, 0, 3, 2>(A));
+	}
+
+	template<typename S>
+	inline typename S::V Abs(typename S::V A)
+	{
+		return S::AndNot(S::Set1(-0.0f), A);
+	}
+
+	/** 행렬 곱 - FVector4 * FMatrix와 같은 순서로 누적 (operator*와 비트 단위 동일) */
+	template<typename S>
+	int32 MultiplyMatricesSimd(const FMatrix* A, const FMatrix* B, FMatrix* Out, int32 Count)
+	{
+		int32 Index = 0;
+		for (; Index + S::MatrixWidth <= Count; Index += S::MatrixWidth)
+		{
+			const typename S::V B0 = S::LoadRow(B + Index, 0), B1 = S::LoadRow(B + Index, 1);
+			const typename S::V B2 = S::LoadRow(B + Index, 2), B3 = S::LoadRow(B + Index, 3);
+
+			typename S::V Rows[4];
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				const typename S::V ARow = S::LoadRow(A + Index, Row);
+				typename S::V R = S::Mul(Swz<S, 0, 0, 0, 0>(ARow), B0);
+				R = S::Add(R, S::Mul(Swz<S, 1, 1, 1, 1>(ARow), B1));
+				R = S::Add(R, S::Mul(Swz<S, 2, 2, 2, 2>(ARow), B2));
+				R = S::Add(R, S::Mul(Swz<S, 3, 3, 3, 3>(ARow), B3));
+				Rows[Row] = R;
+			}
+
+			// Out이 A/B와 같아도 되도록 모두 읽은 뒤 저장
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				S::StoreRow(Out + Index, Row, Rows[Row]);
+			}
+		}
+		return Index;
+	}
+
+	/**
+	 * 일반 4x4 역행렬 - 2x2 블록으로 나눈 크라메르 공식
+	 * M = | A B |  (A~D는 2x2, 레지스터 하나에 행 우선으로)
+	 *     | C D |
+	 * |M| = |A||D| + |B||C| - tr((A#B)(D#C)),  A# = A의 수반 행렬
+	 */
+	template<typename S>
+	int32 InverseMatricesSimd(const FMatrix* In, FMatrix* Out, int32 Count)
+	{
+		using V = typename S::V;
+
+		// 2x2 행렬 곱 A*B, A#*B, A*B#
+		auto Mat2Mul = [](V A, V B) { return S::Add(S::Mul(A, Swz<S, 0, 3, 0, 3>(B)), S::Mul(Swz<S, 1, 0, 3, 2>(A), Swz<S, 2, 1, 2, 1>(B))); };
+		auto Mat2AdjMul = [](V A, V B) { return S::Sub(S::Mul(Swz<S, 3, 3, 0, 0>(A), B), S::Mul(Swz<S, 1, 1, 2, 2>(A), Swz<S, 2, 3, 0, 1>(B))); };
+		auto Mat2MulAdj = [](V A, V B) { return S::Sub(S::Mul(A, Swz<S, 3, 0, 3, 0>(B)), S::Mul(Swz<S, 1, 0, 3, 2>(A), Swz<S, 2, 1, 2, 1>(B))); };
+
+		const V AdjSign = S::SetLanes(1.0f, -1.0f, -1.0f, 1.0f);
+		const V Epsilon = S::Set1(KINDA_SMALL_NUMBER);
+
+		int32 Index = 0;
+		for (; Index + S::MatrixWidth <= Count; Index += S::MatrixWidth)
+		{
+			const V R0 = S::LoadRow(In + Index, 0), R1 = S::LoadRow(In + Index, 1);
+			const V R2 = S::LoadRow(In + Index, 2), R3 = S::LoadRow(In + Index, 3);
+
+			const V A = Shuf<S, 0, 1, 0, 1>(R0, R1);
+			const V B = Shuf<S, 2, 3, 2, 3>(R0, R1);
+			const V C = Shuf<S, 0, 1, 0, 1>(R2, R3);
+			const V D = Shuf<S, 2, 3, 2, 3>(R2, R3);
+
+			// (|A|, |B|, |C|, |D|)
+			const V DetSub = S::Sub(
+				S::Mul(Shuf<S, 0, 2, 0, 2>(R0, R2), Shuf<S, 1, 3, 1, 3>(R1, R3)),
+				S::Mul(Shuf<S, 1, 3, 1, 3>(R0, R2), Shuf<S, 0, 2, 0, 2>(R1, R3)));
+			const V DetA = Swz<S, 0, 0, 0, 0>(DetSub);
+			const V DetB = Swz<S, 1, 1, 1, 1>(DetSub);
+			const V DetC = Swz<S, 2, 2, 2, 2>(DetSub);
+			const V DetD = Swz<S, 3, 3, 3, 3>(DetSub);
+
+			const V D_C = Mat2AdjMul(D, C);
+			const V A_B = Mat2AdjMul(A, B);
+
+			// 역행렬 = 1/|M| * | X Y |  (각 블록의 수반 행렬 X#, Y#, Z#, W#를 먼저 계산)
+			//                  | Z W |
+			V X_ = S::Sub(S::Mul(DetD, A), Mat2Mul(B, D_C));
+			V W_ = S::Sub(S::Mul(DetA, D), Mat2Mul(C, A_B));
+			V Y_ = S::Sub(S::Mul(DetB, C), Mat2MulAdj(D, A_B));
+			V Z_ = S::Sub(S::Mul(DetC, B), Mat2MulAdj(A, D_C));
+
+			const V Trace = HorizontalSum<S>(S::Mul(A_B, Swz<S, 0, 2, 1, 3>(D_C)));
+			const V DetM = S::Sub(S::Add(S::Mul(DetA, DetD), S::Mul(DetB, DetC)), Trace);
+
+			const V RcpDetM = S::Div(AdjSign, DetM);
+			X_ = S::Mul(X_, RcpDetM);
+			Y_ = S::Mul(Y_, RcpDetM);
+			Z_ = S::Mul(Z_, RcpDetM);
+			W_ = S::Mul(W_, RcpDetM);
+
+			// 특이 행렬은 스칼라 구현과 같이 단위 행렬
+			const V Singular = S::CmpLt(Abs<S>(DetM), Epsilon);
+
+			// 수반 행렬의 전치와 저장 순서를 한 번에 적용
+			S::StoreRow(Out + Index, 0, S::Select(Singular, S::SetLanes(1.0f, 0.0f, 0.0f, 0.0f), Shuf<S, 3, 1, 3, 1>(X_, Y_)));
+			S::StoreRow(Out + Index, 1, S::Select(Singular, S::SetLanes(0.0f, 1.0f, 0.0f, 0.0f), Shuf<S, 2, 0, 2, 0>(X_, Y_)));
+			S::StoreRow(Out + Index, 2, S::Select(Singular, S::SetLanes(0.0f, 0.0f, 1.0f, 0.0f), Shuf<S, 3, 1, 3, 1>(Z_, W_)));
+			S::StoreRow(Out + Index, 3, S::Select(Singular, S::SetLanes(0.0f, 0.0f, 0.0f, 1.0f), Shuf<S, 2, 0, 2, 0>(Z_, W_)));
+		}
+		return Index;
+	}
+
+	/**
+	 * 아핀 역행렬 (마지막 열 = [0,0,0,1] 가정)
+	 * 3x3 부분의 행이 a, b, c 일 때 역행렬의 열은 (b x c, c x a, a x b) / (a . (b x c))
+	 */
+	template<typename S>
+	int32 InverseAffineMatricesSimd(const FMatrix* In, FMatrix* Out, int32 Count)
+	{
+		using V = typename S::V;
+
+		auto Cross = [](V U, V W)
+			{
+				return S::Sub(S::Mul(Swz<S, 1, 2, 0, 3>(U), Swz<S, 2, 0, 1, 3>(W)), S::Mul(Swz<S, 2, 0, 1, 3>(U), Swz<S, 1, 2, 0, 3>(W)));
+			};
+
+		const V Zero = S::Set1(0.0f);
+		const V Epsilon = S::Set1(KINDA_SMALL_NUMBER);
+		const V UnitW = S::SetLanes(0.0f, 0.0f, 0.0f, 1.0f);
+
+		int32 Index = 0;
+		for (; Index + S::MatrixWidth <= Count; Index += S::MatrixWidth)
+		{
+			const V RowA = S::LoadRow(In + Index, 0), RowB = S::LoadRow(In + Index, 1);
+			const V RowC = S::LoadRow(In + Index, 2), RowT = S::LoadRow(In + Index, 3);
+
+			const V C0 = Cross(RowB, RowC);
+			const V C1 = Cross(RowC, RowA);
+			const V C2 = Cross(RowA, RowB);
+			const V Det = HorizontalSum<S>(S::Mul(RowA, C0));
+			const V InvDet = S::Div(S::Set1(1.0f), Det);
+
+			// (C0, C1, C2)를 열로 세움 (w 성분은 0)
+			const V T0 = S::UnpackLo(C0, C1);
+			const V T1 = S::UnpackLo(C2, Zero);
+			const V T2 = S::UnpackHi(C0, C1);
+			const V T3 = S::UnpackHi(C2, Zero);
+			const V Inv0 = S::Mul(Shuf<S, 0, 1, 0, 1>(T0, T1), InvDet);
+			const V Inv1 = S::Mul(Shuf<S, 2, 3, 2, 3>(T0, T1), InvDet);
+			const V Inv2 = S::Mul(Shuf<S, 0, 1, 0, 1>(T2, T3), InvDet);
+
+			// invT = -t * Rinv, w = 1
+			V InvT = S::Mul(Swz<S, 0, 0, 0, 0>(RowT), Inv0);
+			InvT = S::Add(InvT, S::Mul(Swz<S, 1, 1, 1, 1>(RowT), Inv1));
+			InvT = S::Add(InvT, S::Mul(Swz<S, 2, 2, 2, 2>(RowT), Inv2));
+			InvT = S::Add(S::Sub(Zero, InvT), UnitW);
+
+			const V Singular = S::CmpLt(Abs<S>(Det), Epsilon);
+			S::StoreRow(Out + Index, 0, S::Select(Singular, S::SetLanes(1.0f, 0.0f, 0.0f, 0.0f), Inv0));
+			S::StoreRow(Out + Index, 1, S::Select(Singular, S::SetLanes(0.0f, 1.0f, 0.0f, 0.0f), Inv1));
+			S::StoreRow(Out + Index, 2, S::Select(Singular, S::SetLanes(0.0f, 0.0f, 1.0f, 0.0f), Inv2));
+			S::StoreRow(Out + Index, 3, S::Select(Singular, UnitW, InvT));
+		}
+		return Index;
+	}
+
+	/** 레인마다 4x4 전치 (자기 자신이 역) */
+	template<typename S>
+	inline void Transpose4(typename S::V (&R)[4])
+	{
+		const typename S::V T0 = S::UnpackLo(R[0], R[1]);
+		const typename S::V T1 = S::UnpackLo(R[2], R[3]);
+		const typename S::V T2 = S::UnpackHi(R[0], R[1]);
+		const typename S::V T3 = S::UnpackHi(R[2], R[3]);
+		R[0] = Shuf<S, 0, 1, 0, 1>(T0, T1);
+		R[1] = Shuf<S, 2, 3, 2, 3>(T0, T1);
+		R[2] = Shuf<S, 0, 1, 0, 1>(T2, T3);
+		R[3] = Shuf<S, 2, 3, 2, 3>(T2, T3);
+	}
+
+	/** 원소 Width개의 청크(P + 원소 * Stride)를 그대로 (AoS) */
+	template<typename S>
+	inline void LoadLanes(const float* P, int32 Stride, typename S::V (&R)[4])
+	{
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			R[Lane] = S::LoadLane(P + Lane * Stride, Stride);
+		}
+	}
+
+	template<typename S>
+	inline void StoreLanes(float* P, int32 Stride, const typename S::V (&R)[4])
+	{
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			S::StoreLane(P + Lane * Stride, Stride, R[Lane]);
+		}
+	}
+
+	/** SoA 쿼터니언 Width개 */
+	template<typename S>
+	struct TQuatSoA
+	{
+		typename S::V X, Y, Z, W;
+
+		static TQuatSoA Load(const float* P, int32 Stride)
+		{
+			typename S::V R[4];
+			LoadLanes<S>(P, Stride, R);
+			Transpose4<S>(R);
+			return { R[0], R[1], R[2], R[3] };
+		}
+
+		void Store(float* P, int32 Stride) const
+		{
+			typename S::V R[4] = { X, Y, Z, W };
+			Transpose4<S>(R);
+			StoreLanes<S>(P, Stride, R);
+		}
+	};
+
+	/** FQuat::Dot과 같은 순서 */
+	template<typename S>
+	inline typename S::V QuatDot(const TQuatSoA<S>& A, const TQuatSoA<S>& B)
+	{
+		return S::Add(S::Add(S::Add(S::Mul(A.X, B.X), S::Mul(A.Y, B.Y)), S::Mul(A.Z, B.Z)), S::Mul(A.W, B.W));
+	}
+
+	/** FQuat::operator*와 같은 순서 */
+	template<typename S>
+	inline TQuatSoA<S> QuatMultiply(const TQuatSoA<S>& A, const TQuatSoA<S>& B)
+	{
+		TQuatSoA<S> R;
+		R.X = S::Sub(S::Add(S::Add(S::Mul(A.W, B.X), S::Mul(A.X, B.W)), S::Mul(A.Y, B.Z)), S::Mul(A.Z, B.Y));
+		R.Y = S::Add(S::Add(S::Sub(S::Mul(A.W, B.Y), S::Mul(A.X, B.Z)), S::Mul(A.Y, B.W)), S::Mul(A.Z, B.X));
+		R.Z = S::Add(S::Sub(S::Add(S::Mul(A.W, B.Z), S::Mul(A.X, B.Y)), S::Mul(A.Y, B.X)), S::Mul(A.Z, B.W));
+		R.W = S::Sub(S::Sub(S::Sub(S::Mul(A.W, B.W), S::Mul(A.X, B.X)), S::Mul(A.Y, B.Y)), S::Mul(A.Z, B.Z));
+		return R;
+	}
+
+	/** FQuat::Normalize와 같은 결과 (길이가 KINDA_SMALL_NUMBER 이하면 단위 쿼터니언) */
+	template<typename S>
+	inline void QuatNormalize(TQuatSoA<S>& Q)
+	{
+		const typename S::V Size = S::Sqrt(QuatDot<S>(Q, Q));
+		const typename S::V Valid = S::CmpLt(S::Set1(KINDA_SMALL_NUMBER), Size);
+		const typename S::V Zero = S::Set1(0.0f);
+		Q.X = S::Select(Valid, S::Div(Q.X, Size), Zero);
+		Q.Y = S::Select(Valid, S::Div(Q.Y, Size), Zero);
+		Q.Z = S::Select(Valid, S::Div(Q.Z, Size), Zero);
+		Q.W = S::Select(Valid, S::Div(Q.W, Size), S::Set1(1.0f));
+	}
+
+	/** 내적이 음수인 레인은 B를 뒤집어 최단 경로로. OutCos = |A . B| */
+	template<typename S>
+	inline TQuatSoA<S> AlignHemisphere(const TQuatSoA<S>& A, const TQuatSoA<S>& B, typename S::V& OutCos)
+	{
+		const typename S::V Dot = QuatDot<S>(A, B);
+		const typename S::V Sign = S::And(S::CmpLt(Dot, S::Set1(0.0f)), S::Set1(-0.0f));
+		OutCos = S::Xor(Dot, Sign);
+		return { S::Xor(B.X, Sign), S::Xor(B.Y, Sign), S::Xor(B.Z, Sign), S::Xor(B.W, Sign) };
+	}
+
+	/** FQuat::Nlerp와 같은 순서 (비트 단위 동일) */
+	template<typename S>
+	inline TQuatSoA<S> QuatNlerp(const TQuatSoA<S>& A, const TQuatSoA<S>& B, typename S::V Alpha)
+	{
+		typename S::V Cos;
+		const TQuatSoA<S> End = AlignHemisphere<S>(A, B, Cos);
+		TQuatSoA<S> R;
+		R.X = S::Add(A.X, S::Mul(S::Sub(End.X, A.X), Alpha));
+		R.Y = S::Add(A.Y, S::Mul(S::Sub(End.Y, A.Y), Alpha));
+		R.Z = S::Add(A.Z, S::Mul(S::Sub(End.Z, A.Z), Alpha));
+		R.W = S::Add(A.W, S::Mul(S::Sub(End.W, A.W), Alpha));
+		QuatNormalize<S>(R);
+		return R;
+	}
+
+	/**
+	 * sin(T * Theta) / sin(Theta)를 cos(Theta) - 1의 다항식으로 (acos/sin 없이)
+	 * D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP" - 8항 + 마지막 항 보정, 오차 ~1e-6
+	 */
+	template<typename S>
+	inline typename S::V SlerpWeight(typename S::V T, typename S::V CosMinusOne)
+	{
+		constexpr float OnePlusMu = 1.90110745351730037f;
+		static constexpr float U[8] = {
+			1.0f / (1 * 3), 1.0f / (2 * 5), 1.0f / (3 * 7), 1.0f / (4 * 9),
+			1.0f / (5 * 11), 1.0f / (6 * 13), 1.0f / (7 * 15), OnePlusMu / (8 * 17) };
+		static constexpr float V[8] = {
+			1.0f / 3, 2.0f / 5, 3.0f / 7, 4.0f / 9,
+			5.0f / 11, 6.0f / 13, 7.0f / 15, OnePlusMu * 8 / 17 };
+
+		const typename S::V One = S::Set1(1.0f);
+		const typename S::V T2 = S::Mul(T, T);
+		typename S::V Acc = One;
+		for (int32 Term = 7; Term >= 0; --Term)
+		{
+			const typename S::V B = S::Mul(S::Sub(S::Mul(S::Set1(U[Term]), T2), S::Set1(V[Term])), CosMinusOne);
+			Acc = S::Add(One, S::Mul(B, Acc));
+		}
+		return S::Mul(T, Acc);
+	}
+
+	/** 최단 경로 Slerp (다항식 가중치) 후 정규화 */
+	template<typename S>
+	inline TQuatSoA<S> QuatSlerp(const TQuatSoA<S>& A, const TQuatSoA<S>& B, typename S::V Alpha)
+	{
+		typename S::V Cos;
+		const TQuatSoA<S> End = AlignHemisphere<S>(A, B, Cos);
+		const typename S::V CosMinusOne = S::Sub(Cos, S::Set1(1.0f));
+		const typename S::V WeightA = SlerpWeight<S>(S::Sub(S::Set1(1.0f), Alpha), CosMinusOne);
+		const typename S::V WeightB = SlerpWeight<S>(Alpha, CosMinusOne);
+		TQuatSoA<S> R;
+		R.X = S::Add(S::Mul(A.X, WeightA), S::Mul(End.X, WeightB));
+		R.Y = S::Add(S::Mul(A.Y, WeightA), S::Mul(End.Y, WeightB));
+		R.Z = S::Add(S::Mul(A.Z, WeightA), S::Mul(End.Z, WeightB));
+		R.W = S::Add(S::Mul(A.W, WeightA), S::Mul(End.W, WeightB));
+		QuatNormalize<S>(R);
+		return R;
+	}
+
+	template<typename S>
+	inline TQuatSoA<S> QuatBlend(const TQuatSoA<S>& A, const TQuatSoA<S>& B, typename S::V Alpha, FMath::EQuatBlend Mode)
+	{
+		return Mode == FMath::EQuatBlend::Slerp ? QuatSlerp<S>(A, B, Alpha) : QuatNlerp<S>(A, B, Alpha);
+	}
+
+	constexpr int32 QuatStride = 4;
+	constexpr int32 TransformStride = 10;
+	constexpr int32 TransformRotationOffset = 3;
+	constexpr int32 TransformScaleOffset = 6;   // 청크 = (Rotation.W, Scale3D.X, Scale3D.Y, Scale3D.Z)
+
+	/*
+	 * 아래 블록 커널은 원소 S::Width개를 한 번에 처리합니다. (입력을 모두 읽은 뒤 저장하므로 Out == A/B 허용)
+	 * FTransform은 T/R/S가 float 10개로 붙어 있어, 이동/스케일은 회전 성분이 섞인 16바이트 청크로 읽고
+	 * 회전 청크를 마지막에 저장해 겹친 성분을 덮어씁니다. (구조체 밖은 읽거나 쓰지 않음)
+	 */
+	struct FBlendRotationsBlock
+	{
+		float Alpha;
+		FMath::EQuatBlend Mode;
+
+		template<typename S>
+		void Run(const FQuat* A, const FQuat* B, FQuat* Out) const
+		{
+			const TQuatSoA<S> QA = TQuatSoA<S>::Load(&A->X, QuatStride);
+			const TQuatSoA<S> QB = TQuatSoA<S>::Load(&B->X, QuatStride);
+			QuatBlend<S>(QA, QB, S::Set1(Alpha), Mode).Store(&Out->X, QuatStride);
+		}
+	};
+
+	struct FMultiplyQuatsBlock
+	{
+		template<typename S>
+		void Run(const FQuat* A, const FQuat* B, FQuat* Out) const
+		{
+			const TQuatSoA<S> QA = TQuatSoA<S>::Load(&A->X, QuatStride);
+			const TQuatSoA<S> QB = TQuatSoA<S>::Load(&B->X, QuatStride);
+			QuatMultiply<S>(QA, QB).Store(&Out->X, QuatStride);
+		}
+	};
+
+	struct FNormalizeQuatsBlock
+	{
+		template<typename S>
+		void Run(const FQuat* In, const FQuat* /*Unused*/, FQuat* Out) const
+		{
+			TQuatSoA<S> Q = TQuatSoA<S>::Load(&In->X, QuatStride);
+			QuatNormalize<S>(Q);
+			Q.Store(&Out->X, QuatStride);
+		}
+	};
+
+	/** 이동/스케일은 FVector::Lerp, 회전은 QuatBlend */
+	struct FBlendTransformsBlock
+	{
+		float Alpha;
+		FMath::EQuatBlend Mode;
+
+		template<typename S>
+		void Run(const FTransform* A, const FTransform* B, FTransform* Out) const
+		{
+			const float* PA = &A->Translation.X;
+			const float* PB = &B->Translation.X;
+			float* POut = &Out->Translation.X;
+			const typename S::V VAlpha = S::Set1(Alpha);
+
+			// 성분별 보간이라 전치 없이 청크 그대로
+			typename S::V TA[4], TB[4], SA[4], SB[4];
+			LoadLanes<S>(PA, TransformStride, TA);
+			LoadLanes<S>(PB, TransformStride, TB);
+			LoadLanes<S>(PA + TransformScaleOffset, TransformStride, SA);
+			LoadLanes<S>(PB + TransformScaleOffset, TransformStride, SB);
+			const TQuatSoA<S> RA = TQuatSoA<S>::Load(PA + TransformRotationOffset, TransformStride);
+			const TQuatSoA<S> RB = TQuatSoA<S>::Load(PB + TransformRotationOffset, TransformStride);
+
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				TA[Lane] = S::Add(TA[Lane], S::Mul(S::Sub(TB[Lane], TA[Lane]), VAlpha));
+				SA[Lane] = S::Add(SA[Lane], S::Mul(S::Sub(SB[Lane], SA[Lane]), VAlpha));
+			}
+			const TQuatSoA<S> R = QuatBlend<S>(RA, RB, VAlpha, Mode);
+
+			StoreLanes<S>(POut, TransformStride, TA);
+			StoreLanes<S>(POut + TransformScaleOffset, TransformStride, SA);
+			R.Store(POut + TransformRotationOffset, TransformStride);
+		}
+	};
+
+	/** Out = Parent.GetWorldTransform(Local)과 같은 순서 */
+	struct FComposeTransformsBlock
+	{
+		template<typename S>
+		void Run(const FTransform* Parents, const FTransform* Locals, FTransform* Out) const
+		{
+			using V = typename S::V;
+			const float* PP = &Parents->Translation.X;
+			const float* PL = &Locals->Translation.X;
+			float* POut = &Out->Translation.X;
+
+			// 전치 후 행: 이동 = (X, Y, Z, -), 스케일 = (-, X, Y, Z)
+			V PT[4], LT[4], PS[4], LS[4];
+			LoadLanes<S>(PP, TransformStride, PT);
+			LoadLanes<S>(PL, TransformStride, LT);
+			LoadLanes<S>(PP + TransformScaleOffset, TransformStride, PS);
+			LoadLanes<S>(PL + TransformScaleOffset, TransformStride, LS);
+			const TQuatSoA<S> PR = TQuatSoA<S>::Load(PP + TransformRotationOffset, TransformStride);
+			const TQuatSoA<S> LR = TQuatSoA<S>::Load(PL + TransformRotationOffset, TransformStride);
+
+			// 스케일은 성분별 곱이라 청크 그대로
+			V OutS[4];
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				OutS[Lane] = S::Mul(PS[Lane], LS[Lane]);
+			}
+
+			Transpose4<S>(PT);
+			Transpose4<S>(LT);
+			Transpose4<S>(PS);
+
+			// Scaled = Local.T * Parent.S
+			const V VX = S::Mul(LT[0], PS[1]);
+			const V VY = S::Mul(LT[1], PS[2]);
+			const V VZ = S::Mul(LT[2], PS[3]);
+
+			// FQuat::RotateVector: v + w * t + cross(q.xyz, t),  t = 2 * cross(q.xyz, v)
+			const V Two = S::Set1(2.0f);
+			const V TX = S::Mul(Two, S::Sub(S::Mul(PR.Y, VZ), S::Mul(PR.Z, VY)));
+			const V TY = S::Mul(Two, S::Sub(S::Mul(PR.Z, VX), S::Mul(PR.X, VZ)));
+			const V TZ = S::Mul(Two, S::Sub(S::Mul(PR.X, VY), S::Mul(PR.Y, VX)));
+			V RX = S::Add(S::Add(VX, S::Mul(PR.W, TX)), S::Sub(S::Mul(PR.Y, TZ), S::Mul(PR.Z, TY)));
+			V RY = S::Add(S::Add(VY, S::Mul(PR.W, TY)), S::Sub(S::Mul(PR.Z, TX), S::Mul(PR.X, TZ)));
+			V RZ = S::Add(S::Add(VZ, S::Mul(PR.W, TZ)), S::Sub(S::Mul(PR.X, TY), S::Mul(PR.Y, TX)));
+
+			// 길이 제곱이 KINDA_SMALL_NUMBER 이하인 회전은 회전하지 않음
+			const V Rotatable = S::CmpLt(S::Set1(KINDA_SMALL_NUMBER), QuatDot<S>(PR, PR));
+			RX = S::Select(Rotatable, RX, VX);
+			RY = S::Select(Rotatable, RY, VY);
+			RZ = S::Select(Rotatable, RZ, VZ);
+
+			V OutT[4] = { S::Add(PT[0], RX), S::Add(PT[1], RY), S::Add(PT[2], RZ), PT[3] };
+			Transpose4<S>(OutT);
+
+			TQuatSoA<S> OutR = QuatMultiply<S>(PR, LR);
+			QuatNormalize<S>(OutR);
+
+			StoreLanes<S>(POut, TransformStride, OutT);
+			StoreLanes<S>(POut + TransformScaleOffset, TransformStride, OutS);
+			OutR.Store(POut + TransformRotationOffset, TransformStride);
+		}
+	};
+
+	/**
+	 * 블록 커널을 AVX(8개) -> SSE(4개) 순으로 돌리고, 남은 원소는 단위 값으로 채운 4개 블록으로 처리
+	 * (꼬리도 같은 SIMD 경로를 타서 배열 위치와 관계없이 결과가 같음)
+	 */
+	template<typename FBlock, typename T>
+	void RunBlocks(const FBlock& Block, const T* A, const T* B, T* Out, int32 Count)
+	{
+		int32 Index = 0;
+		if (FMath::GetSimdLevel() == FMath::ESimdLevel::AVX)
+		{
+			for (; Index + FSimd8::Width <= Count; Index += FSimd8::Width)
+			{
+				Block.template Run<FSimd8>(A + Index, B + Index, Out + Index);
+			}
+		}
+		for (; Index + FSimd4::Width <= Count; Index += FSimd4::Width)
+		{
+			Block.template Run<FSimd4>(A + Index, B + Index, Out + Index);
+		}
+
+		const int32 Remaining = Count - Index;
+		if (Remaining > 0)
+		{
+			T PadA[FSimd4::Width], PadB[FSimd4::Width], PadOut[FSimd4::Width];
+			for (int32 Pad = 0; Pad < Remaining; ++Pad)
+			{
+				PadA[Pad] = A[Index + Pad];
+				PadB[Pad] = B[Index + Pad];
+			}
+			Block.template Run<FSimd4>(PadA, PadB, PadOut);
+			for (int32 Pad = 0; Pad < Remaining; ++Pad)
+			{
+				Out[Index + Pad] = PadOut[Pad];
+			}
+		}
+	}
+
+	void AccumulateBounds(const FVector* Points, int32 Count, FVector& InOutMin, FVector& InOutMax)
+	{
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const FVector& P = Points[Index];
+			InOutMin.X = P.X < InOutMin.X ? P.X : InOutMin.X;
+			InOutMin.Y = P.Y < InOutMin.Y ? P.Y : InOutMin.Y;
+			InOutMin.Z = P.Z < InOutMin.Z ? P.Z : InOutMin.Z;
+			InOutMax.X = P.X > InOutMax.X ? P.X : InOutMax.X;
+			InOutMax.Y = P.Y > InOutMax.Y ? P.Y : InOutMax.Y;
+			InOutMax.Z = P.Z > InOutMax.Z ? P.Z : InOutMax.Z;
+		}
+	}
+}
+
+FMath::ESimdLevel FMath::GetSimdLevel()
+{
+	return GetActiveLevel().load(std::memory_order_relaxed);
+}
+
+void FMath::SetSimdLevel(ESimdLevel Level)
+{
+	GetActiveLevel().store(Level < GetSupportedLevel() ? Level : GetSupportedLevel(), std::memory_order_relaxed);
+}
+
+void FMath::TransformPositions(const FMatrix& M, const FVector* In, FVector* Out, int32 Count)
+{
+	int32 Done = 0;
+	switch (GetSimdLevel())
+	{
+	case ESimdLevel::AVX: Done = TransformVectorsSimd<FSimd8, true>(M, In, Out, Count); break;
+	case ESimdLevel::SSE: Done = TransformVectorsSimd<FSimd4, true>(M, In, Out, Count); break;
+	default: break;
+	}
+	Scalar::TransformPositions(M, In + Done, Out + Done, Count - Done);
+}
+
+void FMath::TransformDirections(const FMatrix& M, const FVector* In, FVector* Out, int32 Count)
+{
+	int32 Done = 0;
+	switch (GetSimdLevel())
+	{
+	case ESimdLevel::AVX: Done = TransformVectorsSimd<FSimd8, false>(M, In, Out, Count); break;
+	case ESimdLevel::SSE: Done = TransformVectorsSimd<FSimd4, false>(M, In, Out, Count); break;
+	default: break;
+	}
+	Scalar::TransformDirections(M, In + Done, Out + Done, Count - Done);
+}
+
+void FMath::TransformAABBs(const FMatrix& M, const FAABB* In, FAABB* Out, int32 Count)
+{
+	int32 Done = 0;
+	switch (GetSimdLevel())
+	{
+	case ESimdLevel::AVX: Done = TransformAABBsSimd<FSimd8>(M, In, Out, Count); break;
+	case ESimdLevel::SSE: Done = TransformAABBsSimd<FSimd4>(M, In, Out, Count); break;
+	default: break;
+	}
+	Scalar::TransformAABBs(M, In + Done, Out + Done, Count - Done);
+}
+
+void FMath::TransformAABBs(const FMatrix* Matrices, const FAABB* In, FAABB* Out, int32 Count)
+{
+	if (GetSimdLevel() == ESimdLevel::Scalar)
+	{
+		Scalar::TransformAABBs(Matrices, In, Out, Count);
+		return;
+	}
+	TransformAABBsPerMatrixSSE(Matrices, In, Out, Count);
+}
+
+void FMath::MultiplyMatrices(const FMatrix* A, const FMatrix* B, FMatrix* Out, int32 Count)
+{
+	int32 Done = 0;
+	switch (GetSimdLevel())
+	{
+	case ESimdLevel::AVX: Done = MultiplyMatricesSimd<FSimd8>(A, B, Out, Count); [[fallthrough]];
+	case ESimdLevel::SSE: MultiplyMatricesSimd<FSimd4>(A + Done, B + Done, Out + Done, Count - Done); break;
+	default: Scalar::MultiplyMatrices(A, B, Out, Count); break;
+	}
+}
+
+void FMath::InverseMatrices(const FMatrix* In, FMatrix* Out, int32 Count)
+{
+	int32 Done = 0;
+	switch (GetSimdLevel())
+	{
+	case ESimdLevel::AVX: Done = InverseMatricesSimd<FSimd8>(In, Out, Count); [[fallthrough]];
+	case ESimdLevel::SSE: InverseMatricesSimd<FSimd4>(In + Done, Out + Done, Count - Done); break;
+	default: Scalar::InverseMatrices(In, Out, Count); break;
+	}
+}
+
+void FMath::InverseAffineMatrices(const FMatrix* In, FMatrix* Out, int32 Count)
+{
+	// 연산량이 적어 AVX는 레인 합치기/나누기 비용이 더 커짐 (측정상 SSE보다 느림) - AVX에서도 SSE 사용
+	switch (GetSimdLevel())
+	{
+	case ESimdLevel::AVX:
+	case ESimdLevel::SSE: InverseAffineMatricesSimd<FSimd4>(In, Out, Count); break;
+	default: Scalar::InverseAffineMatrices(In, Out, Count); break;
+	}
+}
+
+void FMath::BlendRotations(const FQuat* A, const FQuat* B, float Alpha, FQuat* Out, int32 Count, EQuatBlend Mode)
+{
+	if (GetSimdLevel() == ESimdLevel::Scalar)
+	{
+		Scalar::BlendRotations(A, B, Alpha, Out, Count, Mode);
+		return;
+	}
+	RunBlocks(FBlendRotationsBlock{ Alpha, Mode }, A, B, Out, Count);
+}
+
+void FMath::MultiplyQuats(const FQuat* A, const FQuat* B, FQuat* Out, int32 Count)
+{
+	if (GetSimdLevel() == ESimdLevel::Scalar)
+	{
+		Scalar::MultiplyQuats(A, B, Out, Count);
+		return;
+	}
+	RunBlocks(FMultiplyQuatsBlock{}, A, B, Out, Count);
+}
+
+void FMath::NormalizeQuats(const FQuat* In, FQuat* Out, int32 Count)
+{
+	if (GetSimdLevel() == ESimdLevel::Scalar)
+	{
+		Scalar::NormalizeQuats(In, Out, Count);
+		return;
+	}
+	RunBlocks(FNormalizeQuatsBlock{}, In, In, Out, Count);
+}
+
+void FMath::BlendTransforms(const FTransform* A, const FTransform* B, float Alpha, FTransform* Out, int32 Count, EQuatBlend Mode)
+{
+	if (GetSimdLevel() == ESimdLevel::Scalar)
+	{
+		Scalar::BlendTransforms(A, B, Alpha, Out, Count, Mode);
+		return;
+	}
+	RunBlocks(FBlendTransformsBlock{ Alpha, Mode }, A, B, Out, Count);
+}
+
+void FMath::ComposeTransforms(const FTransform* Parents, const FTransform* Locals, FTransform* Out, int32 Count)
+{
+	if (GetSimdLevel() == ESimdLevel::Scalar)
+	{
+		Scalar::ComposeTransforms(Parents, Locals, Out, Count);
+		return;
+	}
+	RunBlocks(FComposeTransformsBlock{}, Parents, Locals, Out, Count);
+}
+
+FAABB FMath::ComputeBounds(const FVector* Points, int32 Count)
+{
+	FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+	int32 Done = 0;
+	switch (GetSimdLevel())
+	{
+	case ESimdLevel::AVX: Done = ComputeBoundsSimd<FSimd8>(Points, Count, Min, Max); break;
+	case ESimdLevel::SSE: Done = ComputeBoundsSimd<FSimd4>(Points, Count, Min, Max); break;
+	default: break;
+	}
+	AccumulateBounds(Points + Done, Count - Done, Min, Max);
+	return FAABB(Min, Max);
+}
+
+void FMath::Scalar::TransformPositions(const FMatrix& M, const FVector* In, FVector* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FVector P = In[Index];
+		Out[Index] = FVector(
+			P.X * M.M[0][0] + P.Y * M.M[1][0] + P.Z * M.M[2][0] + M.M[3][0],
+			P.X * M.M[0][1] + P.Y * M.M[1][1] + P.Z * M.M[2][1] + M.M[3][1],
+			P.X * M.M[0][2] + P.Y * M.M[1][2] + P.Z * M.M[2][2] + M.M[3][2]);
+	}
+}
+
+void FMath::Scalar::TransformDirections(const FMatrix& M, const FVector* In, FVector* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FVector D = In[Index];
+		Out[Index] = FVector(
+			D.X * M.M[0][0] + D.Y * M.M[1][0] + D.Z * M.M[2][0],
+			D.X * M.M[0][1] + D.Y * M.M[1][1] + D.Z * M.M[2][1],
+			D.X * M.M[0][2] + D.Y * M.M[1][2] + D.Z * M.M[2][2]);
+	}
+}
+
+void FMath::Scalar::TransformAABBs(const FMatrix& M, const FAABB* In, FAABB* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		TransformAABBs(&M, In + Index, Out + Index, 1);
+	}
+}
+
+void FMath::Scalar::TransformAABBs(const FMatrix* Matrices, const FAABB* In, FAABB* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FMatrix& M = Matrices[Index];
+		const FAABB Box = In[Index];
+		const FVector Center = (Box.Min + Box.Max) * 0.5f;
+		const FVector Extent = (Box.Max - Box.Min) * 0.5f;
+
+		FVector WorldCenter, WorldExtent;
+		for (int32 Col = 0; Col < 3; ++Col)
+		{
+			(&WorldCenter.X)[Col] = Center.X * M.M[0][Col] + Center.Y * M.M[1][Col] + Center.Z * M.M[2][Col] + M.M[3][Col];
+			(&WorldExtent.X)[Col] = Extent.X * std::fabs(M.M[0][Col]) + Extent.Y * std::fabs(M.M[1][Col]) + Extent.Z * std::fabs(M.M[2][Col]);
+		}
+		Out[Index] = FAABB(WorldCenter - WorldExtent, WorldCenter + WorldExtent);
+	}
+}
+
+void FMath::Scalar::MultiplyMatrices(const FMatrix* A, const FMatrix* B, FMatrix* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		FMatrix Result;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Col = 0; Col < 4; ++Col)
+			{
+				Result.M[Row][Col] = A[Index].M[Row][0] * B[Index].M[0][Col] + A[Index].M[Row][1] * B[Index].M[1][Col]
+					+ A[Index].M[Row][2] * B[Index].M[2][Col] + A[Index].M[Row][3] * B[Index].M[3][Col];
+			}
+		}
+		Out[Index] = Result;
+	}
+}
+
+void FMath::Scalar::InverseMatrices(const FMatrix* In, FMatrix* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Out[Index] = In[Index].InverseScalar();
+	}
+}
+
+void FMath::Scalar::InverseAffineMatrices(const FMatrix* In, FMatrix* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Out[Index] = In[Index].InverseAffineScalar();
+	}
+}
+
+void FMath::Scalar::BlendRotations(const FQuat* A, const FQuat* B, float Alpha, FQuat* Out, int32 Count, EQuatBlend Mode)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Out[Index] = Mode == EQuatBlend::Slerp ? FQuat::Slerp(A[Index], B[Index], Alpha) : FQuat::Nlerp(A[Index], B[Index], Alpha);
+	}
+}
+
+void FMath::Scalar::MultiplyQuats(const FQuat* A, const FQuat* B, FQuat* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Out[Index] = A[Index] * B[Index];
+	}
+}
+
+void FMath::Scalar::NormalizeQuats(const FQuat* In, FQuat* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Out[Index] = In[Index].GetNormalized();
+	}
+}
+
+void FMath::Scalar::BlendTransforms(const FTransform* A, const FTransform* B, float Alpha, FTransform* Out, int32 Count, EQuatBlend Mode)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FQuat Rotation = Mode == EQuatBlend::Slerp
+			? FQuat::Slerp(A[Index].Rotation, B[Index].Rotation, Alpha)
+			: FQuat::Nlerp(A[Index].Rotation, B[Index].Rotation, Alpha);
+		Out[Index] = FTransform(
+			FVector::Lerp(A[Index].Translation, B[Index].Translation, Alpha),
+			Rotation,
+			FVector::Lerp(A[Index].Scale3D, B[Index].Scale3D, Alpha));
+	}
+}
+
+void FMath::Scalar::ComposeTransforms(const FTransform* Parents, const FTransform* Locals, FTransform* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Out[Index] = Parents[Index].GetWorldTransform(Locals[Index]);
+	}
+}
+
+FAABB FMath::Scalar::ComputeBounds(const FVector* Points, int32 Count)
+{
+	FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	AccumulateBounds(Points, Count, Min, Max);
+	return FAABB(Min, Max);
+}
@@ -0,0 +1,99 @@
+﻿#pragma once
+#include "Vector.h"
+
+/**
+ * 배열 단위 변환/행렬/쿼터니언 커널 (행 벡터 규약: P' = P * M)
+ *
+ * - 입출력은 FVector/FAABB 배열(AoS) 그대로 받고, 내부에서 4개(SSE) 또는 8개(AVX)씩
+ *   SoA로 전치해 계산한 뒤 다시 AoS로 돌려 씁니다. In == Out (제자리 변환) 허용.
+ * - 실행 시 CPU를 검사해 AVX 경로를 고르며, 모든 경로는 곱셈/덧셈 순서가 같아
+ *   스칼라 참조 구현(FMath::Scalar)과 비트 단위로 같은 결과를 냅니다.
+ * - TransformPosition과 마찬가지로 w는 1로 보고 원근 나눗셈은 하지 않습니다. (아핀 행렬 전용)
+ */
+namespace FMath
+{
+	enum class ESimdLevel : uint8
+	{
+		Scalar,
+		SSE,
+		AVX,
+	};
+
+	/** 회전 보간 방식 */
+	enum class EQuatBlend : uint8
+	{
+		Nlerp,  // 선형 보간 후 정규화 (FQuat::Nlerp와 비트 단위 동일)
+		Slerp,  // 구면 보간 - SIMD 경로는 acos/sin 대신 다항식 가중치 (FQuat::Slerp 대비 오차 ~1e-6)
+	};
+
+	/** 현재 사용 중인 커널 경로 */
+	ESimdLevel GetSimdLevel();
+
+	/** 커널 경로 강제 지정 (비교/측정용, CPU가 지원하는 수준까지만 적용) */
+	void SetSimdLevel(ESimdLevel Level);
+
+	/** Out[i] = In[i] * M (점, 이동 포함) */
+	void TransformPositions(const FMatrix& M, const FVector* In, FVector* Out, int32 Count);
+
+	/** Out[i] = In[i] * M (방향, 이동 제외) */
+	void TransformDirections(const FMatrix& M, const FVector* In, FVector* Out, int32 Count);
+
+	/** 변환된 박스를 감싸는 AABB (Arvo 방식 - 꼭짓점 8개를 변환하지 않고 중심/반크기로 계산) */
+	void TransformAABBs(const FMatrix& M, const FAABB* In, FAABB* Out, int32 Count);
+
+	/** 박스마다 다른 행렬을 쓰는 버전 (본별 AABB 등) */
+	void TransformAABBs(const FMatrix* Matrices, const FAABB* In, FAABB* Out, int32 Count);
+
+	/** 점들의 AABB. Count가 0이면 Min = FLT_MAX, Max = -FLT_MAX (IsValid() == false) */
+	FAABB ComputeBounds(const FVector* Points, int32 Count);
+
+	/** Out[i] = A[i] * B[i] (본 팔레트 등). Out은 A나 B와 같아도 됨 */
+	void MultiplyMatrices(const FMatrix* A, const FMatrix* B, FMatrix* Out, int32 Count);
+
+	/**
+	 * Out[i] = In[i]의 일반 역행렬 (2x2 블록 크라메르 공식, AVX는 2개씩)
+	 * 스칼라 여인수 전개와 반올림 순서가 달라 비트 단위로 같지는 않습니다. 특이 행렬은 단위 행렬.
+	 */
+	void InverseMatrices(const FMatrix* In, FMatrix* Out, int32 Count);
+
+	/** Out[i] = In[i]의 아핀 역행렬 (마지막 열 = [0,0,0,1] 가정). 특이 행렬은 단위 행렬 */
+	void InverseAffineMatrices(const FMatrix* In, FMatrix* Out, int32 Count);
+
+	/*
+	 * 쿼터니언/트랜스폼 커널 - AoS 배열을 4개(SSE) 또는 8개(AVX)씩 SoA로 전치해 계산합니다.
+	 * 꼬리 원소도 SIMD 경로로 처리하며, Out은 입력과 같아도 됩니다.
+	 */
+
+	/** Out[i] = A[i] -> B[i] 최단 경로 보간 (정규화된 결과) */
+	void BlendRotations(const FQuat* A, const FQuat* B, float Alpha, FQuat* Out, int32 Count, EQuatBlend Mode = EQuatBlend::Nlerp);
+
+	/** Out[i] = A[i] * B[i] (FQuat::operator*) */
+	void MultiplyQuats(const FQuat* A, const FQuat* B, FQuat* Out, int32 Count);
+
+	/** Out[i] = In[i].GetNormalized() */
+	void NormalizeQuats(const FQuat* In, FQuat* Out, int32 Count);
+
+	/** 포즈 블렌딩 - 이동/스케일은 선형 보간, 회전은 Mode */
+	void BlendTransforms(const FTransform* A, const FTransform* B, float Alpha, FTransform* Out, int32 Count, EQuatBlend Mode = EQuatBlend::Nlerp);
+
+	/** Out[i] = Parents[i].GetWorldTransform(Locals[i]) (부모 x 로컬) */
+	void ComposeTransforms(const FTransform* Parents, const FTransform* Locals, FTransform* Out, int32 Count);
+
+	/** 스칼라 참조 구현 - SIMD 경로 검증과 비교 측정용 */
+	namespace Scalar
+	{
+		void TransformPositions(const FMatrix& M, const FVector* In, FVector* Out, int32 Count);
+		void TransformDirections(const FMatrix& M, const FVector* In, FVector* Out, int32 Count);
+		void TransformAABBs(const FMatrix& M, const FAABB* In, FAABB* Out, int32 Count);
+		void TransformAABBs(const FMatrix* Matrices, const FAABB* In, FAABB* Out, int32 Count);
+		FAABB ComputeBounds(const FVector* Points, int32 Count);
+		void MultiplyMatrices(const FMatrix* A, const FMatrix* B, FMatrix* Out, int32 Count);
+		void InverseMatrices(const FMatrix* In, FMatrix* Out, int32 Count);
+		void InverseAffineMatrices(const FMatrix* In, FMatrix* Out, int32 Count);
+		void BlendRotations(const FQuat* A, const FQuat* B, float Alpha, FQuat* Out, int32 Count, EQuatBlend Mode = EQuatBlend::Nlerp);
+		void MultiplyQuats(const FQuat* A, const FQuat* B, FQuat* Out, int32 Count);
+		void NormalizeQuats(const FQuat* In, FQuat* Out, int32 Count);
+		void BlendTransforms(const FTransform* A, const FTransform* B, float Alpha, FTransform* Out, int32 Count, EQuatBlend Mode = EQuatBlend::Nlerp);
+		void ComposeTransforms(const FTransform* Parents, const FTransform* Locals, FTransform* Out, int32 Count);
+	}
+}
@@ -0,0 +1,250 @@
+﻿#include "pch.h"
+#include "FrameArena.h"
+#include "MemoryManager.h"
+#include <cstdlib>
+#include <mutex>
+
+namespace
+{
+	constexpr SIZE_T ArenaAlignment = 16;
+
+	inline SIZE_T AlignUpSize(SIZE_T Value, SIZE_T Alignment)
+	{
+		return (Value + (Alignment - 1)) & ~(Alignment - 1);
+	}
+
+	/** 청크 헤더 - 데이터는 헤더 바로 뒤에 16바이트 정렬로 이어집니다 */
+	struct alignas(ArenaAlignment) FChunk
+	{
+		FChunk* Next = nullptr;
+		SIZE_T Capacity = 0;
+		std::atomic<SIZE_T> Offset{ 0 };
+
+		uint8* GetData() { return reinterpret_cast<uint8*>(this + 1); }
+	};
+	static_assert(sizeof(FChunk) % ArenaAlignment == 0, "Chunk data must stay 16-byte aligned");
+}
+
+struct FFrameArena::FBuffer
+{
+	/** 범프 중인 청크 (워커 스레드도 읽음) */
+	std::atomic<FChunk*> Current{ nullptr };
+	/** 이번 세대에 사용한 청크 목록 / 리셋 후 재사용 대기 목록 */
+	FChunk* UsedChunks = nullptr;
+	FChunk* FreeChunks = nullptr;
+	std::mutex GrowMutex;
+
+	std::atomic<int32> PinCount{ 0 };
+	uint64 FrameNumber = 0;
+	uint64 ReservedBytes = 0;
+
+	~FBuffer()
+	{
+		FreeList(UsedChunks);
+		FreeList(FreeChunks);
+	}
+
+	static void FreeList(FChunk* Head)
+	{
+		while (Head)
+		{
+			FChunk* Next = Head->Next;
+			Head->~FChunk();
+			FMemoryManager::Deallocate(Head);
+			Head = Next;
+		}
+	}
+
+	/** 아무도 쓰지 않을 때만 호출 (게임 스레드, 핀 0) */
+	void Reset()
+	{
+		while (UsedChunks)
+		{
+			FChunk* Chunk = UsedChunks;
+			UsedChunks = Chunk->Next;
+			Chunk->Offset.store(0, std::memory_order_relaxed);
+			Chunk->Next = FreeChunks;
+			FreeChunks = Chunk;
+		}
+		Current.store(nullptr, std::memory_order_release);
+	}
+
+	/** Expected 청크가 가득 찼을 때 다음 청크로 교체 */
+	void Grow(FChunk* Expected, SIZE_T Needed)
+	{
+		std::lock_guard<std::mutex> Lock(GrowMutex);
+		if (Current.load(std::memory_order_acquire) != Expected)
+		{
+			return; // 다른 스레드가 이미 교체함
+		}
+
+		FChunk* Chunk = nullptr;
+		for (FChunk** Link = &FreeChunks; *Link; Link = &(*Link)->Next)
+		{
+			if ((*Link)->Capacity >= Needed)
+			{
+				Chunk = *Link;
+				*Link = Chunk->Next;
+				break;
+			}
+		}
+
+		if (!Chunk)
+		{
+			const SIZE_T Capacity = Needed > FFrameArena::ChunkSize ? AlignUpSize(Needed, 4096) : FFrameArena::ChunkSize;
+			FMemoryTagScope TagScope(EMemoryTag::FrameArena);
+			void* Raw = FMemoryManager::Allocate(sizeof(FChunk) + Capacity, ArenaAlignment);
+			if (!Raw)
+			{
+				throw std::bad_alloc();
+			}
+			Chunk = new (Raw) FChunk();
+			Chunk->Capacity = Capacity;
+			ReservedBytes += Capacity;
+		}
+
+		Chunk->Next = UsedChunks;
+		UsedChunks = Chunk;
+		Current.store(Chunk, std::memory_order_release);
+	}
+};
+
+namespace
+{
+	/** 버퍼 풀 - 게임 스레드 전용 (Current 포인터만 원자적으로 공개) */
+	struct FFrameArenaState
+	{
+		TArray<FFrameArena::FBuffer*> Buffers;
+		std::atomic<FFrameArena::FBuffer*> Current{ nullptr };
+		FFrameArena::FBuffer* Previous = nullptr;
+		uint64 FrameNumber = 0;
+
+		FFrameArenaState()
+		{
+			FFrameArena::FBuffer* First = new FFrameArena::FBuffer();
+			Buffers.Add(First);
+			Current.store(First, std::memory_order_release);
+		}
+
+		~FFrameArenaState()
+		{
+			for (FFrameArena::FBuffer* Buffer : Buffers)
+			{
+				delete Buffer;
+			}
+		}
+	};
+
+	FFrameArenaState& GetState()
+	{
+		static FFrameArenaState State;
+		return State;
+	}
+}
+
+void FFrameArena::BeginFrame()
+{
+	FFrameArenaState& State = GetState();
+	++State.FrameNumber;
+
+	// 현재 버퍼는 한 프레임 더 살려 두고(이중 버퍼), 그 외에 고정되지 않은 버퍼를 재사용
+	State.Previous = State.Current.load(std::memory_order_relaxed);
+
+	FBuffer* Next = nullptr;
+	for (FBuffer* Buffer : State.Buffers)
+	{
+		if (Buffer != State.Previous && Buffer->PinCount.load(std::memory_order_acquire) == 0)
+		{
+			Next = Buffer;
+			break;
+		}
+	}
+
+	if (!Next)
+	{
+		// 모든 버퍼가 사용 중이면 새 버퍼 추가 (핀이 풀리면 이후 프레임에서 재사용)
+		Next = new FBuffer();
+		State.Buffers.Add(Next);
+	}
+
+	Next->Reset();
+	Next->FrameNumber = State.FrameNumber;
+	State.Current.store(Next, std::memory_order_release);
+}
+
+void* FFrameArena::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	return Allocate(GetCurrentBuffer(), Size, Alignment);
+}
+
+void* FFrameArena::Allocate(FBuffer* Buffer, SIZE_T Size, SIZE_T Alignment)
+{
+	if (!Buffer)
+	{
+		Buffer = GetCurrentBuffer();
+	}
+
+	// 모든 오프셋을 16바이트 배수로 유지하므로, 더 큰 정렬만 여분을 예약
+	const SIZE_T Needed = AlignUpSize(Size ? Size : 1, ArenaAlignment)
+		+ (Alignment > ArenaAlignment ? Alignment - ArenaAlignment : 0);
+
+	for (;;)
+	{
+		FChunk* Chunk = Buffer->Current.load(std::memory_order_acquire);
+		if (Chunk)
+		{
+			const SIZE_T Offset = Chunk->Offset.fetch_add(Needed, std::memory_order_relaxed);
+			if (Offset + Needed <= Chunk->Capacity)
+			{
+				uintptr_t Ptr = reinterpret_cast<uintptr_t>(Chunk->GetData() + Offset);
+				if (Alignment > ArenaAlignment)
+				{
+					Ptr = (Ptr + (Alignment - 1)) & ~(static_cast<uintptr_t>(Alignment) - 1);
+				}
+				return reinterpret_cast<void*>(Ptr);
+			}
+		}
+		Buffer->Grow(Chunk, Needed);
+	}
+}
+
+FFrameArena::FBuffer* FFrameArena::GetCurrentBuffer()
+{
+	return GetState().Current.load(std::memory_order_acquire);
+}
+
+uint64 FFrameArena::GetFrameNumber()
+{
+	return GetState().FrameNumber;
+}
+
+FFrameArenaPin FFrameArena::PinCurrentFrame()
+{
+	return FFrameArenaPin(GetCurrentBuffer());
+}
+
+uint32 FFrameArena::GetBufferCount()
+{
+	return static_cast<uint32>(GetState().Buffers.Num());
+}
+
+uint64 FFrameArena::GetReservedBytes()
+{
+	uint64 Total = 0;
+	for (FBuffer* Buffer : GetState().Buffers)
+	{
+		std::lock_guard<std::mutex> Lock(Buffer->GrowMutex);
+		Total += Buffer->ReservedBytes;
+	}
+	return Total;
+}
+
+void FFrameArena::AddPin(FBuffer* Buffer)
+{
+	Buffer->PinCount.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void FFrameArena::RemovePin(FBuffer* Buffer)
+{
+	Buffer->PinCount.fetch_sub(1, std::memory_order_acq_rel);
+}
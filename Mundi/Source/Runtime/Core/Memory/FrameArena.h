@@ -0,0 +1,292 @@
+﻿#pragma once
+#include <cstddef>
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include "UEContainer.h"
+
+class FFrameArenaPin;
+
+/**
+ * 프레임 선형(범프) 할당자
+ * - 프레임마다 만들고 버리는 배열/객체를 일반 힙 대신 큰 청크에서 잘라 씁니다. 개별 해제는 없습니다.
+ * - 이중 버퍼: BeginFrame 마다 현재 버퍼가 '이전 프레임' 버퍼가 되고, 그보다 오래된 버퍼를 리셋해 재사용합니다.
+ *   따라서 프레임 N 에 할당한 메모리는 프레임 N+1 이 끝날 때까지 유효합니다.
+ * - 그보다 오래 살아야 하는 데이터(비동기 파티클 결과 등)는 FFrameArenaPin 으로 버퍼를 고정합니다.
+ *   고정된 버퍼는 리셋을 미루고, BeginFrame 은 다른 빈 버퍼(없으면 새 버퍼)를 사용합니다.
+ * - 할당은 원자적 범프라 워커 스레드에서도 안전합니다. 청크가 모자랄 때만 버퍼별 잠금을 잡습니다.
+ * - BeginFrame 과 핀 획득은 게임 스레드에서만 호출해야 합니다. (핀 해제는 어느 스레드든 가능)
+ * - 리셋된 청크는 해제하지 않고 재사용하므로, 정상 상태에서는 일반 힙 할당이 발생하지 않습니다.
+ */
+class FFrameArena
+{
+public:
+	struct FBuffer;
+
+	/** 프레임 시작 (UGameEngine/UEditorEngine::Tick 맨 앞에서 호출) */
+	static void BeginFrame();
+
+	/** 현재 프레임 버퍼에서 할당 */
+	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
+	/** 지정한 버퍼에서 할당 (고정된 버퍼에 워커 스레드가 쓸 때) */
+	static void* Allocate(FBuffer* Buffer, SIZE_T Size, SIZE_T Alignment);
+
+	static FBuffer* GetCurrentBuffer();
+	static uint64 GetFrameNumber();
+
+	/** 현재 프레임 버퍼를 고정 (게임 스레드 전용) */
+	static FFrameArenaPin PinCurrentFrame();
+
+	/** 아레나에서 생성한 객체의 소멸자만 호출 (메모리는 버퍼 리셋 때 회수) */
+	template<typename T>
+	static void Destroy(T* Object)
+	{
+		if (Object)
+		{
+			Object->~T();
+		}
+	}
+
+	/** 통계 */
+	static uint32 GetBufferCount();
+	static uint64 GetReservedBytes();
+
+	static constexpr SIZE_T ChunkSize = 256 * 1024;
+
+private:
+	friend class FFrameArenaPin;
+	static void AddPin(FBuffer* Buffer);
+	static void RemovePin(FBuffer* Buffer);
+};
+
+/**
+ * 프레임 아레나 버퍼 고정 핸들 (RAII)
+ * 핀이 하나라도 살아 있는 동안 해당 버퍼는 리셋되지 않습니다.
+ */
+class FFrameArenaPin
+{
+public:
+	FFrameArenaPin() = default;
+	explicit FFrameArenaPin(FFrameArena::FBuffer* InBuffer) : Buffer(InBuffer)
+	{
+		if (Buffer) FFrameArena::AddPin(Buffer);
+	}
+
+	FFrameArenaPin(const FFrameArenaPin& Other) : FFrameArenaPin(Other.Buffer) {}
+	FFrameArenaPin(FFrameArenaPin&& Other) noexcept : Buffer(Other.Buffer) { Other.Buffer = nullptr; }
+
+	FFrameArenaPin& operator=(const FFrameArenaPin& Other)
+	{
+		if (this != &Other)
+		{
+			FFrameArenaPin Copy(Other);
+			std::swap(Buffer, Copy.Buffer);
+		}
+		return *this;
+	}
+
+	FFrameArenaPin& operator=(FFrameArenaPin&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			Release();
+			Buffer = Other.Buffer;
+			Other.Buffer = nullptr;
+		}
+		return *this;
+	}
+
+	~FFrameArenaPin() { Release(); }
+
+	void Release()
+	{
+		if (Buffer)
+		{
+			FFrameArena::RemovePin(Buffer);
+			Buffer = nullptr;
+		}
+	}
+
+	bool IsValid() const { return Buffer != nullptr; }
+	FFrameArena::FBuffer* GetBuffer() const { return Buffer; }
+
+	void* Allocate(SIZE_T Size, SIZE_T Alignment) const
+	{
+		return FFrameArena::Allocate(Buffer, Size, Alignment);
+	}
+
+	/** 고정된 버퍼에 객체 생성 - 해제는 FFrameArena::Destroy */
+	template<typename T, typename... Args>
+	T* New(Args&&... InArgs) const
+	{
+		return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(InArgs)...);
+	}
+
+private:
+	FFrameArena::FBuffer* Buffer = nullptr;
+};
+
+/**
+ * 프레임 아레나 STL 할당자 어댑터
+ * - 생성 시점의 버퍼(기본: 현재 프레임)에 묶이며 deallocate 는 아무것도 하지 않습니다.
+ * - 컨테이너는 묶인 버퍼의 수명(다음 프레임 끝, 또는 핀 해제) 안에서만 사용해야 합니다.
+ */
+template<typename T>
+class TFrameStlAllocator
+{
+public:
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+	using is_always_equal = std::false_type;
+
+	TFrameStlAllocator() noexcept : Buffer(FFrameArena::GetCurrentBuffer()) {}
+	explicit TFrameStlAllocator(FFrameArena::FBuffer* InBuffer) noexcept : Buffer(InBuffer) {}
+	explicit TFrameStlAllocator(const FFrameArenaPin& Pin) noexcept : Buffer(Pin.GetBuffer()) {}
+
+	template<typename U>
+	TFrameStlAllocator(const TFrameStlAllocator<U>& Other) noexcept : Buffer(Other.GetBuffer()) {}
+
+	T* allocate(SIZE_T Count)
+	{
+		return static_cast<T*>(FFrameArena::Allocate(Buffer, sizeof(T) * Count, alignof(T)));
+	}
+
+	void deallocate(T*, SIZE_T) noexcept {}
+
+	FFrameArena::FBuffer* GetBuffer() const { return Buffer; }
+
+	template<typename U>
+	bool operator==(const TFrameStlAllocator<U>& Other) const { return Buffer == Other.GetBuffer(); }
+	template<typename U>
+	bool operator!=(const TFrameStlAllocator<U>& Other) const { return Buffer != Other.GetBuffer(); }
+
+private:
+	FFrameArena::FBuffer* Buffer;
+};
+
+/** TArray 할당 정책 - 프레임 아레나 (TArray<T, FFrameArenaAllocator>) */
+struct FFrameArenaAllocator {};
+
+/** TArray<T, FFrameArenaAllocator> - 한 프레임 동안만 쓰는 배열 */
+template<typename T>
+class TArray<T, FFrameArenaAllocator> : public std::vector<T, TFrameStlAllocator<T>>
+{
+	using Super = std::vector<T, TFrameStlAllocator<T>>;
+
+public:
+	using Super::Super;
+
+	/** 기본 TArray로 복사 (프레임을 넘겨 보관해야 할 때) */
+	TArray<T> ToArray() const
+	{
+		return TArray<T>(this->begin(), this->end());
+	}
+
+	/** 요소 추가 */
+	int32 Add(const T& Item)
+	{
+		this->push_back(Item);
+		return static_cast<int32>(this->size() - 1);
+	}
+
+	template<typename... Args>
+	int32 Emplace(Args&&... args)
+	{
+		this->emplace_back(std::forward<Args>(args)...);
+		return static_cast<int32>(this->size() - 1);
+	}
+
+	int32 AddUnique(const T& Item)
+	{
+		const int32 Index = Find(Item);
+		return Index != -1 ? Index : Add(Item);
+	}
+
+	/** 배열 병합 (임의의 TArray/컨테이너) */
+	template<typename ContainerType>
+	void Append(const ContainerType& Other)
+	{
+		this->insert(this->end(), std::begin(Other), std::end(Other));
+	}
+
+	void Insert(const T& Item, int32 Index)
+	{
+		this->insert(this->begin() + Index, Item);
+	}
+
+	void RemoveAt(int32 Index)
+	{
+		this->erase(this->begin() + Index);
+	}
+
+	bool Remove(const T& Item)
+	{
+		auto it = std::find(this->begin(), this->end(), Item);
+		if (it != this->end())
+		{
+			this->erase(it);
+			return true;
+		}
+		return false;
+	}
+
+	/** 크기 관련 */
+	int32 Num() const
+	{
+		return static_cast<int32>(this->size());
+	}
+
+	bool IsEmpty() const
+	{
+		return this->empty();
+	}
+
+	void Empty()
+	{
+		this->clear();
+	}
+
+	void Reserve(int64 Capacity)
+	{
+		this->reserve(static_cast<SIZE_T>(Capacity));
+	}
+
+	void SetNum(int32 NewSize)
+	{
+		this->resize(static_cast<SIZE_T>(NewSize));
+	}
+
+	/** 접근 */
+	T& Last() { return this->back(); }
+	const T& Last() const { return this->back(); }
+
+	T* GetData() { return this->data(); }
+	const T* GetData() const { return this->data(); }
+
+	/** 검색 */
+	int32 Find(const T& Item) const
+	{
+		auto it = std::find(this->begin(), this->end(), Item);
+		return (it != this->end()) ? static_cast<int32>(std::distance(this->begin(), it)) : -1;
+	}
+
+	bool Contains(const T& Item) const
+	{
+		return Find(Item) != -1;
+	}
+
+	/** 정렬 */
+	void Sort()
+	{
+		std::sort(this->begin(), this->end());
+	}
+
+	template<typename Predicate>
+	void Sort(Predicate Pred)
+	{
+		std::sort(this->begin(), this->end(), Pred);
+	}
+};
@@ -3,28 +3,398 @@
 #include <cstddef>
 #include <malloc.h>
 #include <algorithm>
+#include <mutex>
+#include <cstring>
+#include <xmmintrin.h>
 
-uint32 FMemoryManager::TotalAllocationBytes = 0;
-uint32 FMemoryManager::TotalAllocationCount = 0;
+std::atomic<uint64> FMemoryManager::TotalAllocationBytes{ 0 };
+std::atomic<uint64> FMemoryManager::TotalAllocationCount{ 0 };
+std::atomic<uint64> FMemoryManager::PeakAllocationBytes{ 0 };
+
+namespace
+{
+	// 모든 할당 앞에 붙는 16바이트 헤더 (max_align_t 정렬 유지)
+	struct FAllocationHeader
+	{
+		uint64 Size;        // 사용자 요청 크기
+		uint16 SizeClass;   // 풀 크기 클래스, 큰 할당이면 LargeSizeClass
+		uint16 Tag;         // 메모리 태그 (EMemoryTag / RegisterTag)
+		uint32 Offset;      // 큰 할당: 원본 포인터에서 사용자 포인터까지의 거리
+	};
+	static_assert(sizeof(FAllocationHeader) == 16, "Header must keep 16-byte alignment");
+
+	constexpr uint16 LargeSizeClass = 0xFFFFu;
+	constexpr SIZE_T HeaderSize = sizeof(FAllocationHeader);
+	constexpr SIZE_T SmallAlignment = 16;
+	constexpr SIZE_T BlockSize = 64 * 1024;
+
+	// 16 ~ 128은 16바이트 간격, 그 이후는 2의 거듭제곱 구간마다 4단계
+	constexpr uint32 SizeClassSizes[] =
+	{
+		16, 32, 48, 64, 80, 96, 112, 128,
+		160, 192, 224, 256,
+		320, 384, 448, 512,
+		640, 768, 896, 1024,
+		1280, 1536, 1792, 2048,
+		2560, 3072, 3584, 4096,
+	};
+	constexpr uint32 NumSizeClasses = sizeof(SizeClassSizes) / sizeof(SizeClassSizes[0]);
+	static_assert(SizeClassSizes[NumSizeClasses - 1] == FMemoryManager::MaxSmallSize, "Size class table must cover MaxSmallSize");
+
+	/** (Size + 15) / 16 -> 크기 클래스 인덱스 */
+	struct FSizeClassLookup
+	{
+		uint8 Table[FMemoryManager::MaxSmallSize / 16 + 1] = {};
+
+		constexpr FSizeClassLookup()
+		{
+			uint32 Class = 0;
+			for (uint32 i = 0; i < sizeof(Table); ++i)
+			{
+				while (SizeClassSizes[Class] < i * 16)
+				{
+					++Class;
+				}
+				Table[i] = static_cast<uint8>(Class);
+			}
+		}
+	};
+	constexpr FSizeClassLookup SizeClassLookup;
+
+	inline uint32 GetSizeClass(SIZE_T Size)
+	{
+		return SizeClassLookup.Table[(Size + 15) / 16];
+	}
+
+	inline SIZE_T GetSlotSize(uint32 SizeClass)
+	{
+		return SizeClassSizes[SizeClass] + HeaderSize;
+	}
+
+	/**
+	 * 빈 슬롯은 첫 8바이트를 다음 빈 슬롯 포인터로 사용
+	 * 전역 풀에 배치째 반납된 목록은 첫 슬롯의 NextBatch로 다음 배치를 가리킴 (헤더 자리라 슬롯 크기와 무관)
+	 */
+	struct FFreeSlot
+	{
+		FFreeSlot* Next;
+		FFreeSlot* NextBatch;
+	};
+	static_assert(sizeof(FFreeSlot) <= sizeof(FAllocationHeader), "Free slot links must fit in the header area");
+
+	/** 스레드 캐시가 모자라거나 넘칠 때 사용하는 전역 풀 (크기 클래스별 잠금) */
+	struct FCentralPool
+	{
+		std::mutex Mutex;
+		FFreeSlot* FreeList = nullptr;
+		/** 스레드 캐시가 반납한 GetBatchCount 길이의 목록들 - 다시 채울 때 순회 없이 통째로 넘김 */
+		FFreeSlot* FullBatches = nullptr;
+		TArray<void*> Blocks;
+		std::atomic<uint64> LiveCount{ 0 };
+		std::atomic<uint64> CapacityCount{ 0 };
+	};
+
+	FCentralPool* GetCentralPools()
+	{
+		// 정적 초기화 순서와 무관하게 첫 할당 시 생성, 종료 시에도 해제하지 않음
+		static FCentralPool* Pools = new FCentralPool[NumSizeClasses];
+		return Pools;
+	}
+
+	/** 한 번에 스레드 캐시로 옮기는 슬롯 수 */
+	inline uint32 GetBatchCount(uint32 SizeClass)
+	{
+		return std::clamp<uint32>(static_cast<uint32>(BlockSize / GetSlotSize(SizeClass) / 4), 4u, 64u);
+	}
+
+	/** Pool의 잠금을 잡은 상태에서 새 블록을 잘라 자유 목록에 연결 */
+	void AllocateBlockLocked(FCentralPool& Pool, uint32 SizeClass)
+	{
+		unsigned char* Block = static_cast<unsigned char*>(_aligned_malloc(BlockSize, SmallAlignment));
+		if (!Block)
+		{
+			return;
+		}
+		Pool.Blocks.Add(Block);
+
+		const SIZE_T SlotSize = GetSlotSize(SizeClass);
+		const SIZE_T NumSlots = BlockSize / SlotSize;
+		for (SIZE_T i = NumSlots; i-- > 0;)
+		{
+			FFreeSlot* Slot = reinterpret_cast<FFreeSlot*>(Block + i * SlotSize);
+			Slot->Next = Pool.FreeList;
+			Pool.FreeList = Slot;
+		}
+		Pool.CapacityCount.fetch_add(NumSlots, std::memory_order_relaxed);
+	}
+
+	/** 스레드별 크기 클래스 자유 목록 (trivially destructible이라 스레드 종료 후에도 접근 가능) */
+	struct FThreadCache
+	{
+		FFreeSlot* FreeList[NumSizeClasses];
+		uint32 Count[NumSizeClasses];
+		bool bRegistered;
+		bool bShutdown;
+	};
+	thread_local FThreadCache GThreadCache = {};
+
+	/** 스레드 종료 시 캐시에 남은 슬롯을 전역 풀로 반납 */
+	struct FThreadCacheFlusher
+	{
+		~FThreadCacheFlusher()
+		{
+			FThreadCache& Cache = GThreadCache;
+			FCentralPool* Pools = GetCentralPools();
+			for (uint32 Class = 0; Class < NumSizeClasses; ++Class)
+			{
+				FFreeSlot* Head = Cache.FreeList[Class];
+				if (!Head)
+				{
+					continue;
+				}
+				FFreeSlot* TailSlot = Head;
+				while (TailSlot->Next)
+				{
+					TailSlot = TailSlot->Next;
+				}
+
+				std::lock_guard<std::mutex> Lock(Pools[Class].Mutex);
+				TailSlot->Next = Pools[Class].FreeList;
+				Pools[Class].FreeList = Head;
+				Cache.FreeList[Class] = nullptr;
+				Cache.Count[Class] = 0;
+			}
+			Cache.bShutdown = true;
+		}
+	};
+	thread_local FThreadCacheFlusher GThreadCacheFlusher;
+
+	/** 전역 풀에서 배치 단위로 가져와 스레드 캐시를 채움 */
+	bool RefillThreadCache(FThreadCache& Cache, uint32 SizeClass)
+	{
+		if (!Cache.bRegistered)
+		{
+			// 첫 사용 시 소멸자 등록 (thread_local 객체는 ODR-use 시점에 생성됨)
+			(void)&GThreadCacheFlusher;
+			Cache.bRegistered = true;
+		}
+
+		FCentralPool& Pool = GetCentralPools()[SizeClass];
+		const uint32 Batch = GetBatchCount(SizeClass);
+
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		if (FFreeSlot* Head = Pool.FullBatches)
+		{
+			// 해제 순서가 뒤섞인 슬롯들을 하나씩 따라가면 슬롯마다 캐시 미스가 나므로 배치째 가져옴
+			Pool.FullBatches = Head->NextBatch;
+			Cache.FreeList[SizeClass] = Head;
+			Cache.Count[SizeClass] = Batch;
+			return true;
+		}
+		for (uint32 i = 0; i < Batch; ++i)
+		{
+			if (!Pool.FreeList)
+			{
+				AllocateBlockLocked(Pool, SizeClass);
+				if (!Pool.FreeList)
+				{
+					break;
+				}
+			}
+			FFreeSlot* Slot = Pool.FreeList;
+			Pool.FreeList = Slot->Next;
+			Slot->Next = Cache.FreeList[SizeClass];
+			Cache.FreeList[SizeClass] = Slot;
+			++Cache.Count[SizeClass];
+		}
+		return Cache.FreeList[SizeClass] != nullptr;
+	}
+
+	/** 캐시가 너무 커지면 배치 하나를 전역 풀로 반납 */
+	void ReleaseFromThreadCache(FThreadCache& Cache, uint32 SizeClass)
+	{
+		const uint32 Batch = GetBatchCount(SizeClass);
+		FFreeSlot* Head = Cache.FreeList[SizeClass];
+		FFreeSlot* TailSlot = Head;
+		for (uint32 i = 1; i < Batch; ++i)
+		{
+			TailSlot = TailSlot->Next;
+		}
+		Cache.FreeList[SizeClass] = TailSlot->Next;
+		Cache.Count[SizeClass] -= Batch;
+		TailSlot->Next = nullptr;
+
+		FCentralPool& Pool = GetCentralPools()[SizeClass];
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		Head->NextBatch = Pool.FullBatches;
+		Pool.FullBatches = Head;
+	}
+
+	void* AllocateSmall(uint32 SizeClass)
+	{
+		FThreadCache& Cache = GThreadCache;
+		if (Cache.bShutdown)
+		{
+			// 스레드 종료 처리 이후의 할당은 전역 풀에서 바로 처리
+			FCentralPool& Pool = GetCentralPools()[SizeClass];
+			std::lock_guard<std::mutex> Lock(Pool.Mutex);
+			if (!Pool.FreeList)
+			{
+				AllocateBlockLocked(Pool, SizeClass);
+				if (!Pool.FreeList)
+				{
+					return nullptr;
+				}
+			}
+			FFreeSlot* Slot = Pool.FreeList;
+			Pool.FreeList = Slot->Next;
+			return Slot;
+		}
+
+		if (!Cache.FreeList[SizeClass] && !RefillThreadCache(Cache, SizeClass))
+		{
+			return nullptr;
+		}
+
+		FFreeSlot* Slot = Cache.FreeList[SizeClass];
+		Cache.FreeList[SizeClass] = Slot->Next;
+		--Cache.Count[SizeClass];
+		if (Slot->Next)
+		{
+			// 다음 할당이 읽을 슬롯을 미리 불러 둠 (뒤섞인 자유 목록의 캐시 미스를 호출 사이에 숨김)
+			_mm_prefetch(reinterpret_cast<const char*>(Slot->Next), _MM_HINT_T0);
+		}
+		return Slot;
+	}
+
+	void DeallocateSmall(void* Raw, uint32 SizeClass)
+	{
+		FFreeSlot* Slot = static_cast<FFreeSlot*>(Raw);
+		FThreadCache& Cache = GThreadCache;
+		if (Cache.bShutdown)
+		{
+			FCentralPool& Pool = GetCentralPools()[SizeClass];
+			std::lock_guard<std::mutex> Lock(Pool.Mutex);
+			Slot->Next = Pool.FreeList;
+			Pool.FreeList = Slot;
+			return;
+		}
+
+		// 다른 스레드에서 할당된 슬롯도 현재 스레드 캐시로 받아 재사용
+		Slot->Next = Cache.FreeList[SizeClass];
+		Cache.FreeList[SizeClass] = Slot;
+		if (++Cache.Count[SizeClass] > GetBatchCount(SizeClass) * 2)
+		{
+			ReleaseFromThreadCache(Cache, SizeClass);
+		}
+	}
+
+	void TrackAllocation(SIZE_T Size)
+	{
+		const uint64 NewTotal = FMemoryManager::TotalAllocationBytes.fetch_add(Size, std::memory_order_relaxed) + Size;
+		FMemoryManager::TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+		uint64 Peak = FMemoryManager::PeakAllocationBytes.load(std::memory_order_relaxed);
+		while (NewTotal > Peak && !FMemoryManager::PeakAllocationBytes.compare_exchange_weak(Peak, NewTotal, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	/** 태그별 카운터 (캐시 라인 단위로 분리) */
+	struct alignas(64) FTagCounters
+	{
+		std::atomic<int64> CurrentBytes{ 0 };
+		std::atomic<int64> PeakBytes{ 0 };
+		std::atomic<int64> LiveCount{ 0 };
+		std::atomic<uint64> TotalCount{ 0 };
+	};
+
+	constexpr SIZE_T MaxTagNameLength = 64;
+
+	/** 정적 저장소만 사용 (할당자 내부에서 다시 할당하지 않도록) */
+	FTagCounters GTagCounters[FMemoryManager::MaxTags];
+	char GTagNames[FMemoryManager::MaxTags][MaxTagNameLength] =
+	{
+		"Untagged", "Particles", "Animation", "ResourceManager", "Physics", "Lua", "FrameArena",
+	};
+	std::atomic<uint32> GNumTags{ EMemoryTag::NumBuiltin };
+	std::mutex GTagRegisterMutex;
+
+	thread_local uint16 GCurrentTag = EMemoryTag::Untagged;
+
+	void TrackTagAllocation(uint16 Tag, SIZE_T Size)
+	{
+		FTagCounters& Counters = GTagCounters[Tag];
+		const int64 NewBytes = Counters.CurrentBytes.fetch_add(static_cast<int64>(Size), std::memory_order_relaxed) + static_cast<int64>(Size);
+		Counters.LiveCount.fetch_add(1, std::memory_order_relaxed);
+		Counters.TotalCount.fetch_add(1, std::memory_order_relaxed);
+
+		int64 Peak = Counters.PeakBytes.load(std::memory_order_relaxed);
+		while (NewBytes > Peak && !Counters.PeakBytes.compare_exchange_weak(Peak, NewBytes, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	void TrackTagDeallocation(uint16 Tag, SIZE_T Size)
+	{
+		FTagCounters& Counters = GTagCounters[Tag];
+		Counters.CurrentBytes.fetch_sub(static_cast<int64>(Size), std::memory_order_relaxed);
+		Counters.LiveCount.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	inline FAllocationHeader* GetHeader(void* Ptr)
+	{
+		return reinterpret_cast<FAllocationHeader*>(static_cast<unsigned char*>(Ptr) - HeaderSize);
+	}
+}
 
 void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
 {
-	SIZE_T TotalSize = Size + sizeof(SIZE_T);
-	SIZE_T FinalAlignment = std::max(Alignment, alignof(SIZE_T));
+	unsigned char* UserPtr = nullptr;
+	const uint16 Tag = GCurrentTag;
+
+	if (Size <= MaxSmallSize && Alignment <= SmallAlignment)
+	{
+		const uint32 SizeClass = GetSizeClass(Size);
+		void* Raw = AllocateSmall(SizeClass);
+		if (!Raw)
+			return nullptr;
+
+		UserPtr = static_cast<unsigned char*>(Raw) + HeaderSize;
+		FAllocationHeader* Header = GetHeader(UserPtr);
+		Header->Size = Size;
+		Header->SizeClass = static_cast<uint16>(SizeClass);
+		Header->Tag = Tag;
+		Header->Offset = static_cast<uint32>(HeaderSize);
+
+		GetCentralPools()[SizeClass].LiveCount.fetch_add(1, std::memory_order_relaxed);
+	}
+	else
+	{
+		// 헤더 뒤의 사용자 포인터가 요청 정렬을 만족하도록 앞쪽 여백을 정렬 단위로 확보
+		const SIZE_T FinalAlignment = std::max(Alignment, SmallAlignment);
+		const SIZE_T Offset = std::max(FinalAlignment, HeaderSize);
+		const SIZE_T TotalSize = Size + Offset;
 
 #if defined(_MSC_VER) && defined(_DEBUG)
-	void* Raw = _aligned_malloc_dbg(TotalSize, FinalAlignment, nullptr, 0);
+		void* Raw = _aligned_malloc_dbg(TotalSize, FinalAlignment, nullptr, 0);
 #else
-	void* Raw = _aligned_malloc(TotalSize, FinalAlignment);
+		void* Raw = _aligned_malloc(TotalSize, FinalAlignment);
 #endif
-	if (!Raw)
-		return nullptr;
+		if (!Raw)
+			return nullptr;
 
-	*reinterpret_cast<SIZE_T*>(Raw) = Size;
-	TotalAllocationBytes += static_cast<uint32>(Size);
-	TotalAllocationCount++;
+		UserPtr = static_cast<unsigned char*>(Raw) + Offset;
+		FAllocationHeader* Header = GetHeader(UserPtr);
+		Header->Size = Size;
+		Header->SizeClass = LargeSizeClass;
+		Header->Tag = Tag;
+		Header->Offset = static_cast<uint32>(Offset);
+	}
 
-	return static_cast<void*>(static_cast<unsigned char*>(Raw) + sizeof(SIZE_T));
+	TrackAllocation(Size);
+	TrackTagAllocation(Tag, Size);
+	return static_cast<void*>(UserPtr);
 }
 
 void FMemoryManager::Deallocate(void* Ptr)
@@ -32,16 +402,214 @@ void FMemoryManager::Deallocate(void* Ptr)
 	if (!Ptr)
 		return;
 
-	unsigned char* UserPtr = static_cast<unsigned char*>(Ptr);
-	unsigned char* Raw = UserPtr - sizeof(SIZE_T);
-	SIZE_T Size = *reinterpret_cast<SIZE_T*>(Raw);
+	const FAllocationHeader* Header = GetHeader(Ptr);
+	const SIZE_T Size = static_cast<SIZE_T>(Header->Size);
+	const uint16 SizeClass = Header->SizeClass;
+	unsigned char* Raw = static_cast<unsigned char*>(Ptr) - Header->Offset;
 
-	TotalAllocationBytes -= static_cast<uint32>(Size);
-	TotalAllocationCount--;
+	TotalAllocationBytes.fetch_sub(Size, std::memory_order_relaxed);
+	TotalAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+	TrackTagDeallocation(Header->Tag, Size);
+
+	if (SizeClass != LargeSizeClass)
+	{
+		GetCentralPools()[SizeClass].LiveCount.fetch_sub(1, std::memory_order_relaxed);
+		DeallocateSmall(Raw, SizeClass);
+		return;
+	}
 
 #if defined(_MSC_VER) && defined(_DEBUG)
 	_aligned_free_dbg(Raw);
 #else
 	_aligned_free(Raw);
 #endif
-}
\ No newline at end of file
+}
+
+SIZE_T FMemoryManager::GetAllocationSize(void* Ptr)
+{
+	return Ptr ? static_cast<SIZE_T>(GetHeader(Ptr)->Size) : 0;
+}
+
+SIZE_T FMemoryManager::GetUsableSize(void* Ptr)
+{
+	if (!Ptr)
+		return 0;
+
+	const FAllocationHeader* Header = GetHeader(Ptr);
+	if (Header->SizeClass == LargeSizeClass)
+		return static_cast<SIZE_T>(Header->Size);
+	return SizeClassSizes[Header->SizeClass];
+}
+
+void FMemoryManager::GetSizeClassStats(TArray<FMemorySizeClassStats>& OutStats)
+{
+	OutStats.Empty();
+	OutStats.Reserve(NumSizeClasses);
+
+	FCentralPool* Pools = GetCentralPools();
+	for (uint32 Class = 0; Class < NumSizeClasses; ++Class)
+	{
+		FMemorySizeClassStats Stats;
+		Stats.SlotSize = SizeClassSizes[Class];
+		Stats.LiveCount = Pools[Class].LiveCount.load(std::memory_order_relaxed);
+		Stats.CapacityCount = Pools[Class].CapacityCount.load(std::memory_order_relaxed);
+		{
+			std::lock_guard<std::mutex> Lock(Pools[Class].Mutex);
+			Stats.BlockCount = Pools[Class].Blocks.Num();
+		}
+		OutStats.Add(Stats);
+	}
+}
+
+void FMemoryManager::DumpSizeClassReport()
+{
+	TArray<FMemorySizeClassStats> Stats;
+	GetSizeClassStats(Stats);
+
+	UE_LOG("=== Memory Pool Report ===");
+	UE_LOG("Total: %.2f MB (Peak %.2f MB), Allocs: %llu",
+		TotalAllocationBytes.load() / (1024.0 * 1024.0),
+		PeakAllocationBytes.load() / (1024.0 * 1024.0),
+		TotalAllocationCount.load());
+	UE_LOG("%8s %10s %10s %8s %10s", "Size", "Live", "Capacity", "Occ%", "Reserved");
+
+	uint64 ReservedBytes = 0;
+	for (const FMemorySizeClassStats& Entry : Stats)
+	{
+		if (Entry.CapacityCount == 0)
+		{
+			continue;
+		}
+		const double Occupancy = 100.0 * static_cast<double>(Entry.LiveCount) / static_cast<double>(Entry.CapacityCount);
+		const uint64 Reserved = Entry.BlockCount * BlockSize;
+		ReservedBytes += Reserved;
+		UE_LOG("%8u %10llu %10llu %7.1f%% %8.1fKB", Entry.SlotSize, Entry.LiveCount, Entry.CapacityCount, Occupancy, Reserved / 1024.0);
+	}
+	UE_LOG("Pool reserved: %.2f MB", ReservedBytes / (1024.0 * 1024.0));
+}
+
+uint16 FMemoryManager::RegisterTag(const char* Name)
+{
+	if (!Name || !Name[0])
+	{
+		return EMemoryTag::Untagged;
+	}
+
+	std::lock_guard<std::mutex> Lock(GTagRegisterMutex);
+	const uint32 NumTags = GNumTags.load(std::memory_order_relaxed);
+	for (uint32 Tag = 0; Tag < NumTags; ++Tag)
+	{
+		if (std::strncmp(GTagNames[Tag], Name, MaxTagNameLength - 1) == 0)
+		{
+			return static_cast<uint16>(Tag);
+		}
+	}
+
+	if (NumTags >= MaxTags)
+	{
+		return EMemoryTag::Untagged;
+	}
+
+	strncpy_s(GTagNames[NumTags], MaxTagNameLength, Name, _TRUNCATE);
+	GNumTags.store(NumTags + 1, std::memory_order_release);
+	return static_cast<uint16>(NumTags);
+}
+
+const char* FMemoryManager::GetTagName(uint16 Tag)
+{
+	return Tag < GNumTags.load(std::memory_order_acquire) ? GTagNames[Tag] : GTagNames[EMemoryTag::Untagged];
+}
+
+uint16 FMemoryManager::GetCurrentTag()
+{
+	return GCurrentTag;
+}
+
+uint16 FMemoryManager::SetCurrentTag(uint16 Tag)
+{
+	const uint16 Previous = GCurrentTag;
+	GCurrentTag = Tag;
+	return Previous;
+}
+
+void FMemoryManager::GetTagStats(TArray<FMemoryTagStats>& OutStats)
+{
+	OutStats.Empty();
+
+	const uint32 NumTags = GNumTags.load(std::memory_order_acquire);
+	for (uint32 Tag = 0; Tag < NumTags; ++Tag)
+	{
+		const FTagCounters& Counters = GTagCounters[Tag];
+		const uint64 TotalCount = Counters.TotalCount.load(std::memory_order_relaxed);
+		if (TotalCount == 0)
+		{
+			continue;
+		}
+
+		FMemoryTagStats Stats;
+		Stats.Tag = static_cast<uint16>(Tag);
+		Stats.Name = GTagNames[Tag];
+		Stats.CurrentBytes = Counters.CurrentBytes.load(std::memory_order_relaxed);
+		Stats.PeakBytes = Counters.PeakBytes.load(std::memory_order_relaxed);
+		Stats.LiveCount = Counters.LiveCount.load(std::memory_order_relaxed);
+		Stats.TotalCount = TotalCount;
+		OutStats.Add(Stats);
+	}
+}
+
+void FMemoryManager::DumpTagReport()
+{
+	TArray<FMemoryTagStats> Stats;
+	GetTagStats(Stats);
+	Stats.Sort([](const FMemoryTagStats& A, const FMemoryTagStats& B) { return A.CurrentBytes > B.CurrentBytes; });
+
+	UE_LOG("=== Memory Tag Report ===");
+	UE_LOG("%-32s %12s %12s %10s %12s", "Tag", "Current KB", "Peak KB", "Live", "Total");
+	for (const FMemoryTagStats& Entry : Stats)
+	{
+		UE_LOG("%-32s %12.1f %12.1f %10lld %12llu", Entry.Name,
+			Entry.CurrentBytes / 1024.0, Entry.PeakBytes / 1024.0, Entry.LiveCount, Entry.TotalCount);
+	}
+}
+
+void FMemoryManager::DumpTagDiff(const TArray<FMemoryTagStats>& Before, const TArray<FMemoryTagStats>& After)
+{
+	struct FTagDelta
+	{
+		const char* Name;
+		int64 DeltaBytes;
+		int64 DeltaCount;
+	};
+
+	// 태그 번호로 이전 스냅샷 조회 (태그는 해제되지 않으므로 번호가 유지됨)
+	TArray<const FMemoryTagStats*> BeforeByTag;
+	BeforeByTag.SetNum(MaxTags, nullptr);
+	for (const FMemoryTagStats& Entry : Before)
+	{
+		BeforeByTag[Entry.Tag] = &Entry;
+	}
+
+	TArray<FTagDelta> Deltas;
+	for (const FMemoryTagStats& Entry : After)
+	{
+		const FMemoryTagStats* Old = BeforeByTag[Entry.Tag];
+		const int64 DeltaBytes = Entry.CurrentBytes - (Old ? Old->CurrentBytes : 0);
+		const int64 DeltaCount = Entry.LiveCount - (Old ? Old->LiveCount : 0);
+		if (DeltaBytes != 0 || DeltaCount != 0)
+		{
+			Deltas.Add({ Entry.Name, DeltaBytes, DeltaCount });
+		}
+	}
+	Deltas.Sort([](const FTagDelta& A, const FTagDelta& B) { return A.DeltaBytes > B.DeltaBytes; });
+
+	UE_LOG("=== Memory Tag Diff ===");
+	UE_LOG("%-32s %14s %10s", "Tag", "Delta KB", "Delta Live");
+	for (const FTagDelta& Delta : Deltas)
+	{
+		UE_LOG("%-32s %+14.1f %+10lld", Delta.Name, Delta.DeltaBytes / 1024.0, Delta.DeltaCount);
+	}
+	if (Deltas.IsEmpty())
+	{
+		UE_LOG("No changes.");
+	}
+}
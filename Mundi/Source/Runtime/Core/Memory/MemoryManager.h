@@ -1,7 +1,56 @@
 ﻿#pragma once
 #include <cstddef>
+#include <atomic>
 #include "UEContainer.h"
 
+/** 크기 클래스별 점유 현황 */
+struct FMemorySizeClassStats
+{
+	uint32 SlotSize = 0;        // 사용자에게 돌려주는 최대 크기
+	uint64 LiveCount = 0;       // 현재 사용 중인 슬롯 수
+	uint64 CapacityCount = 0;   // 지금까지 블록으로 확보한 전체 슬롯 수
+	uint64 BlockCount = 0;      // 시스템에서 할당한 블록 수
+};
+
+/**
+ * 메모리 태그
+ * - 할당마다 헤더에 태그를 기록하고 태그별로 현재/최대 바이트와 할당 수를 집계합니다.
+ * - 0 ~ NumBuiltin-1 은 엔진 서브시스템용 고정 태그, 그 뒤는 UClass 등 이름으로 등록한 동적 태그입니다.
+ */
+namespace EMemoryTag
+{
+	enum : uint16
+	{
+		Untagged = 0,
+		Particles,
+		Animation,
+		ResourceManager,
+		Physics,
+		Lua,
+		FrameArena,
+
+		NumBuiltin
+	};
+}
+
+/** 태그별 집계 */
+struct FMemoryTagStats
+{
+	uint16 Tag = 0;
+	const char* Name = nullptr;
+	int64 CurrentBytes = 0;
+	int64 PeakBytes = 0;
+	int64 LiveCount = 0;        // 현재 살아 있는 할당 수
+	uint64 TotalCount = 0;      // 누적 할당 횟수
+};
+
+/**
+ * 엔진 범용 할당자
+ * - 작은 할당(<= MaxSmallSize, 정렬 <= 16)은 크기 클래스별 풀에서 가져옵니다.
+ *   스레드마다 자유 목록 캐시를 두어 대부분의 할당/해제는 잠금 없이 처리됩니다.
+ * - 그 외에는 _aligned_malloc 으로 바로 할당합니다.
+ * - 통계는 64비트 원자 변수로 집계합니다.
+ */
 class FMemoryManager
 {
 public:
@@ -9,7 +58,49 @@ public:
 	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
 	static void  Deallocate(void* Ptr);
 
+	/** Allocate로 받은 포인터의 요청 크기 */
+	static SIZE_T GetAllocationSize(void* Ptr);
+
+	/** 블록을 옮기지 않고 쓸 수 있는 크기 (작은 할당은 크기 클래스 크기, 큰 할당은 요청 크기) */
+	static SIZE_T GetUsableSize(void* Ptr);
+
+	/** 크기 클래스별 점유 현황 */
+	static void GetSizeClassStats(TArray<FMemorySizeClassStats>& OutStats);
+	static void DumpSizeClassReport();
+
+	static constexpr SIZE_T MaxSmallSize = 4096;
+
+	/** 태그 - 같은 이름은 같은 태그를 돌려줍니다. (태그가 가득 차면 Untagged) */
+	static uint16 RegisterTag(const char* Name);
+	static const char* GetTagName(uint16 Tag);
+	static constexpr uint32 MaxTags = 1024;
+
+	/** 현재 스레드의 태그 (FMemoryTagScope 사용 권장). SetCurrentTag는 이전 태그를 반환 */
+	static uint16 GetCurrentTag();
+	static uint16 SetCurrentTag(uint16 Tag);
+
+	/** 태그별 집계 - 한 번이라도 할당한 태그만 담습니다. 스냅샷으로 보관했다가 Diff에 넘길 수 있습니다. */
+	static void GetTagStats(TArray<FMemoryTagStats>& OutStats);
+	static void DumpTagReport();
+	static void DumpTagDiff(const TArray<FMemoryTagStats>& Before, const TArray<FMemoryTagStats>& After);
+
+public:
+	static std::atomic<uint64> TotalAllocationBytes;
+	static std::atomic<uint64> TotalAllocationCount;
+	static std::atomic<uint64> PeakAllocationBytes;
+};
+
+/** 스코프 동안 현재 스레드의 할당에 태그를 붙입니다 (중첩 시 안쪽 태그 우선) */
+class FMemoryTagScope
+{
 public:
-	static uint32 TotalAllocationBytes;
-	static uint32 TotalAllocationCount;
-};
\ No newline at end of file
+	explicit FMemoryTagScope(uint16 Tag) : PreviousTag(FMemoryManager::SetCurrentTag(Tag)) {}
+	~FMemoryTagScope() { FMemoryManager::SetCurrentTag(PreviousTag); }
+
+	FMemoryTagScope(const FMemoryTagScope&) = delete;
+	FMemoryTagScope& operator=(const FMemoryTagScope&) = delete;
+
+private:
+	uint16 PreviousTag;
+};
+
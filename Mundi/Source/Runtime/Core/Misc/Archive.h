@@ -11,8 +11,8 @@ public:
     virtual ~FArchive() {}
 
     virtual void Serialize(void* Data, int64 Length) = 0;
-    /*virtual void Seek(size_t Position) = 0;
-    virtual size_t Tell() const = 0;*/
+    virtual void Seek(int64 Position) = 0;
+    virtual int64 Tell() const = 0;
     virtual bool Close() = 0;
 
     // 상태 확인 함수
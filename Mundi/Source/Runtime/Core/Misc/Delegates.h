@@ -1,74 +1,398 @@
 ﻿#pragma once
 
 #include <vector>
-#include <functional>
 #include <algorithm>
 #include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "WeakObjectPtr.h"
+
+class UObject;
 
 using FDelegateHandle = size_t;
 
+/**
+ * 약한 바인딩 표시 - 호출 객체에 static constexpr bool bWeakBinding = true를 두면
+ * operator()가 돌려주는 bool을 "대상이 살아 있음"으로 해석합니다. (그 외 호출 객체의 반환값은 무시)
+ */
+template<typename FuncType, typename = void>
+struct TIsWeakDelegateBinding : std::false_type {};
+
+template<typename FuncType>
+struct TIsWeakDelegateBinding<FuncType, std::void_t<decltype(FuncType::bWeakBinding)>> : std::bool_constant<FuncType::bWeakBinding> {};
+
+/**
+ * 델리게이트 바인딩 하나를 담는 호출 객체
+ * - 멤버 함수 바인딩과 작은 람다는 인라인 버퍼에 저장되어 힙 할당이 없습니다. (버퍼보다 큰 호출 객체만 힙 사용)
+ * - 약한 바인딩(TIsWeakDelegateBinding)만 반환값을 보고, false(대상 삭제됨)면 Broadcast가 목록에서 제거합니다.
+ */
+template<typename... Args>
+class TDelegateCallable
+{
+public:
+	// 약한 객체 참조(8) + 멤버 함수 포인터(MSVC 최대 24)
+	static constexpr size_t InlineSize = 32;
+
+	TDelegateCallable() = default;
+
+	template<typename FuncType, typename = std::enable_if_t<!std::is_same_v<std::decay_t<FuncType>, TDelegateCallable>>>
+	explicit TDelegateCallable(FuncType&& Func)
+	{
+		using StoredType = std::decay_t<FuncType>;
+		if constexpr (IsInline<StoredType>())
+		{
+			new (Storage) StoredType(std::forward<FuncType>(Func));
+		}
+		else
+		{
+			*reinterpret_cast<StoredType**>(Storage) = new StoredType(std::forward<FuncType>(Func));
+		}
+		InvokeFunc = &TOps<StoredType>::Invoke;
+		Ops = &TOps<StoredType>::Table;
+	}
+
+	TDelegateCallable(const TDelegateCallable& Other)
+	{
+		if (Other.Ops)
+		{
+			Other.Ops->Copy(Storage, Other.Storage);
+			InvokeFunc = Other.InvokeFunc;
+			Ops = Other.Ops;
+		}
+	}
+
+	TDelegateCallable(TDelegateCallable&& Other) noexcept
+	{
+		if (Other.Ops)
+		{
+			Other.Ops->Move(Storage, Other.Storage);
+			InvokeFunc = Other.InvokeFunc;
+			Ops = Other.Ops;
+			Other.Ops = nullptr;
+		}
+	}
+
+	TDelegateCallable& operator=(const TDelegateCallable& Other)
+	{
+		if (this != &Other)
+		{
+			TDelegateCallable Copy(Other);
+			*this = std::move(Copy);
+		}
+		return *this;
+	}
+
+	TDelegateCallable& operator=(TDelegateCallable&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			Reset();
+			if (Other.Ops)
+			{
+				Other.Ops->Move(Storage, Other.Storage);
+				InvokeFunc = Other.InvokeFunc;
+				Ops = Other.Ops;
+				Other.Ops = nullptr;
+			}
+		}
+		return *this;
+	}
+
+	~TDelegateCallable() { Reset(); }
+
+	void Reset()
+	{
+		if (Ops)
+		{
+			Ops->Destroy(Storage);
+			Ops = nullptr;
+			InvokeFunc = nullptr;
+		}
+	}
+
+	bool IsSet() const { return Ops != nullptr; }
+	/** 호출 - 약한 바인딩 대상이 삭제되었으면 호출하지 않고 false */
+	bool Invoke(Args... Params) const { return InvokeFunc(Storage, Params...); }
+
+private:
+	template<typename StoredType>
+	static constexpr bool IsInline()
+	{
+		return sizeof(StoredType) <= InlineSize && alignof(StoredType) <= alignof(void*)
+			&& std::is_nothrow_move_constructible_v<StoredType>;
+	}
+
+	using FInvokeFunc = bool (*)(const void* Storage, Args... Params);
+
+	/** 복사/이동/소멸 (호출 함수는 간접 참조를 줄이려고 객체에 직접 보관) */
+	struct FOps
+	{
+		void (*Copy)(void* Dest, const void* Source);
+		void (*Move)(void* Dest, void* Source);
+		void (*Destroy)(void* Storage);
+	};
+
+	template<typename StoredType>
+	struct TOps
+	{
+		static StoredType& Get(void* Storage)
+		{
+			if constexpr (IsInline<StoredType>())
+			{
+				return *std::launder(reinterpret_cast<StoredType*>(Storage));
+			}
+			else
+			{
+				return **reinterpret_cast<StoredType**>(Storage);
+			}
+		}
+
+		static const StoredType& Get(const void* Storage) { return Get(const_cast<void*>(Storage)); }
+
+		static bool Invoke(const void* Storage, Args... Params)
+		{
+			// 바인딩 대상은 const가 아닐 수 있음 (std::function과 같은 의미)
+			StoredType& Func = Get(const_cast<void*>(Storage));
+			if constexpr (TIsWeakDelegateBinding<StoredType>::value)
+			{
+				return Func(Params...);
+			}
+			else
+			{
+				Func(Params...);
+				return true;
+			}
+		}
+
+		static void Copy(void* Dest, const void* Source)
+		{
+			if constexpr (IsInline<StoredType>())
+			{
+				new (Dest) StoredType(Get(Source));
+			}
+			else
+			{
+				*reinterpret_cast<StoredType**>(Dest) = new StoredType(Get(Source));
+			}
+		}
+
+		static void Move(void* Dest, void* Source)
+		{
+			if constexpr (IsInline<StoredType>())
+			{
+				new (Dest) StoredType(std::move(Get(Source)));
+				Get(Source).~StoredType();
+			}
+			else
+			{
+				*reinterpret_cast<StoredType**>(Dest) = *reinterpret_cast<StoredType**>(Source);
+			}
+		}
+
+		static void Destroy(void* Storage)
+		{
+			if constexpr (IsInline<StoredType>())
+			{
+				Get(Storage).~StoredType();
+			}
+			else
+			{
+				delete *reinterpret_cast<StoredType**>(Storage);
+			}
+		}
+
+		static constexpr FOps Table = { &Copy, &Move, &Destroy };
+	};
+
+	alignas(void*) unsigned char Storage[InlineSize];
+	FInvokeFunc InvokeFunc = nullptr;
+	const FOps* Ops = nullptr;
+};
+
+/**
+ * 멀티캐스트 델리게이트
+ * - 바인딩은 연속 배열에 저장되고 Broadcast는 배열을 순서대로 호출합니다.
+ * - Broadcast 도중의 Add/Remove/Clear는 안전합니다.
+ *   추가된 바인딩은 이번 Broadcast가 끝난 뒤 합류하고, 제거된 바인딩은 즉시 건너뛰며 Broadcast 후에 정리됩니다.
+ * - AddDynamic에 GUObjectArray에 등록된 UObject를 넘기면 약한 바인딩이 되어, 객체가 삭제되면 자동으로 빠집니다.
+ */
 template<typename... Args>
 class TDelegate
 {
 public:
-	using HandlerType = std::function<void(Args...)>;
+	using CallableType = TDelegateCallable<Args...>;
 
 	TDelegate() : NextHandle(1) {}
 
-	FDelegateHandle Add(const HandlerType& Handler)
+	template<typename FuncType>
+	FDelegateHandle Add(FuncType&& Handler)
 	{
-		FDelegateHandle Handle = NextHandle++;
-		Handlers.push_back({ Handle, Handler });
-		return Handle;
+		return AddCallable(CallableType(std::forward<FuncType>(Handler)));
 	}
 
 	// original: template<typename T>
 	template<typename TObj, typename TClass>
 	FDelegateHandle AddDynamic(TObj* Instance, void(TClass::* Func)(Args...))
 	{
-		FDelegateHandle Handle = NextHandle++;
-		Handlers.push_back({
-			Handle,
-			[=](Args... args) {
-			(Instance->*Func)(args...); }
-		});
-		return Handle;
+		using MethodType = void(TClass::*)(Args...);
+		if constexpr (std::is_base_of_v<UObject, TObj>)
+		{
+			TWeakObjectPtr<TObj> WeakInstance(Instance);
+			if (WeakInstance.IsValid())
+			{
+				return AddCallable(CallableType(TWeakMethodBinding<TObj, MethodType>{ WeakInstance, Func }));
+			}
+		}
+		// 등록되지 않은 객체나 UObject가 아닌 객체는 원시 포인터로 바인딩
+		return AddCallable(CallableType(TRawMethodBinding<TObj, MethodType>{ Instance, Func }));
 	}
 
-	void Broadcast(Args... args) 
+	void Broadcast(Args... args)
 	{
-		for (auto& Entry : Handlers) {
-			if (Entry.Handler)
+		++BroadcastDepth;
+
+		// Broadcast 중에는 Handlers가 재할당되지 않으므로 (추가는 PendingHandlers로, 제거는 표시만) 포인터가 유지됨
+		Entry* const Begin = Handlers.data();
+		Entry* const End = Begin + Handlers.size();
+		for (Entry* It = Begin; It != End; ++It)
+		{
+			Entry& Current = *It;
+			if (Current.Handle != 0 && !Current.Handler.Invoke(args...))
 			{
-				Entry.Handler(args...);
+				// 약한 바인딩 대상이 삭제됨
+				Current.Handle = 0;
+				bHasRemovedHandlers = true;
 			}
 		}
+
+		if (--BroadcastDepth == 0)
+		{
+			FlushPendingChanges();
+		}
 	}
 
 	void Remove(FDelegateHandle Handle)
 	{
-		auto it = std::remove_if(Handlers.begin(), Handlers.end(),
-		[&](const Entry& e)
+		if (Handle == 0)
+		{
+			return;
+		}
+
+		auto PendingIt = std::find_if(PendingHandlers.begin(), PendingHandlers.end(),
+			[Handle](const Entry& e) { return e.Handle == Handle; });
+		if (PendingIt != PendingHandlers.end())
+		{
+			PendingHandlers.erase(PendingIt);
+			return;
+		}
+
+		auto it = std::find_if(Handlers.begin(), Handlers.end(),
+			[Handle](const Entry& e) { return e.Handle == Handle; });
+		if (it == Handlers.end())
+		{
+			return;
+		}
+
+		if (BroadcastDepth > 0)
+		{
+			// 호출 중인 바인딩일 수 있으므로 표시만 하고 Broadcast 후 정리
+			it->Handle = 0;
+			bHasRemovedHandlers = true;
+		}
+		else
 		{
-			return e.Handle == Handle;
-		});
-		Handlers.erase(it, Handlers.end());
+			Handlers.erase(it);
+		}
 	}
 
 	void Clear()
 	{
-		Handlers.clear();
+		PendingHandlers.clear();
+		if (BroadcastDepth > 0)
+		{
+			for (Entry& e : Handlers)
+			{
+				e.Handle = 0;
+			}
+			bHasRemovedHandlers = true;
+		}
+		else
+		{
+			Handlers.clear();
+		}
+	}
+
+	bool IsBound() const
+	{
+		return !PendingHandlers.empty()
+			|| std::any_of(Handlers.begin(), Handlers.end(), [](const Entry& e) { return e.Handle != 0; });
 	}
 
 private:
 	struct Entry
 	{
 		FDelegateHandle Handle;
-		HandlerType Handler;
+		CallableType Handler;
+	};
+
+	template<typename TObj, typename MethodType>
+	struct TRawMethodBinding
+	{
+		TObj* Object;
+		MethodType Method;
+
+		void operator()(Args... args) const { (Object->*Method)(args...); }
+	};
+
+	template<typename TObj, typename MethodType>
+	struct TWeakMethodBinding
+	{
+		static constexpr bool bWeakBinding = true;
+
+		TWeakObjectPtr<TObj> Object;
+		MethodType Method;
+
+		bool operator()(Args... args) const
+		{
+			TObj* Instance = Object.Get();
+			if (!Instance)
+			{
+				return false;
+			}
+			(Instance->*Method)(args...);
+			return true;
+		}
 	};
 
+	FDelegateHandle AddCallable(CallableType&& Handler)
+	{
+		FDelegateHandle Handle = NextHandle++;
+		std::vector<Entry>& Target = BroadcastDepth > 0 ? PendingHandlers : Handlers;
+		Target.push_back({ Handle, std::move(Handler) });
+		return Handle;
+	}
+
+	void FlushPendingChanges()
+	{
+		if (bHasRemovedHandlers)
+		{
+			Handlers.erase(std::remove_if(Handlers.begin(), Handlers.end(),
+				[](const Entry& e) { return e.Handle == 0; }), Handlers.end());
+			bHasRemovedHandlers = false;
+		}
+		for (Entry& Pending : PendingHandlers)
+		{
+			Handlers.push_back(std::move(Pending));
+		}
+		PendingHandlers.clear();
+	}
+
 	std::vector<Entry> Handlers;
+	std::vector<Entry> PendingHandlers;
 	FDelegateHandle NextHandle;
+	int32 BroadcastDepth = 0;
+	bool bHasRemovedHandlers = false;
 };
 
 // 델리게이트 인스턴스 생성용 매크로 (실제 멤버 변수 선언)
@@ -1,62 +1,309 @@
-﻿#include "pch.h"
+#include "pch.h"
 #include "Name.h"
+#include <cstdio>
+#include <mutex>
 
 namespace
 {
-    // NameMap을 안전하게 가져오는 getter
-    static TMap<FString, uint32>& GetNameMap()
+    // 엔트리 청크 - 한 번 할당하면 옮기지 않음 (최대 EntriesPerChunk * MaxChunks 개의 이름)
+    constexpr uint32 EntriesPerChunkBits = 12;
+    constexpr uint32 EntriesPerChunk = 1u << EntriesPerChunkBits;
+    constexpr uint32 MaxChunks = 4096;
+
+    // 해시 상위 비트로 샤드 선택
+    constexpr uint32 NumShardBits = 4;
+    constexpr uint32 NumShards = 1u << NumShardBits;
+    constexpr uint32 InitialTableCapacity = 64;
+
+    inline char ToLowerAscii(char c)
     {
-        // 함수 내의 static 변수는 처음 호출될 때 스레드에 안전하게
-        // 단 한 번만 초기화됩니다.
-        static TMap<FString, uint32> GNameMap;
-        return GNameMap;
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
     }
 
-    // Entries를 안전하게 가져오는 getter
-    static TArray<FNameEntry>& GetEntries()
+    bool EqualsIgnoreCase(const FString& Lower, std::string_view InStr)
     {
-        static TArray<FNameEntry> GEntries;
-        return GEntries;
+        if (Lower.size() != InStr.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < InStr.size(); ++i)
+        {
+            if (Lower[i] != ToLowerAscii(InStr[i]))
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
-    // FString을 소문자로 변환하는 헬퍼 함수
-    static FString ToLower(const FString& InStr)
+    /**
+     * 샤드 해시 테이블 (선형 탐사)
+     * 슬롯 = (Hash << 32) | (Index + 1), 0이면 빈 슬롯. 슬롯은 한 번 채워지면 바뀌지 않습니다.
+     */
+    struct FNameTable
     {
-        FString Result = InStr;
-        std::transform(Result.begin(), Result.end(), Result.begin(),
-            [](unsigned char c) { return std::tolower(c); });
-        return Result;
+        uint32 Capacity;
+        std::atomic<uint64>* Slots;
+
+        explicit FNameTable(uint32 InCapacity)
+            : Capacity(InCapacity)
+            , Slots(new std::atomic<uint64>[InCapacity])
+        {
+            for (uint32 i = 0; i < Capacity; ++i)
+            {
+                Slots[i].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        void InsertSlot(uint64 SlotValue)
+        {
+            const uint32 Mask = Capacity - 1;
+            for (uint32 Pos = static_cast<uint32>(SlotValue >> 32) & Mask;; Pos = (Pos + 1) & Mask)
+            {
+                if (Slots[Pos].load(std::memory_order_relaxed) == 0)
+                {
+                    // 엔트리 생성이 끝난 뒤 공개 (읽기 쪽 acquire와 짝)
+                    Slots[Pos].store(SlotValue, std::memory_order_release);
+                    return;
+                }
+            }
+        }
+    };
+
+    struct FNameShard
+    {
+        std::mutex WriteMutex;
+        std::atomic<FNameTable*> Table{ nullptr };
+        uint32 Count = 0;                   // WriteMutex 보호
+        TArray<FNameTable*> RetiredTables;  // 잠금 없이 읽는 스레드가 있을 수 있어 해제하지 않음
+    };
+
+    struct FNamePoolState
+    {
+        std::atomic<FNameEntry*> Chunks[MaxChunks] = {};
+        std::atomic<uint32> NumEntries{ 0 };
+        FNameShard Shards[NumShards];
+    };
+
+    FNamePoolState& GetState()
+    {
+        // 종료 시점의 FName 사용(정적 소멸자 등)을 위해 해제하지 않음
+        static FNamePoolState* State = new FNamePoolState();
+        return *State;
+    }
+
+    FNameEntry* GetEntrySlot(FNamePoolState& State, uint32 Index)
+    {
+        FNameEntry* Chunk = State.Chunks[Index >> EntriesPerChunkBits].load(std::memory_order_acquire);
+        return Chunk ? Chunk + (Index & (EntriesPerChunk - 1)) : nullptr;
     }
+
+    /** 새 엔트리 자리를 예약하고 생성 (호출자는 샤드 잠금을 잡은 상태) */
+    uint32 AllocateEntry(FNamePoolState& State, std::string_view InStr, uint32 Hash)
+    {
+        const uint32 Index = State.NumEntries.fetch_add(1, std::memory_order_relaxed);
+        const uint32 ChunkIndex = Index >> EntriesPerChunkBits;
+        if (ChunkIndex >= MaxChunks)
+        {
+            std::abort(); // 이름 풀 한도 초과
+        }
+
+        FNameEntry* Chunk = State.Chunks[ChunkIndex].load(std::memory_order_acquire);
+        if (!Chunk)
+        {
+            // 여러 샤드가 동시에 새 청크를 만들 수 있으므로 CAS로 하나만 채택
+            FNameEntry* NewChunk = static_cast<FNameEntry*>(::operator new(sizeof(FNameEntry) * EntriesPerChunk));
+            if (State.Chunks[ChunkIndex].compare_exchange_strong(Chunk, NewChunk, std::memory_order_acq_rel))
+            {
+                Chunk = NewChunk;
+            }
+            else
+            {
+                ::operator delete(NewChunk);
+            }
+        }
+
+        FNameEntry* Entry = new (Chunk + (Index & (EntriesPerChunk - 1))) FNameEntry();
+        Entry->Display.assign(InStr.data(), InStr.size());
+        Entry->Comparison.resize(InStr.size());
+        for (size_t i = 0; i < InStr.size(); ++i)
+        {
+            Entry->Comparison[i] = ToLowerAscii(InStr[i]);
+        }
+        Entry->Hash = Hash;
+        return Index;
+    }
+
+    /** 잠금 없이 테이블 조회, 없으면 UINT32_MAX */
+    uint32 FindInTable(FNamePoolState& State, const FNameTable* Table, uint32 Hash, std::string_view InStr)
+    {
+        if (!Table)
+        {
+            return UINT32_MAX;
+        }
+
+        const uint32 Mask = Table->Capacity - 1;
+        for (uint32 Pos = Hash & Mask;; Pos = (Pos + 1) & Mask)
+        {
+            const uint64 Slot = Table->Slots[Pos].load(std::memory_order_acquire);
+            if (Slot == 0)
+            {
+                return UINT32_MAX;
+            }
+            if (static_cast<uint32>(Slot >> 32) == Hash)
+            {
+                const uint32 Index = static_cast<uint32>(Slot) - 1;
+                if (EqualsIgnoreCase(GetEntrySlot(State, Index)->Comparison, InStr))
+                {
+                    return Index;
+                }
+            }
+        }
+    }
+}
+
+uint32 FNamePool::HashIgnoreCase(std::string_view InStr)
+{
+    // 8바이트 단위로 소문자 변환하며 해시 (상위 비트는 샤드, 하위 비트는 슬롯 선택에 쓰임)
+    const uint64 Hash = FastHash::HashIgnoreCase(InStr);
+    return static_cast<uint32>(Hash ^ (Hash >> 32));
 }
 
-uint32 FNamePool::Add(const FString& InStr)
+uint32 FNamePool::Add(std::string_view InStr)
 {
-    FString Lower = ToLower(InStr);
+    FNamePoolState& State = GetState();
+    const uint32 Hash = HashIgnoreCase(InStr);
+    FNameShard& Shard = State.Shards[Hash >> (32 - NumShardBits)];
 
-    // 전역 변수 대신 getter를 통해 접근
-    TMap<FString, uint32>& NameMap = GetNameMap();
-    TArray<FNameEntry>& Entries = GetEntries();
+    // 1) 잠금 없는 조회 - 이미 있는 이름은 여기서 끝남
+    uint32 Index = FindInTable(State, Shard.Table.load(std::memory_order_acquire), Hash, InStr);
+    if (Index != UINT32_MAX)
+    {
+        return Index;
+    }
+
+    // 2) 샤드 잠금 후 다시 확인하고 추가
+    std::lock_guard<std::mutex> Lock(Shard.WriteMutex);
+    FNameTable* Table = Shard.Table.load(std::memory_order_relaxed);
+    Index = FindInTable(State, Table, Hash, InStr);
+    if (Index != UINT32_MAX)
+    {
+        return Index;
+    }
 
-    auto it = NameMap.find(Lower);
-    if (it != NameMap.end())
-        return it->second;
+    // 적재율 3/4 초과 시 두 배 테이블로 옮긴 뒤 교체 (이전 테이블은 읽는 중일 수 있어 보관)
+    if (!Table || (Shard.Count + 1) * 4 > Table->Capacity * 3)
+    {
+        FNameTable* NewTable = new FNameTable(Table ? Table->Capacity * 2 : InitialTableCapacity);
+        if (Table)
+        {
+            for (uint32 i = 0; i < Table->Capacity; ++i)
+            {
+                const uint64 Slot = Table->Slots[i].load(std::memory_order_relaxed);
+                if (Slot != 0)
+                {
+                    NewTable->InsertSlot(Slot);
+                }
+            }
+            Shard.RetiredTables.Add(Table);
+        }
+        Shard.Table.store(NewTable, std::memory_order_release);
+        Table = NewTable;
+    }
 
-    uint32 NewIndex = (uint32)Entries.size();
-    Entries.push_back({ InStr, Lower });
-    NameMap[Lower] = NewIndex;
-    return NewIndex;
+    Index = AllocateEntry(State, InStr, Hash);
+    Table->InsertSlot((static_cast<uint64>(Hash) << 32) | (static_cast<uint64>(Index) + 1));
+    ++Shard.Count;
+    return Index;
 }
 
 const FNameEntry& FNamePool::Get(uint32 Index)
 {
-    // 전역 변수 대신 getter를 통해 접근
-    TArray<FNameEntry>& Entries = GetEntries();
+    FNamePoolState& State = GetState();
 
     // (안전성 강화) 경계 검사 추가
-    if (Index >= Entries.size())
+    FNameEntry* Entry = Index < State.NumEntries.load(std::memory_order_acquire) ? GetEntrySlot(State, Index) : nullptr;
+    if (!Entry)
     {
         static FNameEntry InvalidEntry = { "Invalid", "invalid" };
         return InvalidEntry;
     }
-    return Entries[Index];
-}
\ No newline at end of file
+    return *Entry;
+}
+
+uint32 FNamePool::Num()
+{
+    return GetState().NumEntries.load(std::memory_order_acquire);
+}
+
+void FName::Init(std::string_view InStr)
+{
+    // 끝의 숫자를 찾아 "_숫자" 접미사인지 확인 (int32 범위, 선행 0 없음)
+    size_t DigitStart = InStr.size();
+    while (DigitStart > 0 && InStr[DigitStart - 1] >= '0' && InStr[DigitStart - 1] <= '9')
+    {
+        --DigitStart;
+    }
+
+    const size_t NumDigits = InStr.size() - DigitStart;
+    const bool bHasSuffix = NumDigits > 0 && NumDigits <= 9
+        && DigitStart >= 2 && InStr[DigitStart - 1] == '_'
+        && (NumDigits == 1 || InStr[DigitStart] != '0');
+
+    if (!bHasSuffix)
+    {
+        Init(InStr, 0);
+        return;
+    }
+
+    uint32 Suffix = 0;
+    for (size_t i = DigitStart; i < InStr.size(); ++i)
+    {
+        Suffix = Suffix * 10 + static_cast<uint32>(InStr[i] - '0');
+    }
+    Init(InStr.substr(0, DigitStart - 1), Suffix + 1);
+
+#if defined(DEBUG) || defined(_DEBUG)
+    DebugStr = FString(InStr);
+#endif
+}
+
+void FName::Init(std::string_view InBase, uint32 InNumber)
+{
+    const uint32 Index = FNamePool::Add(InBase);
+    DisplayIndex = Index;
+    ComparisonIndex = Index; // 필요시 다른 규칙 적용 가능
+    Number = InNumber;
+
+#if defined(DEBUG) || defined(_DEBUG)
+    DebugStr = ToString();
+#endif
+}
+
+FString FName::ToString() const
+{
+    if (Number == 0)
+    {
+        return GetPlainNameString();
+    }
+
+    FString Result;
+    AppendString(Result);
+    return Result;
+}
+
+void FName::AppendString(FString& Out) const
+{
+    const FString& Base = GetPlainNameString();
+    if (Number == 0)
+    {
+        Out.append(Base);
+        return;
+    }
+
+    char Suffix[16];
+    const int32 SuffixLength = std::snprintf(Suffix, sizeof(Suffix), "_%u", Number - 1);
+    Out.reserve(Out.size() + Base.size() + SuffixLength);
+    Out.append(Base);
+    Out.append(Suffix, SuffixLength);
+}
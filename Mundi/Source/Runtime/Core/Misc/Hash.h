@@ -5,7 +5,7 @@
 // FName에 대한 GetTypeHash 오버로드입니다.
 inline uint64 GetTypeHash(const FName& Name)
 {
-    return static_cast<uint64>(Name.ComparisonIndex);
+    return (static_cast<uint64>(Name.Number) << 32) | Name.ComparisonIndex;
 }
 
 // 두 개의 해시 값을 안전하게 조합합니다. (Boost::hash_combine 알고리즘 기반)
@@ -0,0 +1,528 @@
+﻿#include "pch.h"
+#include "JsonReader.h"
+#include "JsonSerializer.h"
+#include "MappedFileReader.h"
+#include <charconv>
+#include <cstdio>
+
+namespace
+{
+    // 악의적/손상된 입력으로 ReadValue 재귀가 스택을 넘지 않도록 제한
+    constexpr int32 MaxDepth = 512;
+
+    inline bool IsDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    inline int32 HexValue(char c)
+    {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    void AppendUtf8(FString& Out, uint32 CodePoint)
+    {
+        if (CodePoint < 0x80)
+        {
+            Out.push_back(static_cast<char>(CodePoint));
+        }
+        else if (CodePoint < 0x800)
+        {
+            Out.push_back(static_cast<char>(0xC0 | (CodePoint >> 6)));
+            Out.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+        }
+        else if (CodePoint < 0x10000)
+        {
+            Out.push_back(static_cast<char>(0xE0 | (CodePoint >> 12)));
+            Out.push_back(static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F)));
+            Out.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+        }
+        else
+        {
+            Out.push_back(static_cast<char>(0xF0 | (CodePoint >> 18)));
+            Out.push_back(static_cast<char>(0x80 | ((CodePoint >> 12) & 0x3F)));
+            Out.push_back(static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F)));
+            Out.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+        }
+    }
+}
+
+FJsonReader::FJsonReader(const char* InData, SIZE_T InSize)
+    : Begin(InData)
+    , Cursor(InData)
+    , End(InData + InSize)
+    , bValid(InData != nullptr || InSize == 0)
+{
+    // UTF-8 BOM 건너뜀
+    if (InSize >= 3 && static_cast<uint8>(InData[0]) == 0xEF && static_cast<uint8>(InData[1]) == 0xBB && static_cast<uint8>(InData[2]) == 0xBF)
+    {
+        Cursor += 3;
+    }
+}
+
+FJsonReader::FJsonReader(const FWideString& InFilePath)
+    : File(std::make_unique<FMappedFileReader>(WideToUTF8(InFilePath)))
+{
+    if (!File->IsOpen())
+    {
+        return;
+    }
+
+    const char* Data = reinterpret_cast<const char*>(File->GetData());
+    const SIZE_T Size = static_cast<SIZE_T>(File->GetSize());
+    Begin = Cursor = Data;
+    End = Data + Size;
+    if (Size >= 3 && static_cast<uint8>(Data[0]) == 0xEF && static_cast<uint8>(Data[1]) == 0xBB && static_cast<uint8>(Data[2]) == 0xBF)
+    {
+        Cursor += 3;
+    }
+    bValid = true;
+}
+
+FJsonReader::~FJsonReader() = default;
+
+EJsonToken FJsonReader::Fail(const char* InMessage)
+{
+    if (Token != EJsonToken::Error)
+    {
+        char Buffer[256];
+        std::snprintf(Buffer, sizeof(Buffer), "%s (offset %lld)", InMessage, static_cast<long long>(Cursor - Begin));
+        ErrorMessage = Buffer;
+        Token = EJsonToken::Error;
+    }
+    return Token;
+}
+
+void FJsonReader::SkipWhitespace()
+{
+    while (Cursor < End && (*Cursor == ' ' || *Cursor == '\n' || *Cursor == '\r' || *Cursor == '\t'))
+    {
+        ++Cursor;
+    }
+}
+
+EJsonToken FJsonReader::Next()
+{
+    if (Token == EJsonToken::Error)
+    {
+        return Token;
+    }
+    if (!bValid)
+    {
+        return Fail("파일을 열 수 없습니다");
+    }
+
+    SkipWhitespace();
+
+    if (Stack.IsEmpty())
+    {
+        if (!bDone)
+        {
+            return ParseValueStart();
+        }
+        if (Cursor != End)
+        {
+            return Fail("문서 끝 뒤에 내용이 남아 있습니다");
+        }
+        return Token = EJsonToken::None;
+    }
+
+    const bool bInObject = Stack.Last() == '{';
+    if (!bAfterKey)
+    {
+        if (Cursor < End && *Cursor == (bInObject ? '}' : ']'))
+        {
+            ++Cursor;
+            Stack.Pop();
+            bNeedComma = true;
+            bDone = Stack.IsEmpty();
+            return Token = bInObject ? EJsonToken::EndObject : EJsonToken::EndArray;
+        }
+
+        if (bNeedComma)
+        {
+            if (Cursor >= End || *Cursor != ',')
+            {
+                return Fail("',' 가 필요합니다");
+            }
+            ++Cursor;
+            SkipWhitespace();
+        }
+
+        if (bInObject)
+        {
+            if (Cursor >= End || *Cursor != '"')
+            {
+                return Fail("객체 키가 필요합니다");
+            }
+            if (!ParseString())
+            {
+                return Token;
+            }
+            SkipWhitespace();
+            if (Cursor >= End || *Cursor != ':')
+            {
+                return Fail("':' 가 필요합니다");
+            }
+            ++Cursor;
+            bAfterKey = true;
+            return Token = EJsonToken::Key;
+        }
+    }
+
+    bAfterKey = false;
+    return ParseValueStart();
+}
+
+EJsonToken FJsonReader::ParseValueStart()
+{
+    if (Cursor >= End)
+    {
+        return Fail("값이 필요합니다");
+    }
+
+    EJsonToken NewToken;
+    switch (*Cursor)
+    {
+    case '{':
+    case '[':
+        if (Stack.Num() >= MaxDepth)
+        {
+            return Fail("중첩이 너무 깊습니다");
+        }
+        Stack.Add(*Cursor);
+        ++Cursor;
+        bNeedComma = false;
+        return Token = (Stack.Last() == '{') ? EJsonToken::BeginObject : EJsonToken::BeginArray;
+    case '"':
+        if (!ParseString())
+        {
+            return Token;
+        }
+        NewToken = EJsonToken::String;
+        break;
+    case 't':
+        if (!ParseLiteral("true"))
+        {
+            return Token;
+        }
+        NewToken = EJsonToken::True;
+        break;
+    case 'f':
+        if (!ParseLiteral("false"))
+        {
+            return Token;
+        }
+        NewToken = EJsonToken::False;
+        break;
+    case 'n':
+        if (!ParseLiteral("null"))
+        {
+            return Token;
+        }
+        NewToken = EJsonToken::Null;
+        break;
+    default:
+        if (*Cursor != '-' && !IsDigit(*Cursor))
+        {
+            return Fail("알 수 없는 값입니다");
+        }
+        if (!ParseNumber())
+        {
+            return Token;
+        }
+        NewToken = EJsonToken::Number;
+        break;
+    }
+
+    bNeedComma = true;
+    bDone = Stack.IsEmpty();
+    return Token = NewToken;
+}
+
+bool FJsonReader::ParseString()
+{
+    ++Cursor; // 여는 따옴표
+
+    // 이스케이프가 없으면 버퍼를 그대로 참조
+    const char* Start = Cursor;
+    while (Cursor < End && *Cursor != '"' && *Cursor != '\\')
+    {
+        ++Cursor;
+    }
+    if (Cursor >= End)
+    {
+        Fail("문자열이 닫히지 않았습니다");
+        return false;
+    }
+    if (*Cursor == '"')
+    {
+        Value = std::string_view(Start, static_cast<SIZE_T>(Cursor - Start));
+        ++Cursor;
+        return true;
+    }
+
+    // 이스케이프가 있으면 Scratch에 풀어 씀
+    Scratch.assign(Start, Cursor);
+    while (Cursor < End && *Cursor != '"')
+    {
+        const char c = *Cursor++;
+        if (c != '\\')
+        {
+            Scratch.push_back(c);
+            continue;
+        }
+        if (Cursor >= End)
+        {
+            break;
+        }
+
+        const char Escape = *Cursor++;
+        switch (Escape)
+        {
+        case '"':  Scratch.push_back('"');  break;
+        case '\\': Scratch.push_back('\\'); break;
+        case '/':  Scratch.push_back('/');  break;
+        case 'b':  Scratch.push_back('\b'); break;
+        case 'f':  Scratch.push_back('\f'); break;
+        case 'n':  Scratch.push_back('\n'); break;
+        case 'r':  Scratch.push_back('\r'); break;
+        case 't':  Scratch.push_back('\t'); break;
+        case 'u':
+        {
+            auto ReadHex4 = [this](uint32& OutUnit) -> bool
+                {
+                    if (End - Cursor < 4)
+                    {
+                        return false;
+                    }
+                    OutUnit = 0;
+                    for (int32 i = 0; i < 4; ++i)
+                    {
+                        const int32 Digit = HexValue(Cursor[i]);
+                        if (Digit < 0)
+                        {
+                            return false;
+                        }
+                        OutUnit = (OutUnit << 4) | static_cast<uint32>(Digit);
+                    }
+                    Cursor += 4;
+                    return true;
+                };
+
+            uint32 CodePoint;
+            if (!ReadHex4(CodePoint))
+            {
+                Fail("잘못된 \\u 이스케이프입니다");
+                return false;
+            }
+            // 서로게이트 쌍
+            if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF
+                && End - Cursor >= 2 && Cursor[0] == '\\' && Cursor[1] == 'u')
+            {
+                Cursor += 2;
+                uint32 Low;
+                if (!ReadHex4(Low) || Low < 0xDC00 || Low > 0xDFFF)
+                {
+                    Fail("잘못된 서로게이트 쌍입니다");
+                    return false;
+                }
+                CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+            }
+            AppendUtf8(Scratch, CodePoint);
+            break;
+        }
+        default:
+            Fail("알 수 없는 이스케이프 문자입니다");
+            return false;
+        }
+    }
+
+    if (Cursor >= End)
+    {
+        Fail("문자열이 닫히지 않았습니다");
+        return false;
+    }
+    ++Cursor; // 닫는 따옴표
+    Value = Scratch;
+    return true;
+}
+
+bool FJsonReader::ParseNumber()
+{
+    const char* Start = Cursor;
+    bIntegral = true;
+    if (*Cursor == '-')
+    {
+        ++Cursor;
+    }
+    while (Cursor < End)
+    {
+        const char c = *Cursor;
+        if (c == '.' || c == 'e' || c == 'E')
+        {
+            bIntegral = false;
+        }
+        else if (!IsDigit(c) && !((c == '+' || c == '-') && (Cursor[-1] == 'e' || Cursor[-1] == 'E')))
+        {
+            break;
+        }
+        ++Cursor;
+    }
+
+    if (bIntegral)
+    {
+        const std::from_chars_result Result = std::from_chars(Start, Cursor, Integer);
+        if (Result.ec == std::errc() && Result.ptr == Cursor)
+        {
+            Number = static_cast<double>(Integer);
+            return true;
+        }
+        // int64 범위를 넘으면 실수로 처리
+        bIntegral = false;
+    }
+
+    const std::from_chars_result Result = std::from_chars(Start, Cursor, Number);
+    if (Result.ec != std::errc() || Result.ptr != Cursor)
+    {
+        Fail("잘못된 숫자입니다");
+        return false;
+    }
+    Integer = static_cast<int64>(Number);
+    return true;
+}
+
+bool FJsonReader::ParseLiteral(std::string_view InLiteral)
+{
+    if (static_cast<SIZE_T>(End - Cursor) < InLiteral.size() || std::string_view(Cursor, InLiteral.size()) != InLiteral)
+    {
+        Fail("알 수 없는 값입니다");
+        return false;
+    }
+    Cursor += InLiteral.size();
+    return true;
+}
+
+bool FJsonReader::SkipValue()
+{
+    if (Token == EJsonToken::Key)
+    {
+        Next();
+    }
+
+    switch (Token)
+    {
+    case EJsonToken::BeginObject:
+    case EJsonToken::BeginArray:
+    {
+        const int32 ParentDepth = Stack.Num() - 1;
+        while (Stack.Num() > ParentDepth)
+        {
+            if (Next() == EJsonToken::Error)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    case EJsonToken::String:
+    case EJsonToken::Number:
+    case EJsonToken::True:
+    case EJsonToken::False:
+    case EJsonToken::Null:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool FJsonReader::ReadValue(JSON& OutJson)
+{
+    if (Token == EJsonToken::Key)
+    {
+        Next();
+    }
+    return ReadValueInternal(OutJson);
+}
+
+bool FJsonReader::ReadValueInternal(JSON& OutJson)
+{
+    switch (Token)
+    {
+    case EJsonToken::BeginObject:
+        OutJson = JSON::Make(JSON::Class::Object);
+        while (Next() == EJsonToken::Key)
+        {
+            // 값을 읽으면 Value가 바뀌므로 키는 먼저 복사
+            const FString Key(Value);
+            Next();
+            if (!ReadValueInternal(OutJson[Key]))
+            {
+                return false;
+            }
+        }
+        return Token == EJsonToken::EndObject;
+
+    case EJsonToken::BeginArray:
+    {
+        OutJson = JSON::Make(JSON::Class::Array);
+        unsigned Index = 0;
+        while (Next() != EJsonToken::EndArray)
+        {
+            // operator[](unsigned)가 배열을 늘리고 제자리 참조를 돌려줌 (복사 없음)
+            if (Token == EJsonToken::Error || !ReadValueInternal(OutJson[Index++]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    case EJsonToken::String:
+        OutJson = FString(Value);
+        return true;
+
+    case EJsonToken::Number:
+        // 기존 파서와 같이 소수점/지수 유무로 Integral/Floating 구분
+        if (bIntegral)
+        {
+            OutJson = Integer;
+        }
+        else
+        {
+            OutJson = Number;
+        }
+        return true;
+
+    case EJsonToken::True:
+        OutJson = true;
+        return true;
+
+    case EJsonToken::False:
+        OutJson = false;
+        return true;
+
+    case EJsonToken::Null:
+        OutJson = JSON();
+        return true;
+
+    default:
+        if (Token != EJsonToken::Error)
+        {
+            Fail("값이 필요합니다");
+        }
+        return false;
+    }
+}
+
+bool FJsonReader::ReadDocument(JSON& OutJson)
+{
+    if (Next() == EJsonToken::Error || !ReadValue(OutJson))
+    {
+        return false;
+    }
+    return Next() == EJsonToken::None;
+}
@@ -0,0 +1,105 @@
+﻿#pragma once
+#include <string_view>
+#include <memory>
+#include "UEContainer.h"
+#include "Name.h"
+
+namespace json { class JSON; }
+class FMappedFileReader;
+
+/** FJsonReader::Next가 돌려주는 토큰 */
+enum class EJsonToken : uint8
+{
+    None,           // 문서 끝
+    BeginObject,
+    EndObject,
+    BeginArray,
+    EndArray,
+    Key,            // 객체 키 (다음 토큰은 값)
+    String,
+    Number,
+    True,
+    False,
+    Null,
+    Error,
+};
+
+/**
+ * 스트리밍(풀 방식) JSON 리더
+ * - 메모리 버퍼나 매핑한 파일을 앞에서부터 한 토큰씩 읽습니다. DOM을 만들지 않습니다.
+ * - 이스케이프가 없는 문자열/키는 버퍼를 그대로 가리키고, 있으면 내부 버퍼에 풀어 씁니다.
+ *   GetString()의 결과는 다음 Next() 호출 전까지만 유효합니다.
+ * - GetKeyName()은 키를 FName으로 인터닝합니다 (비교는 대소문자 무시).
+ * - 필요한 하위 트리만 ReadValue로 JSON 객체로 만들고, 나머지는 SkipValue로 건너뜁니다.
+ * - 문법 오류가 나면 이후 모든 호출이 Error를 돌려줍니다.
+ */
+class FJsonReader
+{
+public:
+    FJsonReader(const char* InData, SIZE_T InSize);
+    /** 파일을 매핑해서 읽음 - 열지 못하면 IsValid() == false */
+    explicit FJsonReader(const FWideString& InFilePath);
+    ~FJsonReader();
+
+    FJsonReader(const FJsonReader&) = delete;
+    FJsonReader& operator=(const FJsonReader&) = delete;
+
+    bool IsValid() const { return bValid; }
+    bool HasError() const { return Token == EJsonToken::Error; }
+    const FString& GetErrorMessage() const { return ErrorMessage; }
+
+    /** 다음 토큰으로 이동 */
+    EJsonToken Next();
+    EJsonToken GetToken() const { return Token; }
+    /** 현재 객체/배열 깊이 (최상위 값 바깥은 0) */
+    int32 GetDepth() const { return Stack.Num(); }
+
+    /** Key/String 토큰의 내용 (UTF-8) */
+    std::string_view GetString() const { return Value; }
+    FName GetKeyName() const { return FName(Value); }
+    /** Number 토큰 - 소수점/지수가 없으면 정수 */
+    bool IsIntegral() const { return bIntegral; }
+    double GetNumber() const { return Number; }
+    int64 GetInteger() const { return Integer; }
+
+    /**
+     * 현재 토큰으로 시작하는 값을 건너뜀 (Key 토큰이면 그 값을)
+     * 끝나면 현재 토큰은 값의 마지막 토큰입니다.
+     */
+    bool SkipValue();
+
+    /** SkipValue와 같은 범위를 JSON 객체로 만듦 */
+    bool ReadValue(json::JSON& OutJson);
+
+    /** 다음 값 하나를 읽어 JSON 객체로 만들고, 뒤에 다른 내용이 없는지 확인 */
+    bool ReadDocument(json::JSON& OutJson);
+
+private:
+    EJsonToken Fail(const char* InMessage);
+    void SkipWhitespace();
+    EJsonToken ParseValueStart();
+    bool ParseString();
+    bool ParseNumber();
+    bool ParseLiteral(std::string_view InLiteral);
+    bool ReadValueInternal(json::JSON& OutJson);
+
+    std::unique_ptr<FMappedFileReader> File;
+    const char* Begin = nullptr;
+    const char* Cursor = nullptr;
+    const char* End = nullptr;
+
+    /** 열린 컨테이너 ('{' 또는 '[') */
+    TArray<char> Stack;
+    bool bNeedComma = false;
+    bool bAfterKey = false;
+    bool bDone = false;
+    bool bValid = false;
+
+    EJsonToken Token = EJsonToken::None;
+    std::string_view Value;
+    FString Scratch;
+    double Number = 0.0;
+    int64 Integer = 0;
+    bool bIntegral = false;
+    FString ErrorMessage;
+};
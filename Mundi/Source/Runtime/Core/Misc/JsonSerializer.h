@@ -16,6 +16,7 @@
 #include "GlobalConsole.h"
 #include "Vector.h"
 #include "Enums.h"
+#include "JsonReader.h"
 #include "nlohmann/json.hpp"  // 사용하는 JSON 라이브러리
 
 namespace json { class JSON; }
@@ -430,21 +431,25 @@ public:
 		}
 	}
 
+	/**
+	 * @brief 파일을 매핑해서 FJsonReader로 바로 파싱합니다. (파일 내용 문자열 복사 없음)
+	 * 큰 .scene 파일은 ULevel::LoadFromFile로 액터 단위 스트리밍 로드를 사용하세요.
+	 */
 	static bool LoadJsonFromFile(JSON& OutJson, const FWideString& InFilePath)
 	{
 		try
 		{
-			std::ifstream File(InFilePath);
-			if (!File.is_open())
+			FJsonReader Reader(InFilePath);
+			if (!Reader.IsValid())
 			{
 				return false;
 			}
 
-			FString FileContent((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
-			File.close();
-
-			std::cout << "[JsonSerializer] Loading: " << WideToUTF8(InFilePath) << " (Length: " << FileContent.length() << ")\n";
-			OutJson = JSON::Load(FileContent);
+			if (!Reader.ReadDocument(OutJson))
+			{
+				UE_LOG("[JsonSerializer] %s 파싱에 실패했습니다: %s", WideToUTF8(InFilePath).c_str(), Reader.GetErrorMessage().c_str());
+				return false;
+			}
 			return true;
 		}
 		catch (const std::exception&)
@@ -0,0 +1,139 @@
+﻿#include "pch.h"
+#include "MappedFileReader.h"
+#include <cstring>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+FMappedFileReader::FMappedFileReader(const FString& Filename)
+    : FArchive(true, false) // Loading 모드
+{
+#ifdef _WIN32
+    HANDLE File = ::CreateFileW(UTF8ToWide(Filename).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (File == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    LARGE_INTEGER FileSize;
+    if (!::GetFileSizeEx(File, &FileSize))
+    {
+        ::CloseHandle(File);
+        return;
+    }
+
+    FileHandle = File;
+    Size = FileSize.QuadPart;
+    if (Size > 0)
+    {
+        // 크기 0인 파일은 매핑할 수 없으므로 열린 상태로만 둠
+        MappingHandle = ::CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!MappingHandle)
+        {
+            Close();
+            return;
+        }
+        Data = static_cast<const uint8*>(::MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (!Data)
+        {
+            Close();
+            return;
+        }
+    }
+#else
+    FileDescriptor = ::open(Filename.c_str(), O_RDONLY);
+    if (FileDescriptor < 0)
+    {
+        return;
+    }
+
+    struct stat FileStat;
+    if (::fstat(FileDescriptor, &FileStat) != 0)
+    {
+        Close();
+        return;
+    }
+
+    Size = static_cast<int64>(FileStat.st_size);
+    if (Size > 0)
+    {
+        void* Mapped = ::mmap(nullptr, static_cast<size_t>(Size), PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+        if (Mapped == MAP_FAILED)
+        {
+            Close();
+            return;
+        }
+        // 캐시 파일은 처음부터 끝까지 한 번 읽으므로 미리 읽기 요청 (advice 값은 비트 플래그가 아니라 따로 호출)
+        ::madvise(Mapped, static_cast<size_t>(Size), MADV_SEQUENTIAL);
+        ::madvise(Mapped, static_cast<size_t>(Size), MADV_WILLNEED);
+        Data = static_cast<const uint8*>(Mapped);
+    }
+#endif
+
+    bOpen = true;
+}
+
+void FMappedFileReader::Serialize(void* Dest, int64 Length)
+{
+    if (Length <= 0)
+    {
+        return;
+    }
+    if (Length > Size - Position)
+    {
+        Position = Size;
+        throw std::runtime_error("Archive read past end of file.");
+    }
+
+    std::memcpy(Dest, Data + Position, static_cast<size_t>(Length));
+    Position += Length;
+}
+
+void FMappedFileReader::Seek(int64 InPosition)
+{
+    Position = std::clamp<int64>(InPosition, 0, Size);
+}
+
+bool FMappedFileReader::Close()
+{
+    const bool bWasOpen = bOpen;
+
+#ifdef _WIN32
+    if (Data)
+    {
+        ::UnmapViewOfFile(Data);
+    }
+    if (MappingHandle)
+    {
+        ::CloseHandle(MappingHandle);
+        MappingHandle = nullptr;
+    }
+    if (FileHandle)
+    {
+        ::CloseHandle(FileHandle);
+        FileHandle = nullptr;
+    }
+#else
+    if (Data)
+    {
+        ::munmap(const_cast<uint8*>(Data), static_cast<size_t>(Size));
+    }
+    if (FileDescriptor >= 0)
+    {
+        ::close(FileDescriptor);
+        FileDescriptor = -1;
+    }
+#endif
+
+    Data = nullptr;
+    Size = 0;
+    Position = 0;
+    bOpen = false;
+    return bWasOpen;
+}
@@ -0,0 +1,45 @@
+﻿#pragma once
+#include "Archive.h"
+#include "UEContainer.h"
+
+/**
+ * 메모리 매핑 파일 읽기 아카이브
+ * - 파일 전체를 읽기 전용으로 매핑하고, Serialize는 매핑에서 memcpy만 합니다. (스트림 버퍼/시스템 콜 없음)
+ * - GetData()로 매핑 메모리를 복사 없이 참조할 수 있습니다. (Close 또는 소멸 전까지만 유효)
+ * - 파일 끝을 넘는 읽기는 std::runtime_error (캐시 로더들은 손상된 캐시로 처리)
+ * - Windows: CreateFileMapping/MapViewOfFile, 그 외: open/mmap
+ */
+class FMappedFileReader : public FArchive
+{
+public:
+    explicit FMappedFileReader(const FString& Filename);
+    ~FMappedFileReader() override { Close(); }
+
+    FMappedFileReader(const FMappedFileReader&) = delete;
+    FMappedFileReader& operator=(const FMappedFileReader&) = delete;
+
+    // 파일이 성공적으로 열렸는지 확인하는 메서드
+    bool IsOpen() const { return bOpen; }
+
+    void Serialize(void* Dest, int64 Length) override;
+    void Seek(int64 InPosition) override;
+    int64 Tell() const override { return Position; }
+    bool Close() override;
+
+    /** 매핑 전체 */
+    const uint8* GetData() const { return Data; }
+    int64 GetSize() const { return Size; }
+
+private:
+    const uint8* Data = nullptr;
+    int64 Size = 0;
+    int64 Position = 0;
+    bool bOpen = false;
+
+#ifdef _WIN32
+    void* FileHandle = nullptr;     // HANDLE
+    void* MappingHandle = nullptr;  // HANDLE
+#else
+    int FileDescriptor = -1;
+#endif
+};
@@ -2,6 +2,7 @@
 // Name.h
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
 #include <unordered_map>
@@ -13,13 +14,24 @@ struct FNameEntry
 {
     FString Display;    // 원문
     FString Comparison; // lower-case
+    uint32 Hash = 0;    // Comparison 해시 (대소문자 무시)
 };
 
+/**
+ * 전역 이름 풀 (스레드 안전)
+ * - 엔트리는 청크 단위로만 추가되고 옮겨지지 않으므로 Get이 돌려준 참조는 프로그램 끝까지 유효합니다.
+ * - 조회는 잠금 없이 샤드별 해시 테이블을 읽고, 새 이름 추가만 해당 샤드 잠금을 잡습니다.
+ * - 해시/비교는 소문자 변환을 즉석에서 하므로 임시 문자열을 만들지 않습니다.
+ */
 class FNamePool
 {
 public:
-    static uint32 Add(const FString& InStr);
+    static uint32 Add(std::string_view InStr);
     static const FNameEntry& Get(uint32 Index);
+    static uint32 Num();
+
+    /** 대소문자를 무시한 해시 (FNameEntry::Hash와 동일) */
+    static uint32 HashIgnoreCase(std::string_view InStr);
 };
 
 // ──────────────────────────────
@@ -29,28 +41,42 @@ struct FName
 {
     uint32 DisplayIndex = -1;
     uint32 ComparisonIndex = -1;
+    /** 숫자 접미사 - 0이면 없음, N이면 "_(N-1)" (기본 문자열만 풀에 저장) */
+    uint32 Number = 0;
 
 #if defined(DEBUG) || defined(_DEBUG)
     FString DebugStr;
 #endif
 
     FName() = default;
-    FName(const char* InStr) { Init(FString(InStr)); }
+    FName(const char* InStr) { Init(InStr ? std::string_view(InStr) : std::string_view()); }
     FName(const FString& InStr) { Init(InStr); }
+    FName(std::string_view InStr) { Init(InStr); }
+    /** "InBase_InSuffix" 와 같은 이름 (문자열을 만들지 않음) */
+    FName(std::string_view InBase, int32 InSuffix) { Init(InBase, static_cast<uint32>(InSuffix) + 1); }
 
-    void Init(const FString& InStr)
-    {
-        int32_t Index = FNamePool::Add(InStr);
-        DisplayIndex = Index;
-        ComparisonIndex = Index; // 필요시 다른 규칙 적용 가능
+    /** "Base_123" 형태면 숫자를 떼어 Number에 저장 (선행 0이 있는 숫자는 그대로 이름에 포함) */
+    void Init(std::string_view InStr);
+    void Init(std::string_view InBase, uint32 InNumber);
 
-#if defined(DEBUG) || defined(_DEBUG)
-        DebugStr = InStr;
-#endif
+    bool operator==(const FName& Other) const { return ComparisonIndex == Other.ComparisonIndex && Number == Other.Number; }
+    bool operator!=(const FName& Other) const { return !(*this == Other); }
+    /** 인덱스 기준 정렬 (알파벳 순서 아님) */
+    bool FastLess(const FName& Other) const
+    {
+        return ComparisonIndex != Other.ComparisonIndex ? ComparisonIndex < Other.ComparisonIndex : Number < Other.Number;
     }
 
-    bool operator==(const FName& Other) const { return ComparisonIndex == Other.ComparisonIndex; }
-    FString ToString() const { return FNamePool::Get(DisplayIndex).Display; }
+    /**
+     * 접미사를 포함한 전체 이름
+     * 숫자 접미사는 풀에 저장하지 않으므로 값으로 반환합니다. 매 프레임 쓰는 코드는
+     * 접미사 없는 원문 참조(GetPlainNameString), 기존 버퍼에 이어 쓰기(AppendString), FName 비교를 사용하세요.
+     */
+    FString ToString() const;
+    /** 전체 이름을 Out 뒤에 붙임 (버퍼를 재사용하면 할당 없음) */
+    void AppendString(FString& Out) const;
+    /** 접미사를 뺀 기본 이름 (풀에 저장된 원문, 복사 없음) */
+    const FString& GetPlainNameString() const { return FNamePool::Get(DisplayIndex).Display; }
     bool IsValid() const { return DisplayIndex >= 0 && ComparisonIndex >= 0; }
 
     friend FName operator+(const FName& A, const FName& B)
@@ -77,8 +103,15 @@ namespace std
     {
         size_t operator()(const FName& Name) const noexcept
         {
-            // FName의 비교 기준인 ComparisonIndex를 해시합니다.
-            return hash<uint32>{}(Name.ComparisonIndex);
+            // FName의 비교 기준인 ComparisonIndex와 숫자 접미사를 해시합니다.
+            return static_cast<size_t>(FastHash::HashInt((static_cast<uint64>(Name.Number) << 32) | Name.ComparisonIndex));
         }
     };
-}
\ No newline at end of file
+}
+
+// 위 해시는 이미 고르게 섞여 있으므로 TFlatMap이 추가 믹싱을 생략하도록 표시
+template<>
+struct TDefaultHasher<FName> : std::hash<FName>
+{
+    using is_avalanching = void;
+};
\ No newline at end of file
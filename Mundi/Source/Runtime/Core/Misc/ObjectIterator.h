@@ -2,19 +2,26 @@
 
 #include "ObjectFactory.h"
 
+/**
+ * TObject 타입 객체 순회
+ * - GUObjectArray의 클래스별 버킷 중 TObject와 하위 클래스 버킷만 돌므로 IsA 검사도, 빈 슬롯도 없습니다.
+ * - 순서는 보장하지 않습니다.
+ * - 순회 중 객체를 삭제하면 버킷의 마지막 객체가 그 자리로 옮겨지므로, 삭제가 필요하면 모아 두었다가 순회 후 처리하세요.
+ */
 template<typename TObject>
 class TObjectIterator
 {
 public:
 	TObjectIterator()
 	{
+		GUObjectArray.GetClassBuckets(TObject::StaticClass(), BucketList);
 		++(*this); // 첫 번째 유효 객체로 이동
 	}
 
 	// 다음 객체로 이동
 	TObjectIterator& operator++()
 	{
-		++CurrentIndex;
+		++ObjectIndex;
 		AdvanceToNextValidObject();
 		return *this;
 	}
@@ -22,8 +29,8 @@ public:
 	// 현재 객체에 접근
 	TObject* operator*() const
 	{
-		// 이 시점의 CurrentIndex는 유효한 TObject를 가리키고 있어야 함
-		return static_cast<TObject*>(GUObjectArray[CurrentIndex]);
+		// 이 시점의 인덱스는 유효한 TObject를 가리키고 있어야 함
+		return static_cast<TObject*>(GUObjectArray.GetBucketObjects(BucketList[BucketCursor])[ObjectIndex]);
 	}
 
 	// 현재 객체에 접근 (포인터 연산자)
@@ -35,34 +42,35 @@ public:
 	// 비교 연산자
 	bool operator!=(const TObjectIterator& Other) const
 	{
-		return CurrentIndex != Other.CurrentIndex;
+		return BucketCursor != Other.BucketCursor || ObjectIndex != Other.ObjectIndex;
 	}
 
 	// bool 변환 연산자
 	explicit operator bool() const
 	{
-		// CurrentIndex가 배열 범위 내에 있는지 확인
-		return CurrentIndex < GUObjectArray.Num();
+		// 남은 버킷이 있는지 확인
+		return BucketCursor < BucketList.Num();
 	}
 
 private:
-	// 현재 인덱스부터 시작하여 다음 유효 객체를 찾는 헬퍼 함수
+	// 현재 버킷이 끝났으면 비어 있지 않은 다음 버킷으로 이동
 	void AdvanceToNextValidObject()
 	{
-		while (CurrentIndex < GUObjectArray.Num())
+		while (BucketCursor < BucketList.Num())
 		{
-			UObject* Object = GUObjectArray[CurrentIndex];
-			// 현재 객체가 유효하고, TObject 타입이면 검색 종료
-			if (Object && Object->IsA<TObject>())
+			if (ObjectIndex < GUObjectArray.GetBucketObjects(BucketList[BucketCursor]).Num())
 			{
 				break;
 			}
 
-			// 다음 인덱스로 이동
-			++CurrentIndex;
+			// 다음 버킷으로 이동
+			++BucketCursor;
+			ObjectIndex = 0;
 		}
 	}
 
 private:
-	int32 CurrentIndex = -1;
+	FUObjectBucketList BucketList;
+	int32 BucketCursor = 0;
+	int32 ObjectIndex = -1;
 };
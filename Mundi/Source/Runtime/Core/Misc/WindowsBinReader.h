@@ -23,8 +23,8 @@ public:
     {
         File.read(reinterpret_cast<char*>(Data), Length);
     }
-    /*void Seek(size_t Position) override { File.seekg(Position); }
-    size_t Tell() const override { return (size_t)File.tellg(); }*/
+    void Seek(int64 Position) override { File.seekg(Position); }
+    int64 Tell() const override { return (int64)File.tellg(); }
     bool Close() override
     {
         if (File.is_open()) { File.close(); return true; }
@@ -32,5 +32,5 @@ public:
     }
 
 private:
-    std::ifstream File;
+    mutable std::ifstream File; // tellg가 const가 아님
 };
\ No newline at end of file
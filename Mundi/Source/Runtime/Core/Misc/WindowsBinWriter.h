@@ -17,8 +17,8 @@ public:
     {
         File.write(reinterpret_cast<char*>(Data), Length);
     }
-    /*void Seek(size_t Position) override { File.seekp(Position); }
-    size_t Tell() const override { return (size_t)File.tellp(); }*/
+    void Seek(int64 Position) override { File.seekp(Position); }
+    int64 Tell() const override { return (int64)File.tellp(); }
     bool Close() override
     {
         if (File.is_open()) { File.close(); return true; }
@@ -26,5 +26,5 @@ public:
     }
 
 private:
-    std::ofstream File;
+    mutable std::ofstream File; // tellp가 const가 아님
 };
\ No newline at end of file
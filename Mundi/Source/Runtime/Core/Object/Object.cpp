@@ -1,5 +1,62 @@
 ﻿#include "pch.h"
 
+void UClass::BuildClassTree()
+{
+    // 등록 목록에 없는 루트(UObject 등)까지 포함해 부모 -> 자식 목록 구성
+    TArray<UClass*> Classes;
+    TFlatMap<const UClass*, TArray<UClass*>> Children;
+    for (UClass* Class : GetAllClasses())
+    {
+        for (UClass* It = Class; It; It = const_cast<UClass*>(It->Super))
+        {
+            if (Children.Contains(It))
+            {
+                break;
+            }
+            Children.Emplace(It);
+            Classes.Add(It);
+        }
+    }
+
+    TArray<UClass*> Roots;
+    for (UClass* Class : Classes)
+    {
+        if (Class->Super)
+        {
+            Children.FindOrAdd(Class->Super).Add(Class);
+        }
+        else
+        {
+            Roots.Add(Class);
+        }
+    }
+
+    // 반복 DFS: 처음 방문할 때 전위 번호, 서브트리를 다 돈 뒤(두 번째 방문) 마지막 자손 번호 기록
+    int32 NextIndex = 0;
+    TArray<TPair<UClass*, bool>> Pending;
+    for (UClass* Root : Roots)
+    {
+        Pending.Add({ Root, false });
+    }
+    while (Pending.Num() > 0)
+    {
+        const TPair<UClass*, bool> Entry = Pending.Pop();
+        UClass* Class = Entry.first;
+        if (Entry.second)
+        {
+            Class->ClassTreeLastDescendant = NextIndex - 1;
+            continue;
+        }
+
+        Class->ClassTreeIndex = NextIndex++;
+        Pending.Add({ Class, true });
+        for (UClass* Child : Children.FindOrAdd(Class))
+        {
+            Pending.Add({ Child, false });
+        }
+    }
+}
+
 FString UObject::GetName()
 {
     return ObjectName.ToString();
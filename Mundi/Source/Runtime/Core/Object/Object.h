@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "UEContainer.h"
+#include "FlatHashMap.h"
 #include "ObjectFactory.h"
 #include "MemoryManager.h"
 #include "Name.h"
@@ -28,20 +29,46 @@ struct UClass
     const char* Description = nullptr;         // 툴팁 설명
     mutable TArray<FProperty> CachedAllProperties;  // GetAllProperties() 캐시 (성능 최적화)
     mutable bool bAllPropertiesCached = false;      // 캐시 유효성 플래그
+    mutable uint16 MemoryTag = 0;                   // 메모리 태그 (0이면 아직 등록 전)
+    // 클래스 계층 DFS 번호 - 하위 클래스는 [ClassTreeIndex, ClassTreeLastDescendant] 구간에 들어감
+    // (BuildClassTree 이전이나 그 뒤에 등록된 클래스는 -1 → Super 체인 탐색)
+    int32 ClassTreeIndex = -1;
+    int32 ClassTreeLastDescendant = -1;
 
     constexpr UClass() = default;
     constexpr UClass(const char* n, const UClass* s, SIZE_T z)
         :Name(n), Super(s), Size(z)
     {
     }
+    /** 이 클래스 인스턴스 할당에 붙는 메모리 태그 (클래스 이름으로 최초 사용 시 등록) */
+    uint16 GetMemoryTag() const
+    {
+        if (MemoryTag == 0)
+        {
+            MemoryTag = FMemoryManager::RegisterTag(Name);
+        }
+        return MemoryTag;
+    }
+
     bool IsChildOf(const UClass* Base) const noexcept
     {
         if (!Base) return false;
+        // 둘 다 번호가 있으면 정수 비교 두 번
+        if (ClassTreeIndex >= 0 && Base->ClassTreeIndex >= 0)
+        {
+            return Base->ClassTreeIndex <= ClassTreeIndex && ClassTreeIndex <= Base->ClassTreeLastDescendant;
+        }
         for (auto c = this; c; c = c->Super)
             if (c == Base) return true;
         return false;
     }
 
+    /**
+     * 등록된 클래스 계층에 DFS 전위 번호를 매김 (엔진 Startup에서 정적 초기화가 끝난 뒤 1회)
+     * 워커 스레드가 IsChildOf를 호출하기 전에 게임 스레드에서 호출해야 합니다.
+     */
+    static void BuildClassTree();
+
     static TArray<UClass*>& GetAllClasses()
     {
         static TArray<UClass*> AllClasses;
@@ -53,19 +80,12 @@ struct UClass
         if (InClass)
         {
             GetAllClasses().emplace_back(InClass);
+            GetClassNameMap().Emplace(FName(InClass->Name), InClass); // 같은 이름이면 먼저 등록된 클래스 유지
         }
     }
     static UClass* FindClass(const FName& InClassName)
     {
-        for (UClass* Class : GetAllClasses())
-        {
-            if (Class && InClassName == Class->Name)
-            {
-                return Class;
-            }
-        }
-
-        return nullptr;
+        return GetClassNameMap().FindRef(InClassName);
     }
 
     // 리플렉션 시스템 메서드
@@ -78,6 +98,13 @@ struct UClass
     }
 
 private:
+    // 이름(대소문자 무시) -> 클래스
+    static TFlatMap<FName, UClass*>& GetClassNameMap()
+    {
+        static TFlatMap<FName, UClass*> ClassNameMap;
+        return ClassNameMap;
+    }
+
     // 이 클래스와 모든 자식 클래스의 프로퍼티 캐시를 무효화
     void InvalidateAllPropertiesCache()
     {
@@ -1,7 +1,5 @@
 ﻿#include "pch.h"
 #include "ObjectFactory.h"
-// 전역 오브젝트 배열 정의 (한 번만!)
-TArray<UObject*> GUObjectArray;
 
 namespace ObjectFactory
 {
@@ -21,6 +19,9 @@ namespace ObjectFactory
         auto& reg = GetRegistry();
         auto it = reg.find(Class);
         if (it == reg.end()) return nullptr;
+
+        // 객체 본체와 생성자에서 하는 할당을 클래스 태그로 집계
+        FMemoryTagScope TagScope(Class->GetMemoryTag());
         return it->second();
     }
     
@@ -29,23 +30,13 @@ namespace ObjectFactory
         UObject* Obj = ConstructObject(Class);
         if (!Obj) return nullptr;
 
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        GUObjectArray.Add(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
 
-        const std::string base = Class->Name; // FName -> string
-        std::string unique;
-        unique.reserve(base.size() + 1 + 12);            // "_" + 최대 10~12자리 여유
-        unique.append(base);
-        unique.push_back('_');
-        unique.append(std::to_string(Count));
-
-        Obj->ObjectName = FName(unique);
+        // "ClassName_Count" - 기본 이름만 풀에 저장하고 번호는 FName::Number에 보관
+        Obj->ObjectName = FName(Class->Name, Count);
 
         return Obj;
     }
@@ -54,12 +45,8 @@ namespace ObjectFactory
     {
         if (!Obj) return nullptr;
 
-        // 배열에 등록: 빈 슬롯 재사용
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-        //}
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        // 배열에 등록: 빈 슬롯 재사용 (InternalIndex 설정)
+        GUObjectArray.Add(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -82,58 +69,25 @@ namespace ObjectFactory
         if (!Obj) return;
 
         // Important: DO NOT dereference Obj fields before verifying it is still in GUObjectArray.
-        int32 FoundIndex = -1;
-        for (int32 i = 0; i < GUObjectArray.Num(); ++i)
-        {
-            if (GUObjectArray[i] == Obj)
-            {
-                FoundIndex = i;
-                break;
-            }
-        }
-        if (FoundIndex < 0)
+        // (Remove looks the pointer up in a hash map, so an already-deleted pointer is safe here.)
+        if (!GUObjectArray.Remove(Obj))
         {
             // Not managed or already deleted.
             return;
         }
 
-        GUObjectArray[FoundIndex] = nullptr;
-        // Safe to delete now; Obj still valid since we found it in GUObjectArray
+        // Safe to delete now; Obj was still registered in GUObjectArray
         Obj->DestroyInternal();
     }
 
     void DeleteAll(bool bCallBeginDestroy)
     {
-        // 실제 삭제 (역순 안전)
-        for (int32 i = GUObjectArray.Num() - 1; i >= 0; --i)
+        // 실제 삭제 - 소멸자에서 다른 객체를 지울 수 있으므로 매번 남은 목록의 끝에서 꺼냄
+        const TArray<UObject*>& LiveObjects = GUObjectArray.GetLiveObjects();
+        while (LiveObjects.Num() > 0)
         {
-            if (UObject* Obj = GUObjectArray[i])
-            {
-                DeleteObject(Obj);
-            }
+            DeleteObject(LiveObjects.Last());
         }
         GUObjectArray.Empty();
-        GUObjectArray.Shrink();
-    }
-
-    // (선택) null 슬롯 압축
-    void CompactNullSlots()
-    {
-        int32 write = 0;
-        for (int32 read = 0; read < GUObjectArray.Num(); ++read)
-        {
-            if (UObject* Obj = GUObjectArray[read])
-            {
-                if (write != read)
-                {
-                    GUObjectArray[write] = Obj;
-                    Obj->InternalIndex = static_cast<uint32>(write);
-                    GUObjectArray[read] = nullptr;
-                }
-                ++write;
-            }
-        }
-        // 크기(Num) 축소 + 불필요한 capacity도 반환
-        GUObjectArray.SetNum(write);
     }
 }
@@ -1,11 +1,12 @@
 ﻿#pragma once
 #include "UEContainer.h"
+#include "MemoryManager.h"
+#include "UObjectArray.h"
 
 
 // ── 외부 심볼 ─────────────────────────────────────────────
 class UObject;
 struct UClass;
-extern TArray<UObject*> GUObjectArray;
 
 // ── ObjectFactory 네임스페이스 ─────────────────────────────
 namespace ObjectFactory
@@ -38,7 +39,11 @@ namespace ObjectFactory
     template<class T>
     inline T* DuplicateObject(const UObject* Source)
     {
-        UObject* Dest = new T(*static_cast<const T*>(Source));
+        UObject* Dest = nullptr;
+        {
+            FMemoryTagScope TagScope(T::StaticClass()->GetMemoryTag());
+            Dest = new T(*static_cast<const T*>(Source));
+        }
         return static_cast<T*>(AddToGUObjectArray(T::StaticClass(), Dest));
     }
 
@@ -46,8 +51,6 @@ namespace ObjectFactory
     void DeleteObject(UObject* Obj);
     // 종료시 일괄 정리
     void DeleteAll(bool bCallBeginDestroy = true);
-    // Null 슬롯 압축하여 배열 크기 축소
-    void CompactNullSlots();
 }
 
 // ── 등록 매크로 ─────────────────────────────────────────────
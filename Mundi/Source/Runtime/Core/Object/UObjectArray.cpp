@@ -0,0 +1,124 @@
+﻿#include "pch.h"
+#include "UObjectArray.h"
+
+// 전역 오브젝트 배열 정의 (한 번만!)
+FUObjectArray GUObjectArray;
+
+namespace
+{
+    /** 배열 끝 원소로 Index 자리를 메우고 줄임 - 옮겨진 원소를 반환 (없으면 nullptr) */
+    UObject* RemoveSwap(TArray<UObject*>& Array, int32 Index)
+    {
+        UObject* Moved = Array.Last();
+        Array[Index] = Moved;
+        Array.Pop();
+        return Index < Array.Num() ? Moved : nullptr;
+    }
+}
+
+FUObjectArray::FUObjectArray()
+{
+    // 0번 슬롯 예약
+    Items.Add(FUObjectItem());
+}
+
+int32 FUObjectArray::Add(UObject* Object)
+{
+    const int32 Index = FreeIndices.Num() > 0 ? FreeIndices.Pop() : Items.Add(FUObjectItem());
+    Object->InternalIndex = static_cast<uint32>(Index);
+    ObjectToSlot.Add(Object, Index);
+
+    FUObjectItem& Item = Items[Index];
+    Item.Object = Object;
+    Item.LiveIndex = LiveObjects.Add(Object);
+    Item.BucketIndex = FindOrAddBucket(Object->GetClass());
+    Item.BucketPosition = Buckets[Item.BucketIndex].Objects.Add(Object);
+    return Index;
+}
+
+bool FUObjectArray::Remove(UObject* Object)
+{
+    const int32* SlotPtr = ObjectToSlot.Find(Object);
+    if (!SlotPtr)
+    {
+        return false;
+    }
+    const int32 Index = *SlotPtr;
+    ObjectToSlot.Remove(Object);
+
+    // 밀집 배열/버킷은 마지막 원소로 메워 O(1) 제거 (옮겨진 객체는 살아 있으므로 InternalIndex를 읽어도 안전)
+    FUObjectItem& Item = Items[Index];
+    if (UObject* Moved = RemoveSwap(LiveObjects, Item.LiveIndex))
+    {
+        Items[Moved->InternalIndex].LiveIndex = Item.LiveIndex;
+    }
+    if (UObject* Moved = RemoveSwap(Buckets[Item.BucketIndex].Objects, Item.BucketPosition))
+    {
+        Items[Moved->InternalIndex].BucketPosition = Item.BucketPosition;
+    }
+
+    Item.Object = nullptr;
+    Item.LiveIndex = -1;
+    Item.BucketIndex = -1;
+    Item.BucketPosition = -1;
+    ++Item.Generation;
+    FreeIndices.Add(Index);
+    return true;
+}
+
+int32 FUObjectArray::FindOrAddBucket(const UClass* Class)
+{
+    if (const int32* Found = ClassToBucket.Find(Class))
+    {
+        return *Found;
+    }
+
+    FUObjectClassBucket Bucket;
+    Bucket.Class = Class;
+    const int32 BucketIndex = Buckets.Add(std::move(Bucket));
+    ClassToBucket.Add(Class, BucketIndex);
+    return BucketIndex;
+}
+
+void FUObjectArray::GetClassBuckets(const UClass* Base, FUObjectBucketList& OutBuckets)
+{
+    FClassQuery& Query = ClassQueries.FindOrAdd(Base);
+    if (Query.NumBucketsWhenBuilt != Buckets.Num())
+    {
+        // 새 버킷이 생긴 뒤 처음 조회할 때만 계층을 훑음
+        Query.BucketIndices.Empty();
+        for (int32 BucketIndex = 0; BucketIndex < Buckets.Num(); ++BucketIndex)
+        {
+            if (Buckets[BucketIndex].Class->IsChildOf(Base))
+            {
+                Query.BucketIndices.Add(BucketIndex);
+            }
+        }
+        Query.NumBucketsWhenBuilt = Buckets.Num();
+    }
+
+    OutBuckets.Empty();
+    OutBuckets.Append(Query.BucketIndices);
+}
+
+void FUObjectArray::Empty()
+{
+    FreeIndices.Empty();
+    for (int32 Index = Items.Num() - 1; Index > 0; --Index)
+    {
+        FUObjectItem& Item = Items[Index];
+        if (Item.Object)
+        {
+            Item = FUObjectItem{ nullptr, Item.Generation + 1 };
+        }
+        FreeIndices.Add(Index);
+    }
+    LiveObjects.Empty();
+    ObjectToSlot.Empty();
+
+    // 버킷 인덱스는 캐시에 남아 있으므로 버킷 자체는 유지하고 비우기만 함
+    for (FUObjectClassBucket& Bucket : Buckets)
+    {
+        Bucket.Objects.Empty();
+    }
+}
@@ -0,0 +1,106 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "FlatHashMap.h"
+#include "InlineArray.h"
+
+class UObject;
+struct UClass;
+
+/** GUObjectArray 슬롯 */
+struct FUObjectItem
+{
+    UObject* Object = nullptr;
+    // 슬롯이 비워질 때마다 증가 - 같은 인덱스를 재사용한 새 객체와 이전 객체를 구분
+    uint32 Generation = 0;
+    // 밀집 배열 / 클래스 버킷 내 위치 (O(1) 제거용)
+    int32 LiveIndex = -1;
+    int32 BucketIndex = -1;
+    int32 BucketPosition = -1;
+};
+
+/** 정확히 한 클래스의 살아 있는 객체 목록 (하위 클래스 객체는 각자의 버킷에) */
+struct FUObjectClassBucket
+{
+    const UClass* Class = nullptr;
+    TArray<UObject*> Objects;
+};
+
+/** TObjectIterator가 복사해 두는 버킷 인덱스 목록 - 클래스 계층이 작으면 힙 할당 없음 */
+using FUObjectBucketList = TArray<int32, TInlineAllocator<16>>;
+
+/**
+ * 전역 UObject 배열
+ * - 슬롯 인덱스(UObject::InternalIndex)는 객체가 살아 있는 동안 바뀌지 않습니다. (피킹 ID, 약한 참조 키)
+ * - 삭제된 슬롯은 자유 목록에 넣어 재사용하고, 비울 때 세대를 올려 TWeakObjectPtr가 삭제를 감지하게 합니다.
+ * - 살아 있는 객체는 밀집 배열과 클래스별 버킷에도 담습니다.
+ *   TObjectIterator<T>는 T와 하위 클래스 버킷만 돌므로 전체 객체 수와 무관하게 T 객체 수만큼만 비용이 듭니다.
+ * - 0번 슬롯은 항상 비워 둡니다. (오브젝트 ID 버퍼에서 0은 '선택 없음')
+ * - 게임 스레드 전용
+ */
+class FUObjectArray
+{
+public:
+    FUObjectArray();
+
+    /** 등록 후 Object->InternalIndex 설정 */
+    int32 Add(UObject* Object);
+    /** 등록 해제 - 등록되지 않은 포인터면 false (이미 삭제된 포인터여도 객체 필드를 읽지 않음) */
+    bool Remove(UObject* Object);
+    bool Contains(const UObject* Object) const { return ObjectToSlot.Contains(Object); }
+
+    /** 슬롯 접근 - 빈 슬롯이나 범위 밖이면 nullptr */
+    UObject* operator[](int32 Index) const
+    {
+        return (Index >= 0 && Index < Items.Num()) ? Items[Index].Object : nullptr;
+    }
+
+    /** 인덱스와 세대가 모두 일치할 때만 객체 반환 (TWeakObjectPtr용) */
+    UObject* Resolve(uint32 Index, uint32 Generation) const
+    {
+        if (Index >= static_cast<uint32>(Items.Num()))
+        {
+            return nullptr;
+        }
+        const FUObjectItem& Item = Items[Index];
+        return Item.Generation == Generation ? Item.Object : nullptr;
+    }
+
+    uint32 GetGeneration(uint32 Index) const
+    {
+        return Index < static_cast<uint32>(Items.Num()) ? Items[Index].Generation : 0;
+    }
+
+    /** 슬롯 수 (빈 슬롯 포함) */
+    int32 Num() const { return Items.Num(); }
+    /** 살아 있는 객체 수 */
+    int32 NumLive() const { return LiveObjects.Num(); }
+    const TArray<UObject*>& GetLiveObjects() const { return LiveObjects; }
+
+    /** Base와 그 하위 클래스의 버킷 인덱스 (버킷이 추가될 때만 다시 계산) */
+    void GetClassBuckets(const UClass* Base, FUObjectBucketList& OutBuckets);
+    const TArray<UObject*>& GetBucketObjects(int32 BucketIndex) const { return Buckets[BucketIndex].Objects; }
+
+    /** 모든 슬롯을 비움 (세대는 유지하므로 남아 있는 약한 참조도 무효가 됨) */
+    void Empty();
+
+private:
+    int32 FindOrAddBucket(const UClass* Class);
+
+    TArray<FUObjectItem> Items;
+    TArray<int32> FreeIndices;
+    TArray<UObject*> LiveObjects;
+    // 객체 -> 슬롯. 삭제 여부를 포인터만으로 판단하기 위해 사용
+    TFlatMap<const UObject*, int32> ObjectToSlot;
+
+    TArray<FUObjectClassBucket> Buckets;
+    TFlatMap<const UClass*, int32> ClassToBucket;
+    // 기준 클래스 -> 해당 버킷 목록 캐시 (Buckets.Num()이 바뀌면 다시 계산)
+    struct FClassQuery
+    {
+        int32 NumBucketsWhenBuilt = -1;
+        TArray<int32> BucketIndices;
+    };
+    TFlatMap<const UClass*, FClassQuery> ClassQueries;
+};
+
+extern FUObjectArray GUObjectArray;
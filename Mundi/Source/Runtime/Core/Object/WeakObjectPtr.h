@@ -0,0 +1,68 @@
+﻿#pragma once
+#include <type_traits>
+#include "UObjectArray.h"
+
+/**
+ * UObject 약한 참조
+ * - 포인터 대신 GUObjectArray의 {슬롯 인덱스, 세대}를 저장합니다.
+ * - 객체가 삭제되면 슬롯 세대가 바뀌므로 Get()/IsValid()가 O(1)로 nullptr/false를 돌려줍니다.
+ * - GUObjectArray에 등록되지 않은 객체(직접 new 한 객체 등)로 만들면 null 참조가 됩니다.
+ */
+template<typename T>
+class TWeakObjectPtr
+{
+public:
+    using ElementType = T;
+
+    TWeakObjectPtr() = default;
+    TWeakObjectPtr(std::nullptr_t) {}
+    explicit TWeakObjectPtr(T* InPtr) { Reset(InPtr); }
+
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    TWeakObjectPtr(const TWeakObjectPtr<U>& Other)
+        : ObjectIndex(Other.GetObjectIndex())
+        , Generation(Other.GetGeneration())
+    {
+    }
+
+    void Reset(T* InPtr = nullptr)
+    {
+        ObjectIndex = UINT32_MAX;
+        Generation = 0;
+        // 복사 생성 직후처럼 다른 객체의 인덱스를 들고 있는 경우를 걸러냄
+        if (InPtr && GUObjectArray[static_cast<int32>(InPtr->InternalIndex)] == InPtr)
+        {
+            ObjectIndex = InPtr->InternalIndex;
+            Generation = GUObjectArray.GetGeneration(ObjectIndex);
+        }
+    }
+
+    T* Get() const { return static_cast<T*>(GUObjectArray.Resolve(ObjectIndex, Generation)); }
+    bool IsValid() const { return Get() != nullptr; }
+    explicit operator bool() const { return IsValid(); }
+
+    T& operator*() const { return *Get(); }
+    T* operator->() const { return Get(); }
+
+    /** 같은 객체를 가리켰는지 비교 (삭제된 뒤에도 키로 쓸 수 있음) */
+    bool operator==(const TWeakObjectPtr& Other) const { return ObjectIndex == Other.ObjectIndex && Generation == Other.Generation; }
+    bool operator!=(const TWeakObjectPtr& Other) const { return !(*this == Other); }
+
+    uint32 GetObjectIndex() const { return ObjectIndex; }
+    uint32 GetGeneration() const { return Generation; }
+
+private:
+    uint32 ObjectIndex = UINT32_MAX;
+    uint32 Generation = 0;
+};
+
+namespace std {
+    template <typename T>
+    struct hash<TWeakObjectPtr<T>>
+    {
+        size_t operator()(const TWeakObjectPtr<T>& Key) const noexcept
+        {
+            return hash<uint64>()((static_cast<uint64>(Key.GetGeneration()) << 32) | Key.GetObjectIndex());
+        }
+    };
+}
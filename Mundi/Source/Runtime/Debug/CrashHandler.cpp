@@ -203,7 +203,7 @@ void FCrashHandler::InjectCrash()
 void FCrashHandler::Crash()
 {
     if (!bCrashInjection) { return; }
-    TArray<UObject*>& ObjectArray = GUObjectArray;
+    const TArray<UObject*>& ObjectArray = GUObjectArray.GetLiveObjects();
     if (ObjectArray.Num() == 0) return;
 
     bool bCrashInjected = false;
@@ -4,6 +4,7 @@
 #include "AnimTypes.h"
 #include "AnimationStateMachine.h"
 #include "AnimSequence.h"
+#include "VectorBatch.h"
 // For notify dispatching
 #include "Source/Runtime/Engine/Animation/AnimNotify.h"
 
@@ -555,20 +556,8 @@ void UAnimInstance::BlendPoseArrays(const TArray<FTransform>& FromPose, const TA
     const float ClampedAlpha = FMath::Clamp(Alpha, 0.0f, 1.0f);
     OutPose.SetNum(NumBones);
 
-    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
-    {
-        const FTransform& From = FromPose[BoneIndex];
-        const FTransform& To = ToPose[BoneIndex];
-
-        FTransform Result;
-        //Result.Lerp(From,To,ClampedAlpha);
-        Result.Translation = FMath::Lerp(From.Translation, To.Translation, ClampedAlpha);
-        Result.Scale3D = FMath::Lerp(From.Scale3D, To.Scale3D, ClampedAlpha);
-        Result.Rotation = FQuat::Slerp(From.Rotation, To.Rotation, ClampedAlpha);
-        Result.Rotation.Normalize();
-
-        OutPose[BoneIndex] = Result;
-    }
+    // 본 전체를 SIMD로 한 번에 (이동/스케일 선형 보간, 회전 Slerp 후 정규화)
+    FMath::BlendTransforms(FromPose.GetData(), ToPose.GetData(), ClampedAlpha, OutPose.GetData(), NumBones, FMath::EQuatBlend::Slerp);
 }
 
 void UAnimInstance::GetPoseForLayer(int32 LayerIndex, TArray<FTransform>& OutPose,float DeltaSeconds)
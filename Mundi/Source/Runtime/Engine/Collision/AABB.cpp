@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "AABB.h"
+#include "VectorBatch.h"
 
 FAABB::FAABB() : Min(FVector()), Max(FVector()) {}
 
@@ -10,37 +11,16 @@ FAABB::FAABB(const FVector* Vertices, uint32 Size)
 	{
 		return;
 	}
-	Min = Vertices[0];
-	Max = Vertices[0];
-	for (int i = 1; i < Size; i++)
-	{
-		Min.X = Vertices[i].X < Min.X ? Vertices[i].X : Min.X;
-		Min.Y = Vertices[i].Y < Min.Y ? Vertices[i].Y : Min.Y;
-		Min.Z = Vertices[i].Z < Min.Z ? Vertices[i].Z : Min.Z;
-		Max.X = Vertices[i].X > Max.X ? Vertices[i].X : Max.X;
-		Max.Y = Vertices[i].Y > Max.Y ? Vertices[i].Y : Max.Y;
-		Max.Z = Vertices[i].Z > Max.Z ? Vertices[i].Z : Max.Z;
-	}
+	*this = FMath::ComputeBounds(Vertices, static_cast<int32>(Size));
 }
 
 FAABB::FAABB(const TArray<FVector>& Vertices)
 {
-	uint32 Size = Vertices.size();
-	if (Size == 0)
+	if (Vertices.IsEmpty())
 	{
 		return;
 	}
-	Min = Vertices[0];
-	Max = Vertices[0];
-	for (int i = 1; i < Size; i++)
-	{
-		Min.X = Vertices[i].X < Min.X ? Vertices[i].X : Min.X;
-		Min.Y = Vertices[i].Y < Min.Y ? Vertices[i].Y : Min.Y;
-		Min.Z = Vertices[i].Z < Min.Z ? Vertices[i].Z : Min.Z;
-		Max.X = Vertices[i].X > Max.X ? Vertices[i].X : Max.X;
-		Max.Y = Vertices[i].Y > Max.Y ? Vertices[i].Y : Max.Y;
-		Max.Z = Vertices[i].Z > Max.Z ? Vertices[i].Z : Max.Z;
-	}
+	*this = FMath::ComputeBounds(Vertices.data(), Vertices.Num());
 }
 // 중심점
 FVector FAABB::GetCenter() const
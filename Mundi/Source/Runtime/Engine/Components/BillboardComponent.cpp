@@ -78,7 +78,7 @@ void UBillboardComponent::DuplicateSubObjects()
 	// Texture는 TextureName을 통해 리소스 매니저에서 가져오므로 복제하지 않음
 }
 
-void UBillboardComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UBillboardComponent::CollectMeshBatches(TArray<FMeshBatchElement, FFrameArenaAllocator>& OutMeshBatchElements, const FSceneView* View)
 {
 	// 1. 렌더링할 애셋이 유효한지 검사
 	// (IsVisible()는 UPrimitiveComponent 또는 그 부모에 있다고 가정)
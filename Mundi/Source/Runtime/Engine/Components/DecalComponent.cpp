@@ -2,6 +2,7 @@
 #include <cmath>
 #include "DecalComponent.h"
 #include "OBB.h"
+#include "VectorBatch.h"
 #include "StaticMeshComponent.h"
 #include "JsonSerializer.h"
 #include "BillboardComponent.h"
@@ -126,39 +127,22 @@ FAABB UDecalComponent::GetWorldAABB() const
     // Step 1: Build the decal's oriented box so we can inspect its world-space corners.
     const FOBB DecalOBB = GetWorldOBB();
 
-    // Step 2: Initialize min/max accumulators that will grow to the final axis-aligned bounds.
-    FVector MinBounds(FLT_MAX, FLT_MAX, FLT_MAX);
-    FVector MaxBounds(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-    // Step 3: Evaluate all 8 OBB corners in world-space.
+    // Step 2: Express the OBB as a local box [-HalfExtent, HalfExtent] under a matrix whose rows are the OBB axes.
     const FVector& Center = DecalOBB.Center;
     const FVector& HalfExtent = DecalOBB.HalfExtent;
     const FVector (&Axes)[3] = DecalOBB.Axes;
 
-    for (int8 sx = -1; sx <= 1; sx += 2)
-    {
-        for (int8 sy = -1; sy <= 1; sy += 2)
-        {
-            for (int8 sz = -1; sz <= 1; sz += 2)
-            {
-                const FVector Corner = Center
-                    + Axes[0] * (HalfExtent.X * static_cast<float>(sx))
-                    + Axes[1] * (HalfExtent.Y * static_cast<float>(sy))
-                    + Axes[2] * (HalfExtent.Z * static_cast<float>(sz));
-
-                MinBounds.X = std::min(MinBounds.X, Corner.X);
-                MinBounds.Y = std::min(MinBounds.Y, Corner.Y);
-                MinBounds.Z = std::min(MinBounds.Z, Corner.Z);
-
-                MaxBounds.X = std::max(MaxBounds.X, Corner.X);
-                MaxBounds.Y = std::max(MaxBounds.Y, Corner.Y);
-                MaxBounds.Z = std::max(MaxBounds.Z, Corner.Z);
-            }
-        }
-    }
-
-    // Step 4: Package the accumulated extremes into a world-space AABB.
-    return FAABB(MinBounds, MaxBounds);
+    const FMatrix BoxToWorld(
+        Axes[0].X, Axes[0].Y, Axes[0].Z, 0.0f,
+        Axes[1].X, Axes[1].Y, Axes[1].Z, 0.0f,
+        Axes[2].X, Axes[2].Y, Axes[2].Z, 0.0f,
+        Center.X, Center.Y, Center.Z, 1.0f);
+    const FAABB LocalBox(-HalfExtent, HalfExtent);
+
+    // Step 3: Transform center/extent directly (same bounds as visiting all 8 corners).
+    FAABB WorldBox;
+    FMath::TransformAABBs(BoxToWorld, &LocalBox, &WorldBox, 1);
+    return WorldBox;
 }
 
 FOBB UDecalComponent::GetWorldOBB() const
@@ -145,7 +145,7 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
         QueryBox.Min = Center - FVector(SearchRadius, SearchRadius, SearchRadius);
         QueryBox.Max = Center + FVector(SearchRadius, SearchRadius, SearchRadius);
 
-        TArray<UPrimitiveComponent*> Candidates = GetWorld()->GetPartitionManager()->GetBVH()->QueryIntersectedComponents(QueryBox);
+        FBVHierarchy::FComponentQueryResult Candidates = GetWorld()->GetPartitionManager()->GetBVH()->QueryIntersectedComponents(QueryBox);
         Context.WorldColliders.Reserve(Candidates.Num());
 
         for (UPrimitiveComponent* Prim : Candidates)
@@ -243,7 +243,7 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
 // ============================================================================
 // Rendering
 // ============================================================================
-void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement, FFrameArenaAllocator>& OutMeshBatchElements, const FSceneView* View)
 {
     if (!IsVisible())
     {
@@ -282,7 +282,7 @@ void UParticleSystemComponent::DuplicateSubObjects()
     // TODO Release
 }
 
-void UParticleSystemComponent::BuildSpriteParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::BuildSpriteParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement, FFrameArenaAllocator>& OutMeshBatchElements, const FSceneView* View)
 {
     if (EmitterRenderData.IsEmpty())
         return;
@@ -463,7 +463,7 @@ void UParticleSystemComponent::BuildSpriteParticleBatch(TArray<FDynamicEmitterDa
     }
 }
 
-void UParticleSystemComponent::BuildMeshParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::BuildMeshParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement, FFrameArenaAllocator>& OutMeshBatchElements, const FSceneView* View)
 {
 	if (EmitterRenderData.IsEmpty())
 		return;
@@ -674,7 +674,7 @@ void UParticleSystemComponent::BuildMeshParticleBatch(TArray<FDynamicEmitterData
     }
 }
 
-void UParticleSystemComponent::BuildRibbonParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::BuildRibbonParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement, FFrameArenaAllocator>& OutMeshBatchElements, const FSceneView* View)
 {
     if (EmitterRenderData.IsEmpty())
         return;
@@ -1428,7 +1428,7 @@ void UParticleSystemComponent::RenderDebugVolume(URenderer* Renderer) const
     }
 }
 
-void UParticleSystemComponent::BuildBeamParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::BuildBeamParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement, FFrameArenaAllocator>& OutMeshBatchElements, const FSceneView* View)
 {
     if (EmitterRenderData.IsEmpty() || !View) return;
 
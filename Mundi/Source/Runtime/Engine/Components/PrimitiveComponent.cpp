@@ -88,9 +88,9 @@ bool UPrimitiveComponent::IsOverlappingActor(const AActor* Other) const
     const TArray<FOverlapInfo>& Infos = GetOverlapInfos();
     for (const FOverlapInfo& Info : Infos)
     {
-        if (Info.Other)
+        if (UPrimitiveComponent* OtherComp = Info.Other.Get())
         {
-            if (AActor* Owner = Info.Other->GetOwner())
+            if (AActor* Owner = OtherComp->GetOwner())
             {
                 if (Owner == Other)
                 {
@@ -11,10 +11,11 @@ class URenderer;
 struct FMeshBatchElement;
 class FSceneView;
 
+// 다음 갱신 전에 상대가 삭제될 수 있으므로 약한 참조로 보관
 struct FOverlapInfo
 {
-    AActor* OtherActor = nullptr;
-    UPrimitiveComponent* Other = nullptr;
+    TWeakObjectPtr<AActor> OtherActor;
+    TWeakObjectPtr<UPrimitiveComponent> Other;
 };
 
 UCLASS(DisplayName="프리미티브 컴포넌트", Description="렌더링 가능한 기본 컴포넌트입니다")
@@ -33,7 +34,7 @@ public:
     virtual FAABB GetWorldAABB() const { return FAABB(); }
 
     // 이 프리미티브를 렌더링하는 데 필요한 FMeshBatchElement를 수집합니다.
-    virtual void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) {}
+    virtual void CollectMeshBatches(TArray<FMeshBatchElement, FFrameArenaAllocator>& OutMeshBatchElements, const FSceneView* View) {}
 
     virtual UMaterialInterface* GetMaterial(uint32 InElementIndex) const
     {
@@ -88,8 +88,8 @@ void UShapeComponent::TickComponent(float DeltaSeconds)
     for (UShapeComponent* Other : OverlapNow)
     {
         FOverlapInfo Info;
-        Info.OtherActor = Other->GetOwner();
-        Info.Other = Other;
+        Info.OtherActor = TWeakObjectPtr<AActor>(Other->GetOwner());
+        Info.Other = TWeakObjectPtr<UPrimitiveComponent>(Other);
         OverlapInfos.Add(Info);
     }
 
@@ -101,7 +101,7 @@ void UShapeComponent::TickComponent(float DeltaSeconds)
             continue;
         }
 
-        if (!OverlapPrev.Contains(Comp))
+        if (!OverlapPrev.Contains(TWeakObjectPtr<UShapeComponent>(Comp)))
         {
             AActor* Owner = this->GetOwner();
             AActor* OtherOwner = Comp ? Comp->GetOwner() : nullptr;
@@ -134,8 +134,9 @@ void UShapeComponent::TickComponent(float DeltaSeconds)
     }
 
     //End
-    for (UShapeComponent* Comp : OverlapPrev)
+    for (const TWeakObjectPtr<UShapeComponent>& PrevComp : OverlapPrev)
     {
+        UShapeComponent* Comp = PrevComp.Get();
         if (!Comp || Comp->IsPendingDestroy())
         {
             continue;
@@ -167,7 +168,7 @@ void UShapeComponent::TickComponent(float DeltaSeconds)
     {
             if (Comp && !Comp->IsPendingDestroy())
             {
-                OverlapPrev.Add(Comp);
+                OverlapPrev.Add(TWeakObjectPtr<UShapeComponent>(Comp));
             }
     }
 }
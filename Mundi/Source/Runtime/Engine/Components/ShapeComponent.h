@@ -55,7 +55,7 @@ public:
 protected: 
 	mutable FAABB WorldAABB; //브로드 페이즈 용 
 	TSet<UShapeComponent*> OverlapNow; // 이번 프레임에서 overlap 된 Shap Comps
-	TSet<UShapeComponent*> OverlapPrev; // 지난 프레임에서 overlap 됐으면 Cache
+	TSet<TWeakObjectPtr<UShapeComponent>> OverlapPrev; // 지난 프레임에서 overlap 됐으면 Cache (그 사이 삭제될 수 있어 약한 참조)
 	 
 
 	FVector4 ShapeColor ;
@@ -18,6 +18,7 @@
 
 #include "PlatformTime.h"
 #include "USlateManager.h"
+#include "VectorBatch.h"
 #include "BlueprintGraph/AnimBlueprintCompiler.h"
 
 #include "Source/Runtime/Engine/Physics/PhysScene.h"
@@ -284,6 +285,8 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
         switch (PhysicsState)
         {
             case EPhysicsAnimationState::AnimationDriven:
+            {
+                FMemoryTagScope TagScope(EMemoryTag::Animation);
                 AnimInstance->NativeUpdateAnimation(DeltaTime);
                 ApplyRootMotion();
                 if (PhysScene)
@@ -291,6 +294,7 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
                     SyncBodiesFromAnimation(*PhysScene);
                 }
                 break;
+            }
 
             case EPhysicsAnimationState::PhysicsDriven:
                 SyncAnimationFromBodies();
@@ -688,13 +692,20 @@ void USkeletalMeshComponent::UpdateFinalSkinningMatrices()
     const FSkeleton& Skeleton = SkeletalMesh->GetSkeletalMeshData()->Skeleton;
     const int32 NumBones = Skeleton.Bones.Num();
 
+    // 본 구조체에 흩어진 행렬을 연속 배열로 모은 뒤 배치 커널로 처리
+    // (노멀 배열은 역행렬을 쓰기 전까지 컴포넌트 포즈 임시 저장소로 사용)
     for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
     {
-        const FMatrix& InvBindPose = Skeleton.Bones[BoneIndex].InverseBindPose;
-        const FMatrix ComponentPoseMatrix = CurrentComponentSpacePose[BoneIndex].ToMatrix();
+        TempFinalSkinningMatrices[BoneIndex] = Skeleton.Bones[BoneIndex].InverseBindPose;
+        TempFinalSkinningNormalMatrices[BoneIndex] = CurrentComponentSpacePose[BoneIndex].ToMatrix();
+    }
 
-        TempFinalSkinningMatrices[BoneIndex] = InvBindPose * ComponentPoseMatrix;
-        TempFinalSkinningNormalMatrices[BoneIndex] = TempFinalSkinningMatrices[BoneIndex].Inverse().Transpose();
+    FMath::MultiplyMatrices(TempFinalSkinningMatrices.GetData(), TempFinalSkinningNormalMatrices.GetData(), TempFinalSkinningMatrices.GetData(), NumBones);
+    FMath::InverseMatrices(TempFinalSkinningMatrices.GetData(), TempFinalSkinningNormalMatrices.GetData(), NumBones);
+
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        TempFinalSkinningNormalMatrices[BoneIndex] = TempFinalSkinningNormalMatrices[BoneIndex].Transpose();
     }
 }
 
@@ -5,6 +5,7 @@
 #include "MeshBatchElement.h"
 #include "PlatformTime.h"
 #include "SceneView.h"
+#include "VectorBatch.h"
 
 USkinnedMeshComponent::USkinnedMeshComponent() : SkeletalMesh(nullptr)
 {
@@ -112,7 +113,7 @@ void USkinnedMeshComponent::DuplicateSubObjects()
 //    Renderer->EndLineBatch(FMatrix::Identity());
 // }
 
-void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement, FFrameArenaAllocator>& OutMeshBatchElements, const FSceneView* View)
 {
    if (!SkeletalMesh || !SkeletalMesh->GetSkeletalMeshData()) { return; }
 
@@ -266,9 +267,12 @@ FAABB USkinnedMeshComponent::GetWorldAABB() const
       return{};
    }
    
-   FAABB WorldAABB = FAABB(FVector(FLT_MAX), FVector(-FLT_MAX));
    const uint32 BoneCount = SkeletalMesh->GetBoneCount();
    const FMatrix& WorldMatrix = GetWorldTransform().ToMatrix();
+
+   // 유효한 본 AABB와 본 -> 월드 행렬을 모아 한 번에 변환 (꼭짓점 8개 대신 중심/반크기로 계산)
+   TArray<FAABB, TInlineAllocator<64>> LocalBoxes;
+   TArray<FMatrix, TInlineAllocator<64>> BoneToWorlds;
    for (int32 i = 0; i < BoneCount; i++)
    {
       const FAABB& LocalAABB = BoneLocalAABBs[i];
@@ -277,21 +281,17 @@ FAABB USkinnedMeshComponent::GetWorldAABB() const
       {
          continue;
       }
-   
-      TArray<FVector> LocalCorners = LocalAABB.GetVertices();
-      FMatrix CurrentSKinningMatrix = FinalSkinningMatrices[i];
-      FMatrix BoneToWorld = CurrentSKinningMatrix * WorldMatrix;
-      for (const FVector& Corner : LocalCorners)
-      {
-         // 로컬 꼭짓점 -> 월드 꼭짓점
-         FVector WorldCorner = BoneToWorld.TransformPosition(Corner);
-         FAABB PointAABB(WorldCorner, WorldCorner);
-   
-         WorldAABB = FAABB::Union(WorldAABB, PointAABB);
-      }
+
+      LocalBoxes.Add(LocalAABB);
+      BoneToWorlds.Add(FinalSkinningMatrices[i] * WorldMatrix);
    }
 
-   return WorldAABB;
+   TArray<FAABB, TInlineAllocator<64>> WorldBoxes;
+   WorldBoxes.SetNum(LocalBoxes.Num());
+   FMath::TransformAABBs(BoneToWorlds.GetData(), LocalBoxes.GetData(), WorldBoxes.GetData(), LocalBoxes.Num());
+
+   // 모든 박스의 Min/Max 점을 감싸는 AABB = 박스들의 합집합
+   return FMath::ComputeBounds(reinterpret_cast<const FVector*>(WorldBoxes.GetData()), WorldBoxes.Num() * 2);
 }
 
 void USkinnedMeshComponent::OnTransformUpdated()
@@ -22,7 +22,7 @@ public:
     
 // Mesh Component Section
 public:
-    void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+    void CollectMeshBatches(TArray<FMeshBatchElement, FFrameArenaAllocator>& OutMeshBatchElements, const FSceneView* View) override;
     
     FAABB GetWorldAABB() const override;
     void OnTransformUpdated() override;
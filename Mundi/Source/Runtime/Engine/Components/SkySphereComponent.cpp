@@ -49,7 +49,7 @@ FAABB USkySphereComponent::GetWorldAABB() const
 	return FAABB(FVector(-HugeSize), FVector(HugeSize));
 }
 
-void USkySphereComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void USkySphereComponent::CollectMeshBatches(TArray<FMeshBatchElement, FFrameArenaAllocator>& OutMeshBatchElements, const FSceneView* View)
 {
 	// 리소스 로드 확인
 	EnsureResourcesLoaded();
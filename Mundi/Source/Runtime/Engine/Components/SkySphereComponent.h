@@ -50,7 +50,7 @@ public:
 
 	// UPrimitiveComponent Interface
 	FAABB GetWorldAABB() const override;
-	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+	void CollectMeshBatches(TArray<FMeshBatchElement, FFrameArenaAllocator>& OutMeshBatchElements, const FSceneView* View) override;
 
 protected:
 	FSkyConstantBuffer SkyParams;
@@ -8,6 +8,7 @@
 #include "CameraComponent.h"
 #include "MeshBatchElement.h"
 #include "Material.h"
+#include "VectorBatch.h"
 #include "SceneView.h"
 #include "LuaBindHelpers.h"
 #include "Source/Runtime/Engine/Physics/BodyInstance.h"
@@ -153,7 +154,7 @@ void UStaticMeshComponent::OnStaticMeshReleased(UStaticMesh* ReleasedMesh)
 	StaticMesh = nullptr;
 }
 
-void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement, FFrameArenaAllocator>& OutMeshBatchElements, const FSceneView* View)
 {
 	if (!StaticMesh || !StaticMesh->GetStaticMeshAsset())
 	{
@@ -291,38 +292,11 @@ FAABB UStaticMeshComponent::GetWorldAABB() const
 		return FAABB(Origin, Origin);
 	}
 
+	// 꼭짓점 8개를 변환하는 대신 중심/반크기로 월드 AABB 계산 (결과 동일)
 	const FAABB LocalBound = StaticMesh->GetLocalBound();
-	const FVector LocalMin = LocalBound.Min;
-	const FVector LocalMax = LocalBound.Max;
-
-	const FVector LocalCorners[8] = {
-		FVector(LocalMin.X, LocalMin.Y, LocalMin.Z),
-		FVector(LocalMax.X, LocalMin.Y, LocalMin.Z),
-		FVector(LocalMin.X, LocalMax.Y, LocalMin.Z),
-		FVector(LocalMax.X, LocalMax.Y, LocalMin.Z),
-		FVector(LocalMin.X, LocalMin.Y, LocalMax.Z),
-		FVector(LocalMax.X, LocalMin.Y, LocalMax.Z),
-		FVector(LocalMin.X, LocalMax.Y, LocalMax.Z),
-		FVector(LocalMax.X, LocalMax.Y, LocalMax.Z)
-	};
-
-	FVector4 WorldMin4 = FVector4(LocalCorners[0].X, LocalCorners[0].Y, LocalCorners[0].Z, 1.0f) * WorldMatrix;
-	FVector4 WorldMax4 = WorldMin4;
-
-	for (int32 CornerIndex = 1; CornerIndex < 8; ++CornerIndex)
-	{
-		const FVector4 WorldPos = FVector4(LocalCorners[CornerIndex].X
-			, LocalCorners[CornerIndex].Y
-			, LocalCorners[CornerIndex].Z
-			, 1.0f)
-			* WorldMatrix;
-		WorldMin4 = WorldMin4.ComponentMin(WorldPos);
-		WorldMax4 = WorldMax4.ComponentMax(WorldPos);
-	}
-
-	FVector WorldMin = FVector(WorldMin4.X, WorldMin4.Y, WorldMin4.Z);
-	FVector WorldMax = FVector(WorldMax4.X, WorldMax4.Y, WorldMax4.Z);
-	return FAABB(WorldMin, WorldMax);
+	FAABB WorldBound;
+	FMath::TransformAABBs(WorldMatrix, &LocalBound, &WorldBound, 1);
+	return WorldBound;
 }
 
 void UStaticMeshComponent::OnTransformUpdated()
@@ -36,7 +36,7 @@ public:
 
 	void OnStaticMeshReleased(UStaticMesh* ReleasedMesh);
 
-	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+	void CollectMeshBatches(TArray<FMeshBatchElement, FFrameArenaAllocator>& OutMeshBatchElements, const FSceneView* View) override;
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
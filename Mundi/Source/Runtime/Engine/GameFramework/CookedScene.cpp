@@ -0,0 +1,767 @@
+﻿#include "pch.h"
+#include "CookedScene.h"
+#include "JsonSerializer.h"
+#include "JsonReader.h"
+#include "MappedFileReader.h"
+#include "WindowsBinWriter.h"
+#include "DerivedDataCache.h"
+#include <cstring>
+#include <stdexcept>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // 포맷(태그/슬롯 배치)이 바뀌면 올림
+    constexpr uint32 CookedSceneMagic = 0x4E435343; // 'CSCN'
+    constexpr uint32 CookedSceneVersion = 1;
+
+    // 손상된 파일로 ReadValue 재귀가 스택을 넘지 않도록 제한
+    constexpr int32 MaxValueDepth = 256;
+
+    enum class ECookedValue : uint8
+    {
+        Null,
+        False,
+        True,
+        Int,            // int64
+        Float,          // float으로 손실 없이 표현되는 실수
+        Double,
+        String,         // 문자열 테이블 인덱스
+        Array,          // uint32 개수 + 값들
+        Object,         // uint32 개수 + (키 인덱스, 값)들
+        ClassObject,    // 클래스 인덱스 + 프로퍼티 슬롯들 + 나머지 키-값
+    };
+
+    enum class ECookedSlot : uint8
+    {
+        Absent,         // JSON에 키가 없음
+        Packed,         // 프로퍼티 타입별 고정 배치 (태그 없음)
+        Value,          // 타입과 모양이 달라 태그 붙은 값으로 저장
+    };
+
+    /** 메모리 버퍼에 쓰는 아카이브 (본문은 테이블이 끝난 뒤 한 번에 파일로) */
+    class FBufferWriter : public FArchive
+    {
+    public:
+        FBufferWriter() : FArchive(false, true) {}
+
+        void Serialize(void* Data, int64 Length) override
+        {
+            const uint8* Bytes = static_cast<const uint8*>(Data);
+            Buffer.insert(Buffer.end(), Bytes, Bytes + Length);
+        }
+        void Seek(int64) override {}
+        int64 Tell() const override { return static_cast<int64>(Buffer.size()); }
+        bool Close() override { return true; }
+
+        TArray<uint8> Buffer;
+    };
+
+    inline bool IsExactFloat(double Value)
+    {
+        return static_cast<double>(static_cast<float>(Value)) == Value;
+    }
+
+    /** 숫자 고정 배치를 쓰는 프로퍼티 타입과 float 개수 (나머지 타입의 고정 배치는 문자열 인덱스) */
+    int32 GetPackedFloatCount(EPropertyType Type)
+    {
+        switch (Type)
+        {
+        case EPropertyType::Float:        return 1;
+        case EPropertyType::FVector:      return 3;
+        case EPropertyType::FLinearColor: return 4;
+        default:                          return 0;
+        }
+    }
+
+    /** 프로퍼티 이름/타입 목록이 바뀌면 슬롯 배치가 달라지므로 클래스 테이블 전체를 해시 */
+    uint64 HashSchema(const TArray<UClass*>& InClasses)
+    {
+        uint64 Hash = 14695981039346656037ull;
+        auto Mix = [&Hash](const void* Data, SIZE_T Size)
+            {
+                const uint8* Bytes = static_cast<const uint8*>(Data);
+                for (SIZE_T i = 0; i < Size; ++i)
+                {
+                    Hash = (Hash ^ Bytes[i]) * 1099511628211ull;
+                }
+            };
+
+        for (const UClass* Class : InClasses)
+        {
+            Mix(Class->Name, std::strlen(Class->Name) + 1);
+            for (const FProperty& Prop : Class->GetAllProperties())
+            {
+                Mix(Prop.Name, std::strlen(Prop.Name) + 1);
+                Mix(&Prop.Type, sizeof(Prop.Type));
+                Mix(&Prop.InnerType, sizeof(Prop.InnerType));
+            }
+        }
+        return Hash;
+    }
+
+    uint64 HashSceneSource(const FWideString& InScenePath)
+    {
+        return FDerivedDataCache::GetInstance().HashSourceFile(WideToUTF8(InScenePath));
+    }
+
+    /** 원본 해시로 찾으므로 .scene이 바뀌면 자연히 다른 엔트리가 되고, 오래된 엔트리는 DDC LRU로 정리됨 */
+    FDerivedDataKey MakeCookedSceneKey(uint64 SourceHash)
+    {
+        return FDerivedDataKey{ "Scene", CookedSceneVersion, SourceHash };
+    }
+
+    /** "Type"이 등록된 클래스 이름이면 그 클래스 */
+    UClass* FindObjectClass(JSON& InJson)
+    {
+        if (!InJson.hasKey("Type"))
+        {
+            return nullptr;
+        }
+        const JSON& TypeJson = InJson.at("Type");
+        if (TypeJson.JSONType() != JSON::Class::String)
+        {
+            return nullptr;
+        }
+        return UClass::FindClass(FName(TypeJson.ToString()));
+    }
+}
+
+//====================================================================================
+// FCookedScene
+//====================================================================================
+
+bool FCookedScene::CookFile(const FWideString& InScenePath)
+{
+    FJsonReader Reader(InScenePath);
+    if (!Reader.IsValid() || Reader.Next() != EJsonToken::BeginObject)
+    {
+        return false;
+    }
+
+    static const FName PerspectiveCameraKey("PerspectiveCamera");
+    static const FName ActorsKey("Actors");
+
+    FCookedSceneWriter Writer(InScenePath);
+    while (Reader.Next() == EJsonToken::Key)
+    {
+        const FName Key = Reader.GetKeyName();
+        if (Key == PerspectiveCameraKey)
+        {
+            JSON CameraJson;
+            if (Reader.ReadValue(CameraJson))
+            {
+                Writer.WriteCamera(CameraJson);
+            }
+        }
+        else if (Key == ActorsKey && Reader.Next() == EJsonToken::BeginObject)
+        {
+            while (Reader.Next() == EJsonToken::Key)
+            {
+                JSON ActorJson;
+                if (!Reader.ReadValue(ActorJson))
+                {
+                    break;
+                }
+                Writer.WriteActor(ActorJson);
+            }
+        }
+        else
+        {
+            Reader.SkipValue();
+        }
+    }
+
+    if (Reader.HasError() || Reader.Next() != EJsonToken::None)
+    {
+        UE_LOG("[error] CookedScene: %s 파싱 실패: %s", WideToUTF8(InScenePath).c_str(), Reader.GetErrorMessage().c_str());
+        return false;
+    }
+    return Writer.Finish();
+}
+
+//====================================================================================
+// FCookedSceneWriter
+//====================================================================================
+
+struct FCookedSceneWriter::FImpl
+{
+    uint64 SourceHash = 0;
+
+    TArray<FString> Strings;
+    TMap<FString, uint32> StringIndices;
+    TArray<UClass*> Classes;
+    TArray<uint32> ClassNames;      // 클래스 이름의 문자열 테이블 인덱스
+    TMap<UClass*, uint32> ClassIndices;
+
+    FBufferWriter Camera;
+    FBufferWriter Actors;
+    bool bHasCamera = false;
+    uint32 NumActors = 0;
+
+    uint32 AddString(const FString& InString)
+    {
+        if (const uint32* Found = StringIndices.Find(InString))
+        {
+            return *Found;
+        }
+        const uint32 Index = static_cast<uint32>(Strings.Num());
+        Strings.Add(InString);
+        StringIndices.Add(InString, Index);
+        return Index;
+    }
+
+    uint32 AddClass(UClass* InClass)
+    {
+        if (const uint32* Found = ClassIndices.Find(InClass))
+        {
+            return *Found;
+        }
+        const uint32 Index = static_cast<uint32>(Classes.Num());
+        Classes.Add(InClass);
+        ClassNames.Add(AddString(InClass->Name));
+        ClassIndices.Add(InClass, Index);
+        return Index;
+    }
+
+    void WriteTag(FArchive& Ar, ECookedValue Tag)
+    {
+        Ar << Tag;
+    }
+
+    void WriteValue(FArchive& Ar, JSON& InJson)
+    {
+        switch (InJson.JSONType())
+        {
+        case JSON::Class::Boolean:
+            WriteTag(Ar, InJson.ToBool() ? ECookedValue::True : ECookedValue::False);
+            break;
+        case JSON::Class::Integral:
+        {
+            WriteTag(Ar, ECookedValue::Int);
+            int64 Value = static_cast<int64>(InJson.ToInt());
+            Ar << Value;
+            break;
+        }
+        case JSON::Class::Floating:
+        {
+            double Value = InJson.ToFloat();
+            if (IsExactFloat(Value))
+            {
+                WriteTag(Ar, ECookedValue::Float);
+                float FloatValue = static_cast<float>(Value);
+                Ar << FloatValue;
+            }
+            else
+            {
+                WriteTag(Ar, ECookedValue::Double);
+                Ar << Value;
+            }
+            break;
+        }
+        case JSON::Class::String:
+        {
+            WriteTag(Ar, ECookedValue::String);
+            uint32 Index = AddString(InJson.ToString());
+            Ar << Index;
+            break;
+        }
+        case JSON::Class::Array:
+        {
+            WriteTag(Ar, ECookedValue::Array);
+            uint32 Count = static_cast<uint32>(InJson.size());
+            Ar << Count;
+            for (uint32 i = 0; i < Count; ++i)
+            {
+                WriteValue(Ar, InJson.at(i));
+            }
+            break;
+        }
+        case JSON::Class::Object:
+            if (UClass* Class = FindObjectClass(InJson))
+            {
+                WriteClassObject(Ar, InJson, Class);
+            }
+            else
+            {
+                WriteTag(Ar, ECookedValue::Object);
+                uint32 Count = static_cast<uint32>(InJson.size());
+                Ar << Count;
+                for (auto& Pair : InJson.ObjectRange())
+                {
+                    uint32 KeyIndex = AddString(Pair.first);
+                    Ar << KeyIndex;
+                    WriteValue(Ar, Pair.second);
+                }
+            }
+            break;
+        default:
+            WriteTag(Ar, ECookedValue::Null);
+            break;
+        }
+    }
+
+    /**
+     * 값이 프로퍼티 타입의 고정 배치와 모양이 같으면 Packed 슬롯으로 씀
+     * 모양 검사가 끝난 뒤에만 쓰므로 실패하면 아무것도 쓰지 않음
+     */
+    bool TryWritePacked(FArchive& Ar, const FProperty& Prop, JSON& InJson)
+    {
+        ECookedSlot PackedSlot = ECookedSlot::Packed;
+        switch (Prop.Type)
+        {
+        case EPropertyType::Bool:
+        {
+            if (InJson.JSONType() != JSON::Class::Boolean)
+            {
+                return false;
+            }
+            uint8 Value = InJson.ToBool() ? 1 : 0;
+            Ar << PackedSlot << Value;
+            return true;
+        }
+        case EPropertyType::Int32:
+        {
+            if (InJson.JSONType() != JSON::Class::Integral)
+            {
+                return false;
+            }
+            const int64 Wide = static_cast<int64>(InJson.ToInt());
+            int32 Value = static_cast<int32>(Wide);
+            if (Value != Wide)
+            {
+                return false;
+            }
+            Ar << PackedSlot << Value;
+            return true;
+        }
+        case EPropertyType::Float:
+        case EPropertyType::FVector:
+        case EPropertyType::FLinearColor:
+        {
+            // Float는 스칼라, FVector/FLinearColor는 실수 3/4개 배열
+            const int32 Count = GetPackedFloatCount(Prop.Type);
+            float Values[4];
+            if (Prop.Type == EPropertyType::Float)
+            {
+                if (InJson.JSONType() != JSON::Class::Floating || !IsExactFloat(InJson.ToFloat()))
+                {
+                    return false;
+                }
+                Values[0] = static_cast<float>(InJson.ToFloat());
+            }
+            else
+            {
+                if (InJson.JSONType() != JSON::Class::Array || InJson.size() != Count)
+                {
+                    return false;
+                }
+                for (int32 i = 0; i < Count; ++i)
+                {
+                    JSON& Element = InJson.at(static_cast<unsigned>(i));
+                    if (Element.JSONType() != JSON::Class::Floating || !IsExactFloat(Element.ToFloat()))
+                    {
+                        return false;
+                    }
+                    Values[i] = static_cast<float>(Element.ToFloat());
+                }
+            }
+            Ar << PackedSlot;
+            Ar.Serialize(Values, sizeof(float) * Count);
+            return true;
+        }
+        default:
+        {
+            // FString/FName/에셋 경로 등 - 문자열이면 테이블 인덱스만
+            if (InJson.JSONType() != JSON::Class::String)
+            {
+                return false;
+            }
+            uint32 Index = AddString(InJson.ToString());
+            Ar << PackedSlot << Index;
+            return true;
+        }
+        }
+    }
+
+    void WriteClassObject(FArchive& Ar, JSON& InJson, UClass* Class)
+    {
+        WriteTag(Ar, ECookedValue::ClassObject);
+        uint32 ClassIndex = AddClass(Class);
+        Ar << ClassIndex;
+
+        const TArray<FProperty>& Properties = Class->GetAllProperties();
+        for (const FProperty& Prop : Properties)
+        {
+            if (!InJson.hasKey(Prop.Name))
+            {
+                ECookedSlot Slot = ECookedSlot::Absent;
+                Ar << Slot;
+                continue;
+            }
+
+            JSON& Value = InJson.at(Prop.Name);
+            if (!TryWritePacked(Ar, Prop, Value))
+            {
+                ECookedSlot Slot = ECookedSlot::Value;
+                Ar << Slot;
+                WriteValue(Ar, Value);
+            }
+        }
+
+        // 리플렉션에 없는 키
+        TArray<JSON*> ExtraValues;
+        TArray<uint32> ExtraKeys;
+        for (auto& Pair : InJson.ObjectRange())
+        {
+            const bool bIsProperty = std::any_of(Properties.begin(), Properties.end(),
+                [&Pair](const FProperty& Prop) { return Pair.first == Prop.Name; });
+            if (!bIsProperty)
+            {
+                ExtraKeys.Add(AddString(Pair.first));
+                ExtraValues.Add(&Pair.second);
+            }
+        }
+
+        uint32 NumExtra = static_cast<uint32>(ExtraKeys.Num());
+        Ar << NumExtra;
+        for (uint32 i = 0; i < NumExtra; ++i)
+        {
+            Ar << ExtraKeys[i];
+            WriteValue(Ar, *ExtraValues[i]);
+        }
+    }
+};
+
+FCookedSceneWriter::FCookedSceneWriter(const FWideString& InScenePath)
+    : Impl(std::make_unique<FImpl>())
+{
+    // 읽기 전에 해시 - 쿠킹 도중 원본이 바뀌면 다음 로드에서 오래된 것으로 판정
+    Impl->SourceHash = HashSceneSource(InScenePath);
+}
+
+FCookedSceneWriter::~FCookedSceneWriter() = default;
+
+void FCookedSceneWriter::WriteCamera(JSON& InCameraJson)
+{
+    Impl->Camera.Buffer.clear();
+    Impl->WriteValue(Impl->Camera, InCameraJson);
+    Impl->bHasCamera = true;
+}
+
+void FCookedSceneWriter::WriteActor(JSON& InActorJson)
+{
+    Impl->WriteValue(Impl->Actors, InActorJson);
+    ++Impl->NumActors;
+}
+
+bool FCookedSceneWriter::Finish()
+{
+    if (Impl->SourceHash == 0)
+    {
+        return false;
+    }
+
+    FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+    const FDerivedDataKey Key = MakeCookedSceneKey(Impl->SourceHash);
+    const FString TempPath = DDC.GetTempPath(Key);
+
+    try
+    {
+        FWindowsBinWriter Writer(TempPath);
+
+        uint32 Magic = CookedSceneMagic;
+        uint32 Version = CookedSceneVersion;
+        uint64 SourceHash = Impl->SourceHash;
+        uint64 SchemaHash = HashSchema(Impl->Classes);
+        Writer << Magic << Version << SourceHash << SchemaHash;
+
+        uint32 NumStrings = static_cast<uint32>(Impl->Strings.Num());
+        Writer << NumStrings;
+        for (const FString& String : Impl->Strings)
+        {
+            Serialization::WriteString(Writer, String);
+        }
+
+        // 클래스 이름은 문자열 테이블 인덱스로
+        Serialization::WriteArray(Writer, Impl->ClassNames);
+
+        uint8 bHasCamera = Impl->bHasCamera ? 1 : 0;
+        uint32 NumActors = Impl->NumActors;
+        Writer << bHasCamera << NumActors;
+        Writer.Serialize(Impl->Camera.Buffer.data(), Impl->Camera.Tell());
+        Writer.Serialize(Impl->Actors.Buffer.data(), Impl->Actors.Tell());
+
+        if (Writer.Tell() < 0)
+        {
+            throw std::runtime_error("write failed");
+        }
+        Writer.Close();
+    }
+    catch (const std::exception& e)
+    {
+        UE_LOG("[error] CookedScene: %s 쓰기 실패: %s", Key.ToString().c_str(), e.what());
+        std::error_code Ec;
+        fs::remove(fs::path(UTF8ToWide(TempPath)), Ec);
+        return false;
+    }
+
+    return DDC.Commit(Key, TempPath);
+}
+
+//====================================================================================
+// FCookedSceneReader
+//====================================================================================
+
+FCookedSceneReader::FCookedSceneReader(const FWideString& InScenePath)
+{
+    const uint64 ExpectedSourceHash = HashSceneSource(InScenePath);
+    FString CookedPath;
+    if (!FDerivedDataCache::GetInstance().Find(MakeCookedSceneKey(ExpectedSourceHash), CookedPath))
+    {
+        return;
+    }
+
+    try
+    {
+        Archive = std::make_unique<FMappedFileReader>(CookedPath);
+        if (!Archive->IsOpen())
+        {
+            return;
+        }
+
+        uint32 Magic = 0, Version = 0;
+        uint64 SourceHash = 0, SchemaHash = 0;
+        *Archive << Magic << Version << SourceHash << SchemaHash;
+        if (Magic != CookedSceneMagic || Version != CookedSceneVersion || SourceHash != ExpectedSourceHash)
+        {
+            return;
+        }
+
+        uint32 NumStrings = 0;
+        *Archive << NumStrings;
+        if (NumStrings > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+        {
+            return;
+        }
+        Strings.resize(NumStrings);
+        for (FString& String : Strings)
+        {
+            Serialization::ReadString(*Archive, String);
+        }
+
+        TArray<uint32> ClassNames;
+        Serialization::ReadArray(*Archive, ClassNames);
+        for (uint32 NameIndex : ClassNames)
+        {
+            UClass* Class = UClass::FindClass(FName(GetString(NameIndex)));
+            if (!Class)
+            {
+                return; // 클래스가 사라짐
+            }
+            Classes.Add(Class);
+        }
+        if (HashSchema(Classes) != SchemaHash)
+        {
+            return; // 프로퍼티 목록이 바뀜
+        }
+
+        uint8 bCamera = 0;
+        *Archive << bCamera << NumActors;
+        bHasCamera = bCamera != 0;
+        bValid = true;
+    }
+    catch (const std::exception&)
+    {
+        bValid = false;
+    }
+}
+
+FCookedSceneReader::~FCookedSceneReader() = default;
+
+const FString& FCookedSceneReader::GetString(uint32 Index) const
+{
+    if (Index >= static_cast<uint32>(Strings.Num()))
+    {
+        throw std::runtime_error("Cooked scene corrupt: string index out of range.");
+    }
+    return Strings[Index];
+}
+
+void FCookedSceneReader::ReadCamera(JSON& OutJson)
+{
+    ReadValue(OutJson, 0);
+}
+
+void FCookedSceneReader::ReadActor(JSON& OutJson)
+{
+    ReadValue(OutJson, 0);
+}
+
+void FCookedSceneReader::ReadValue(JSON& OutJson, int32 Depth)
+{
+    if (Depth > MaxValueDepth)
+    {
+        throw std::runtime_error("Cooked scene corrupt: nesting too deep.");
+    }
+
+    ECookedValue Tag;
+    *Archive << Tag;
+    switch (Tag)
+    {
+    case ECookedValue::Null:
+        OutJson = JSON();
+        break;
+    case ECookedValue::False:
+        OutJson = false;
+        break;
+    case ECookedValue::True:
+        OutJson = true;
+        break;
+    case ECookedValue::Int:
+    {
+        int64 Value;
+        *Archive << Value;
+        OutJson = Value;
+        break;
+    }
+    case ECookedValue::Float:
+    {
+        float Value;
+        *Archive << Value;
+        OutJson = static_cast<double>(Value);
+        break;
+    }
+    case ECookedValue::Double:
+    {
+        double Value;
+        *Archive << Value;
+        OutJson = Value;
+        break;
+    }
+    case ECookedValue::String:
+    {
+        uint32 Index;
+        *Archive << Index;
+        OutJson = GetString(Index);
+        break;
+    }
+    case ECookedValue::Array:
+    {
+        uint32 Count;
+        *Archive << Count;
+        OutJson = JSON::Make(JSON::Class::Array);
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            ReadValue(OutJson[i], Depth + 1);
+        }
+        break;
+    }
+    case ECookedValue::Object:
+    {
+        uint32 Count;
+        *Archive << Count;
+        OutJson = JSON::Make(JSON::Class::Object);
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            uint32 KeyIndex;
+            *Archive << KeyIndex;
+            ReadValue(OutJson[GetString(KeyIndex)], Depth + 1);
+        }
+        break;
+    }
+    case ECookedValue::ClassObject:
+        ReadClassObject(OutJson, Depth);
+        break;
+    default:
+        throw std::runtime_error("Cooked scene corrupt: unknown value tag.");
+    }
+}
+
+void FCookedSceneReader::ReadClassObject(JSON& OutJson, int32 Depth)
+{
+    uint32 ClassIndex;
+    *Archive << ClassIndex;
+    if (ClassIndex >= static_cast<uint32>(Classes.Num()))
+    {
+        throw std::runtime_error("Cooked scene corrupt: class index out of range.");
+    }
+
+    OutJson = JSON::Make(JSON::Class::Object);
+    for (const FProperty& Prop : Classes[ClassIndex]->GetAllProperties())
+    {
+        ECookedSlot Slot;
+        *Archive << Slot;
+        if (Slot == ECookedSlot::Absent)
+        {
+            continue;
+        }
+
+        JSON& Value = OutJson[Prop.Name];
+        if (Slot == ECookedSlot::Value)
+        {
+            ReadValue(Value, Depth + 1);
+            continue;
+        }
+        if (Slot != ECookedSlot::Packed)
+        {
+            throw std::runtime_error("Cooked scene corrupt: unknown property slot.");
+        }
+
+        switch (Prop.Type)
+        {
+        case EPropertyType::Bool:
+        {
+            uint8 Packed;
+            *Archive << Packed;
+            Value = Packed != 0;
+            break;
+        }
+        case EPropertyType::Int32:
+        {
+            int32 Packed;
+            *Archive << Packed;
+            Value = Packed;
+            break;
+        }
+        case EPropertyType::Float:
+        {
+            float Packed;
+            *Archive << Packed;
+            Value = static_cast<double>(Packed);
+            break;
+        }
+        case EPropertyType::FVector:
+        case EPropertyType::FLinearColor:
+        {
+            const int32 Count = GetPackedFloatCount(Prop.Type);
+            float Packed[4];
+            Archive->Serialize(Packed, sizeof(float) * Count);
+            Value = JSON::Make(JSON::Class::Array);
+            for (int32 i = 0; i < Count; ++i)
+            {
+                Value[static_cast<unsigned>(i)] = static_cast<double>(Packed[i]);
+            }
+            break;
+        }
+        default:
+        {
+            uint32 Index;
+            *Archive << Index;
+            Value = GetString(Index);
+            break;
+        }
+        }
+    }
+
+    uint32 NumExtra;
+    *Archive << NumExtra;
+    for (uint32 i = 0; i < NumExtra; ++i)
+    {
+        uint32 KeyIndex;
+        *Archive << KeyIndex;
+        ReadValue(OutJson[GetString(KeyIndex)], Depth + 1);
+    }
+}
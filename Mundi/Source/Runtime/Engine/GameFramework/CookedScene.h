@@ -0,0 +1,82 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include <memory>
+
+namespace json { class JSON; }
+class FMappedFileReader;
+struct UClass;
+
+/**
+ * 쿠킹된 씬 (DDC "Scene" 버킷, 키는 원본 .scene 콘텐츠 해시 - 소스 트리에는 쓰지 않음)
+ *
+ * - 헤더: 매직, 포맷 버전, 원본 .scene 해시, 리플렉션 스키마 해시
+ * - 문자열 테이블: 키, 클래스 이름, 문자열 값(FName/에셋 경로 등)을 한 번씩만 저장하고 인덱스로 참조
+ * - "Type"이 등록된 UClass인 객체(액터/컴포넌트)는 GetAllProperties() 순서대로 값을 쓰고 키는 생략
+ *   (bool/int32/float/FVector/FLinearColor/문자열은 태그 없는 고정 크기, 모양이 다르면 태그 붙은 값)
+ * - 리플렉션에 없는 키(Type, Id, ParentId, OwnedComponents 등)는 뒤에 키-값으로 저장
+ *
+ * 로드는 액터 하나씩 JSON으로 복원해 기존 Serialize를 그대로 호출하므로 손으로 쓴 Serialize 코드도 그대로 동작합니다.
+ * 텍스트 파싱과 실수 <-> 문자열 변환이 없고, 원본이 바뀌었거나 프로퍼티 목록이 바뀌면 오래된 것으로 보고 쓰지 않습니다.
+ */
+class FCookedScene
+{
+public:
+    /** .scene을 스트리밍으로 읽어 쿠킹 결과를 DDC에 등록 (저장 직후 쿠킹용) */
+    static bool CookFile(const FWideString& InScenePath);
+};
+
+/** .scene을 읽는 쪽에서 카메라/액터 JSON을 넘겨받아 쿠킹된 씬을 만듦 */
+class FCookedSceneWriter
+{
+public:
+    explicit FCookedSceneWriter(const FWideString& InScenePath);
+    ~FCookedSceneWriter();
+
+    FCookedSceneWriter(const FCookedSceneWriter&) = delete;
+    FCookedSceneWriter& operator=(const FCookedSceneWriter&) = delete;
+
+    void WriteCamera(json::JSON& InCameraJson);
+    void WriteActor(json::JSON& InActorJson);
+
+    /** 테이블과 본문을 DDC 임시 파일에 쓰고 엔트리로 등록 */
+    bool Finish();
+
+private:
+    struct FImpl;
+    std::unique_ptr<FImpl> Impl;
+};
+
+/**
+ * 쿠킹된 씬 읽기
+ * IsValid()면 HasCamera()일 때 ReadCamera를 먼저, 그다음 ReadActor를 GetNumActors()번 호출합니다.
+ * 본문이 손상되어 있으면 std::runtime_error
+ */
+class FCookedSceneReader
+{
+public:
+    explicit FCookedSceneReader(const FWideString& InScenePath);
+    ~FCookedSceneReader();
+
+    FCookedSceneReader(const FCookedSceneReader&) = delete;
+    FCookedSceneReader& operator=(const FCookedSceneReader&) = delete;
+
+    /** 파일이 있고 원본 .scene 및 현재 리플렉션 정보와 일치하는지 */
+    bool IsValid() const { return bValid; }
+    bool HasCamera() const { return bHasCamera; }
+    uint32 GetNumActors() const { return NumActors; }
+
+    void ReadCamera(json::JSON& OutJson);
+    void ReadActor(json::JSON& OutJson);
+
+private:
+    void ReadValue(json::JSON& OutJson, int32 Depth);
+    void ReadClassObject(json::JSON& OutJson, int32 Depth);
+    const FString& GetString(uint32 Index) const;
+
+    std::unique_ptr<FMappedFileReader> Archive;
+    TArray<FString> Strings;
+    TArray<UClass*> Classes;
+    uint32 NumActors = 0;
+    bool bHasCamera = false;
+    bool bValid = false;
+};
@@ -9,6 +9,7 @@
 #include "SelectionManager.h"
 #include "USlateManager.h"
 #include <ObjManager.h>
+#include "DerivedDataCache.h"
 #include <roapi.h>
 
 #include "Source/Runtime/Debug/CrashHandler.h"
@@ -182,6 +183,12 @@ bool UEditorEngine::CreateMainWindow(HINSTANCE hInstance)
 
 bool UEditorEngine::Startup(HINSTANCE hInstance)
 {
+    // 정적 초기화로 등록된 클래스 계층에 번호 부여 (IsChildOf/Cast를 구간 비교로)
+    UClass::BuildClassTree();
+
+    // 워커 스레드 시작 (코어 수 - 1개, 게임 스레드는 대기 중에 태스크를 함께 실행)
+    FTaskSystem::Startup();
+
     LoadIniFile();
 
     if (!CreateMainWindow(hInstance))
@@ -230,6 +237,9 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
 
 void UEditorEngine::Tick(float DeltaSeconds)
 {
+    // 프레임 아레나 전환 (이번 프레임의 Tick/Render 임시 데이터)
+    FFrameArena::BeginFrame();
+
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
     
@@ -387,6 +397,12 @@ void UEditorEngine::Shutdown()
     RHIDevice.Release();
     
 
+    // 남은 태스크를 모두 실행한 뒤 워커 종료 (이후 Launch는 호출 스레드에서 바로 실행)
+    FTaskSystem::Shutdown();
+
+    // LRU 접근 순번 등 DDC 인덱스 변경분 기록
+    FDerivedDataCache::GetInstance().Flush();
+
     SaveIniFile();
 }
 
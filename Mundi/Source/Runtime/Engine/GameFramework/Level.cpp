@@ -11,6 +11,8 @@
 #include "AmbientLightComponent.h"
 #include "World.h"
 #include "JsonSerializer.h"
+#include "JsonReader.h"
+#include "CookedScene.h"
 
 static inline FString RemoveObjExtension(const FString& FileName)
 {
@@ -49,10 +51,8 @@ void ULevel::SpawnDefaultActors()
    
 }
 
-void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
+namespace
 {
-    Super::Serialize(bInIsLoading, InOutHandle);
-
     struct FPerspectiveCameraData
     {
         FVector Location;
@@ -61,76 +61,223 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         float NearClip;
         float FarClip;
     };
+}
 
-    if (bInIsLoading)
+void ULevel::LoadPerspectiveCamera(const JSON& InCameraJson)
+{
+    ACameraActor* CamActor = GWorld->GetEditorCameraActor();
+    FPerspectiveCameraData CamData;
+    if (CamActor)
     {
-        // 카메라 정보
-        JSON PerspectiveCameraData;
-        if (FJsonSerializer::ReadObject(InOutHandle, "PerspectiveCamera", PerspectiveCameraData))
+        // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
+        // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
+        FJsonSerializer::ReadVector(InCameraJson, "Location", CamData.Location);
+        FJsonSerializer::ReadVector(InCameraJson, "Rotation", CamData.Rotation);
+        FJsonSerializer::ReadArrayFloat(InCameraJson, "FOV", CamData.FOV);
+        FJsonSerializer::ReadArrayFloat(InCameraJson, "NearClip", CamData.NearClip);
+        FJsonSerializer::ReadArrayFloat(InCameraJson, "FarClip", CamData.FarClip);
+
+        CamActor->SetActorLocation(CamData.Location);
+        CamActor->SetRotationFromEulerAngles(CamData.Rotation);
+        if (auto* CamComp = CamActor->GetCameraComponent())
         {
-            // 카메라 정보
-            ACameraActor* CamActor = GWorld->GetEditorCameraActor();
-            FPerspectiveCameraData CamData;
-            if (CamActor)
-            {
-                // ReadObject 유틸리티 함수로 해당 뷰포트의 JSON 데이터를 안전하게 가져옴
-                // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
-                // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Location", CamData.Location);
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Rotation", CamData.Rotation);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FOV", CamData.FOV);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "NearClip", CamData.NearClip);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FarClip", CamData.FarClip);
-
-                CamActor->SetActorLocation(CamData.Location);
-                CamActor->SetRotationFromEulerAngles(CamData.Rotation);
-                if (auto* CamComp = CamActor->GetCameraComponent())
-                {
-                    CamComp->SetFOV(CamData.FOV);
-                    CamComp->SetClipPlanes(CamData.NearClip, CamData.FarClip);
-                }
-            }
+            CamComp->SetFOV(CamData.FOV);
+            CamComp->SetClipPlanes(CamData.NearClip, CamData.FarClip);
         }
+    }
+}
 
-        // Actors 정보
-        JSON ActorListJson;
-        if (FJsonSerializer::ReadObject(InOutHandle, "Actors", ActorListJson))
+AActor* ULevel::SpawnActorFromJson(JSON& InActorJson)
+{
+    FString TypeString;
+    FJsonSerializer::ReadString(InActorJson, "Type", TypeString);
+
+    //UClass* NewClass = FActorTypeMapper::TypeToActor(TypeString);
+    UClass* NewClass = UClass::FindClass(TypeString);
+
+    // 유효성 검사: Class가 유효하고 AActor를 상속했는지 확인
+    if (!NewClass || !NewClass->IsChildOf(AActor::StaticClass()))
+    {
+        UE_LOG("SpawnActor failed: Invalid class provided.");
+        return nullptr;
+    }
+
+    // ObjectFactory를 통해 UClass*로부터 객체 인스턴스 생성
+    AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(NewClass));
+    if (!NewActor)
+    {
+        UE_LOG("SpawnActor failed: ObjectFactory could not create an instance of");
+        return nullptr;
+    }
+
+    AddActor(NewActor);
+    NewActor->Serialize(true, InActorJson);
+    return NewActor;
+}
+
+void ULevel::DeleteActorsFrom(int32 FirstIndex)
+{
+    for (int32 Index = Actors.Num() - 1; Index >= FirstIndex; --Index)
+    {
+        ObjectFactory::DeleteObject(Actors[Index]);
+    }
+    Actors.SetNum(FirstIndex);
+}
+
+bool ULevel::LoadFromFile(const FWideString& InFilePath)
+{
+#ifdef USE_COOKED_SCENE
+    if (LoadFromCookedFile(InFilePath))
+    {
+        return true;
+    }
+#endif
+    return LoadFromJsonFile(InFilePath);
+}
+
+bool ULevel::LoadFromCookedFile(const FWideString& InFilePath)
+{
+    FCookedSceneReader Reader(InFilePath);
+    if (!Reader.IsValid())
+    {
+        return false;
+    }
+
+    // 로드 전부터 있던 액터(기본 라이트 등)는 실패해도 남김
+    const int32 NumActorsBefore = Actors.Num();
+
+    try
+    {
+        if (Reader.HasCamera())
         {
-            // ObjectRange()를 사용하여 Primitives 객체의 모든 키-값 쌍을 순회
-            for (auto& Pair : ActorListJson.ObjectRange())
+            JSON CameraJson;
+            Reader.ReadCamera(CameraJson);
+            LoadPerspectiveCamera(CameraJson);
+        }
+
+        for (uint32 i = 0; i < Reader.GetNumActors(); ++i)
+        {
+            JSON ActorDataJson;
+            Reader.ReadActor(ActorDataJson);
+            if (!SpawnActorFromJson(ActorDataJson))
             {
-                // Pair.first는 ID 문자열, Pair.second는 단일 프리미티브의 JSON 데이터입니다.
-                const FString& IdString = Pair.first;
-                JSON& ActorDataJson = Pair.second;
+                break;
+            }
+        }
+    }
+    catch (const std::exception& Exception)
+    {
+        UE_LOG("[warning] Level: 쿠킹된 씬 손상, JSON으로 다시 로드합니다: %s", Exception.what());
+        DeleteActorsFrom(NumActorsBefore);
+        return false;
+    }
+    return true;
+}
 
-                FString TypeString;
-                FJsonSerializer::ReadString(ActorDataJson, "Type", TypeString);
+bool ULevel::LoadFromJsonFile(const FWideString& InFilePath)
+{
+    FJsonReader Reader(InFilePath);
+    if (!Reader.IsValid() || Reader.Next() != EJsonToken::BeginObject)
+    {
+        return false;
+    }
+
+    static const FName PerspectiveCameraKey("PerspectiveCamera");
+    static const FName ActorsKey("Actors");
 
-                //UClass* NewClass = FActorTypeMapper::TypeToActor(TypeString);
-                UClass* NewClass = UClass::FindClass(TypeString);
+    // 파싱 실패 시 이 지점 이후에 추가된 액터만 되돌림
+    const int32 NumActorsBefore = Actors.Num();
 
-                UWorld* World = GWorld;
+#ifdef USE_COOKED_SCENE
+    // 읽는 김에 쿠킹 (Serialize가 JSON을 건드리기 전에 기록)
+    FCookedSceneWriter Cooker(InFilePath);
+#endif
 
-                // 유효성 검사: Class가 유효하고 AActor를 상속했는지 확인
-                if (!NewClass || !NewClass->IsChildOf(AActor::StaticClass()))
+    bool bStopSpawning = false;
+    while (Reader.Next() == EJsonToken::Key)
+    {
+        const FName Key = Reader.GetKeyName();
+        if (Key == PerspectiveCameraKey)
+        {
+            JSON CameraJson;
+            if (Reader.ReadValue(CameraJson))
+            {
+#ifdef USE_COOKED_SCENE
+                Cooker.WriteCamera(CameraJson);
+#endif
+                LoadPerspectiveCamera(CameraJson);
+            }
+        }
+        else if (Key == ActorsKey && Reader.Next() == EJsonToken::BeginObject)
+        {
+            // 키는 UUID 문자열 - 액터 하나씩 JSON을 만들고 역직렬화한 뒤 버림
+            while (Reader.Next() == EJsonToken::Key)
+            {
+                if (bStopSpawning)
                 {
-                    UE_LOG("SpawnActor failed: Invalid class provided.");
-                    return;
+                    Reader.SkipValue();
+                    continue;
                 }
 
-                // ObjectFactory를 통해 UClass*로부터 객체 인스턴스 생성
-                AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(NewClass));
-                if (!NewActor)
+                JSON ActorDataJson;
+                if (!Reader.ReadValue(ActorDataJson))
                 {
-                    UE_LOG("SpawnActor failed: ObjectFactory could not create an instance of");
-                    return;
+                    break;
                 }
+#ifdef USE_COOKED_SCENE
+                Cooker.WriteActor(ActorDataJson);
+#endif
+                // Serialize와 같이 잘못된 타입을 만나면 나머지 액터는 만들지 않음
+                bStopSpawning = SpawnActorFromJson(ActorDataJson) == nullptr;
+            }
+        }
+        else
+        {
+            Reader.SkipValue();
+        }
+    }
 
-                AddActor(NewActor);
+    if (Reader.HasError() || Reader.Next() != EJsonToken::None)
+    {
+        UE_LOG("[error] Level: 씬 파싱 실패: %s", Reader.GetErrorMessage().c_str());
+        DeleteActorsFrom(NumActorsBefore);
+        return false;
+    }
 
-                if (NewActor)
+#ifdef USE_COOKED_SCENE
+    // 중간에 멈췄으면 쿠킹 결과가 원본 전체를 담지 못하므로 쓰지 않음
+    if (!bStopSpawning)
+    {
+        Cooker.Finish();
+    }
+#endif
+    return true;
+}
+
+void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
+{
+    Super::Serialize(bInIsLoading, InOutHandle);
+
+    if (bInIsLoading)
+    {
+        // 카메라 정보
+        JSON PerspectiveCameraData;
+        if (FJsonSerializer::ReadObject(InOutHandle, "PerspectiveCamera", PerspectiveCameraData))
+        {
+            LoadPerspectiveCamera(PerspectiveCameraData);
+        }
+
+        // Actors 정보
+        JSON ActorListJson;
+        if (FJsonSerializer::ReadObject(InOutHandle, "Actors", ActorListJson))
+        {
+            // ObjectRange()를 사용하여 Primitives 객체의 모든 키-값 쌍을 순회
+            for (auto& Pair : ActorListJson.ObjectRange())
+            {
+                // Pair.first는 ID 문자열, Pair.second는 단일 프리미티브의 JSON 데이터입니다.
+                if (!SpawnActorFromJson(Pair.second))
                 {
-                    NewActor->Serialize(bInIsLoading, ActorDataJson);
+                    return;
                 }
             }
         }
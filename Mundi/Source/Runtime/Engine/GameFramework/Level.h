@@ -23,7 +23,25 @@ public:
     void Clear() { Actors.Empty(); }
 
     void Serialize(const bool bInIsLoading, JSON& InOutHandle);
+
+    /**
+     * .scene 파일 로드
+     * DDC에 최신 쿠킹 결과가 있으면 그것을, 없거나 오래됐으면 JSON을 스트리밍으로 읽고 다시 쿠킹합니다.
+     * 어느 쪽이든 액터 하나 분량의 JSON만 만들어 Serialize에 넘기고 바로 버립니다.
+     * 실패 시 이번 로드가 만든 액터만 지우고 false를 반환합니다. (로드 전부터 있던 액터는 유지)
+     */
+    bool LoadFromFile(const FWideString& InFilePath);
+
 private:
+    bool LoadFromJsonFile(const FWideString& InFilePath);
+    bool LoadFromCookedFile(const FWideString& InFilePath);
+    /** Actors[FirstIndex]부터 끝까지 삭제 (로드 실패 시 그 로드가 추가한 액터만 되돌림) */
+    void DeleteActorsFrom(int32 FirstIndex);
+
+    void LoadPerspectiveCamera(const JSON& InCameraJson);
+    /** "Type"으로 액터를 만들어 등록하고 역직렬화 (실패 시 nullptr) */
+    AActor* SpawnActorFromJson(JSON& InActorJson);
+
     TArray<AActor*> Actors;
 };
 
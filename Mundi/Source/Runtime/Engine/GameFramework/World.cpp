@@ -171,12 +171,7 @@ bool UWorld::TryLoadLastUsedLevel()
 	GWorld->GetSelectionManager()->ClearSelection();
 
 	std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-	JSON LevelJsonData;
-	if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, LastUsedLevelPath))
-	{
-		NewLevel->Serialize(true, LevelJsonData);
-	}
-	else
+	if (!NewLevel->LoadFromFile(LastUsedLevelPath))
 	{
 		UE_LOG("[error] MainToolbar: Failed To Load Level From: %s", LastUsedLevelPath.c_str());
 		return false;
@@ -191,13 +186,7 @@ bool UWorld::TryLoadLastUsedLevel()
 bool UWorld::LoadLevelFromFile(const FWideString& Path)
 {
 	std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-	JSON LevelJsonData;
-
-	if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, Path))
-	{
-		NewLevel->Serialize(true, LevelJsonData);
-	}
-	else
+	if (!NewLevel->LoadFromFile(Path))
 	{
 		UE_LOG("[error] MainToolbar: Failed To Load Level From: %s", Path.c_str());
 		return false;
@@ -244,7 +233,7 @@ void UWorld::Tick(float DeltaSeconds)
 	// Actor 별로 Dilation의 Duration을 처리하는 부분
 	if (!ActorTimingMap.IsEmpty())
 	{
-		TArray<TWeakObjectPtr<AActor>> ToRemove;
+		TArray<TWeakObjectPtr<AActor>, TInlineAllocator<16>> ToRemove;
 
 		for (auto& Pair : ActorTimingMap)
 		{
@@ -288,8 +277,9 @@ void UWorld::Tick(float DeltaSeconds)
 	if (Level)
 	{
 		// Tick 중에 새로운 actor가 추가될 수도 있어서 복사 후 호출
-		TArray<AActor*> LevelActors = Level->GetActors();
-		for (AActor* Actor : LevelActors)
+		const TArray<AActor*>& LevelActors = Level->GetActors();
+		TickActorSnapshot.assign(LevelActors.begin(), LevelActors.end());
+		for (AActor* Actor : TickActorSnapshot)
 		{
 			// 카메라 매니저 Tick은 마지막에
 			if (PlayerCameraManager == Actor)
@@ -350,6 +340,11 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 	//ULevel* NewLevel = ULevelService::CreateNewLevel();
 	UWorld* PIEWorld = NewObject<UWorld>(); // 레벨도 새로 생성됨
 	PIEWorld->Partition = std::make_unique<UWorldPartitionManager>();
+	if (UWorldPartitionManager* EditorPartition = InEditorWorld->GetPartitionManager())
+	{
+		// 액터 복사 전에 맞춰 두어 PIE 월드에서 다시 빌드하지 않도록 함
+		PIEWorld->Partition->SetBVHBuildMethod(EditorPartition->GetBVHBuildMethod());
+	}
 
 	// 물리 씬 초기화
 	PIEWorld->PhysScene = std::make_unique<FPhysScene>();
@@ -805,15 +800,6 @@ bool UWorld::TryMarkOverlapPair(const AActor* Actor, const AActor* B)
 		Pa = Pb;
 		Pb = Tmp;
 	}
-	uint64 Key1 = (uint64)Pa;
-	uint64 Key2 = (uint64)Pb;
-
-
-	uint64 Key = HashCombine(Key1, Key2);
-
-	if (FrameOverlapPairs.Contains(Key))
-		return false;
-
-	FrameOverlapPairs.Add(Key);
-	return true;
+	// 해시가 아닌 쌍 자체를 키로 저장 (해시 충돌로 다른 쌍의 오버랩이 누락되지 않도록)
+	return FrameOverlapPairs.insert({ Pa, Pb }).second;
 }
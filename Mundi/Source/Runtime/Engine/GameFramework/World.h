@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Object.h"
+#include "WeakObjectPtr.h"
 #include "Enums.h"
 #include "RenderSettings.h"
 #include "Level.h"
@@ -193,8 +194,11 @@ private:
     // Per-world selection manager
     std::unique_ptr<USelectionManager> SelectionMgr;
 
-    // Per-frame processed overlap pairs (A,B) keyed canonically
-    TSet<uint64> FrameOverlapPairs;
+    // Per-frame processed overlap pairs, keyed by the pointer-ordered (A,B) pair itself
+    TFlatSet<TPair<uintptr_t, uintptr_t>> FrameOverlapPairs;
+
+    // Tick 중 순회용 액터 목록 스냅샷 (매 프레임 재할당하지 않도록 용량을 재사용)
+    TArray<AActor*> TickActorSnapshot;
 
     //Timinig
     float UnscaledDelta;
@@ -205,3 +205,16 @@ void UWorldPartitionManager::ClearBVHierarchy()
 		BVH->Clear();
 	}
 }
+
+void UWorldPartitionManager::SetBVHBuildMethod(EBVHBuildMethod InMethod)
+{
+	if (BVH)
+	{
+		BVH->SetBuildMethod(InMethod);
+	}
+}
+
+EBVHBuildMethod UWorldPartitionManager::GetBVHBuildMethod() const
+{
+	return BVH ? BVH->GetBuildMethod() : EBVHBuildMethod::LBVH;
+}
@@ -5,44 +5,50 @@
 
 FParticleAsyncUpdater::~FParticleAsyncUpdater()
 {
-    if (TaskHandle.valid())
-    {
-        // 1. 작업이 끝날 때까지 기다림
-        TaskHandle.wait();
+    // 진행 중인 작업을 기다린 뒤, 아직 넘겨받지 않은 결과까지 정리 (안 하면 렌더 데이터 소멸자가 호출되지 않음)
+    DiscardPendingResult();
 
-        // 2. ★ 중요 ★ 결과물을 꺼내야 함!
-        // 이걸 안 하면 future 안에 들어있던 포인터 뭉치가 그냥 증발(Leak)함
-        FAsyncSimulationResult PendingResult = TaskHandle.get();
+    // 기존에 멤버변수로 들고 있던 데이터 삭제
+    InternalClearRenderData();
+}
 
-        // 3. 꺼낸 데이터(막 생성된 따끈따끈한 릭 유발자들)를 수동으로 삭제
-        for (FDynamicEmitterDataBase* Data : PendingResult.RenderData)
-        {
-            if (Data) delete Data;
-        }
-        PendingResult.RenderData.Empty();
-    }
+FParticleAsyncUpdater& FParticleAsyncUpdater::operator=(FParticleAsyncUpdater&& Other) noexcept
+{
+    if (this != &Other)
+    {
+        // 워커가 아직 PendingResult에 쓰고 있을 수 있으므로 먼저 끝낸 뒤 교체
+        DiscardPendingResult();
+        InternalClearRenderData();
 
-    // 4. 기존에 멤버변수로 들고 있던 데이터 삭제
-    InternalClearRenderData();
+        LastFrameStats = Other.LastFrameStats;
+        RenderData = std::move(Other.RenderData);
+        RenderDataPin = std::move(Other.RenderDataPin);
+        TaskHandle = std::move(Other.TaskHandle);
+        PendingResult = std::move(Other.PendingResult);
+    }
+    return *this;
 }
 
 void FParticleAsyncUpdater::KickOff(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext& Context)
 {
     if (IsBusy()) { return; }
     
-    if (TaskHandle.valid())
+    if (TaskHandle.IsValid())
     {
-        FAsyncSimulationResult Result = TaskHandle.get();
-        
         // 데이터 교체 (Swap)
-        InternalClearRenderData();
-        RenderData = std::move(Result.RenderData);
-        LastFrameStats = Result.Stats;
+        ApplyPendingResult();
+    }
+
+    if (!PendingResult)
+    {
+        PendingResult = std::make_unique<FAsyncSimulationResult>();
     }
     
-    TaskHandle = std::async(std::launch::async, [Instances, Context]() 
+    // 워커가 쓰는 렌더 데이터는 이번 프레임 아레나 버퍼에 생성 (결과를 교체할 때까지 고정)
+    FAsyncSimulationResult* Out = PendingResult.get();
+    TaskHandle = FTaskSystem::Launch([Out, Instances, Context, ArenaPin = FFrameArena::PinCurrentFrame()]() mutable
     {
-        return DoSimulationWork(Instances, Context);
+        *Out = DoSimulationWork(Instances, Context, std::move(ArenaPin));
     });
 }
 
@@ -53,9 +59,10 @@ void FParticleAsyncUpdater::KickOffSync(const TArray<FParticleEmitterInstance*>&
     {
         InternalClearRenderData();
     }
-    FAsyncSimulationResult Result = DoSimulationWork(Instances, Context);
+    FAsyncSimulationResult Result = DoSimulationWork(Instances, Context, FFrameArena::PinCurrentFrame());
     // 새 데이터로 교체
     RenderData = std::move(Result.RenderData);
+    RenderDataPin = std::move(Result.ArenaPin);
 
     // 통계 갱신
     LastFrameStats = Result.Stats;
@@ -63,10 +70,8 @@ void FParticleAsyncUpdater::KickOffSync(const TArray<FParticleEmitterInstance*>&
 
 void FParticleAsyncUpdater::EnsureCompletion()
 {
-    if (TaskHandle.valid())
-    {
-        TaskHandle.wait();
-    }
+    // 기다리는 동안 게임 스레드도 대기 중인 태스크를 실행
+    TaskHandle.Wait();
 }
 
 void FParticleAsyncUpdater::ResetStats()
@@ -82,20 +87,13 @@ void FParticleAsyncUpdater::Sync()
 
 bool FParticleAsyncUpdater::TrySync()
 {
-    if (!TaskHandle.valid()) return false;
+    if (!TaskHandle.IsValid()) return false;
 
     // 즉시 상태 확인
-    auto Status = TaskHandle.wait_for(std::chrono::seconds(0));
-    if (Status == std::future_status::ready)
+    if (TaskHandle.IsCompleted())
     {
-        // 작업 완료
-        FAsyncSimulationResult Result = TaskHandle.get();
-
-        // 데이터 교체
-        InternalClearRenderData();
-        RenderData = std::move(Result.RenderData);
-        LastFrameStats = Result.Stats;
-            
+        // 작업 완료 - 데이터 교체
+        ApplyPendingResult();
         return true;
     }
 
@@ -104,13 +102,15 @@ bool FParticleAsyncUpdater::TrySync()
 
 bool FParticleAsyncUpdater::IsBusy() const
 {
-    return TaskHandle.valid() && TaskHandle.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+    return TaskHandle.IsValid() && !TaskHandle.IsCompleted();
 }
 
-FAsyncSimulationResult FParticleAsyncUpdater::DoSimulationWork(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext Context)
+FAsyncSimulationResult FParticleAsyncUpdater::DoSimulationWork(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext Context, FFrameArenaPin ArenaPin)
 {
     TIME_PROFILE(Particle_Simulation)
+    FMemoryTagScope TagScope(EMemoryTag::Particles);
     FAsyncSimulationResult Result;
+    Result.ArenaPin = std::move(ArenaPin);
         
     // 통계 초기화
     Result.Stats.bAllEmittersComplete = true;
@@ -143,7 +143,7 @@ FAsyncSimulationResult FParticleAsyncUpdater::DoSimulationWork(const TArray<FPar
         }
 
         // 렌더 데이터 생성
-        FDynamicEmitterDataBase* EmitterData = Inst->CreateDynamicData();
+        FDynamicEmitterDataBase* EmitterData = Inst->CreateDynamicData(Result.ArenaPin);
         if (EmitterData)
         {
             EmitterData->EmitterIndex = Idx;
@@ -164,14 +164,44 @@ FAsyncSimulationResult FParticleAsyncUpdater::DoSimulationWork(const TArray<FPar
     return Result;
 }
 
+void FParticleAsyncUpdater::DestroyRenderData(TArray<FDynamicEmitterDataBase*>& InRenderData)
+{
+    // 프레임 아레나에 생성된 객체이므로 소멸자만 호출 (메모리는 핀이 풀린 뒤 버퍼 리셋 때 회수)
+    for (FDynamicEmitterDataBase* Data : InRenderData)
+    {
+        FFrameArena::Destroy(Data);
+    }
+    InRenderData.Empty();
+}
+
 void FParticleAsyncUpdater::InternalClearRenderData()
 {
-    for (FDynamicEmitterDataBase* Data : RenderData)
+    DestroyRenderData(RenderData);
+    RenderDataPin.Release();
+}
+
+void FParticleAsyncUpdater::ApplyPendingResult()
+{
+    TaskHandle.Wait();
+    TaskHandle.Reset();
+
+    InternalClearRenderData();
+    RenderData = std::move(PendingResult->RenderData);
+    PendingResult->RenderData.Empty();
+    RenderDataPin = std::move(PendingResult->ArenaPin);
+    LastFrameStats = PendingResult->Stats;
+}
+
+void FParticleAsyncUpdater::DiscardPendingResult()
+{
+    if (!TaskHandle.IsValid())
     {
-        if (Data)
-        {
-            delete Data;
-        }
+        return;
     }
-    RenderData.Empty();
+
+    TaskHandle.Wait();
+    TaskHandle.Reset();
+
+    DestroyRenderData(PendingResult->RenderData);
+    PendingResult->ArenaPin.Release();
 }
@@ -1,6 +1,7 @@
 ﻿#pragma once
-#include <future>
+#include <memory>
 
+#include "TaskSystem.h"
 #include "Source/Runtime/Engine/Particle/DynamicEmitterDataBase.h"
 
 struct FParticleFrameStats
@@ -12,8 +13,9 @@ struct FParticleFrameStats
 
 struct FAsyncSimulationResult
 {
-    // 렌더링 데이터
+    // 렌더링 데이터 (ArenaPin이 고정한 프레임 아레나 버퍼에 생성됨)
     TArray<FDynamicEmitterDataBase*> RenderData;
+    FFrameArenaPin ArenaPin;
     // 통계 데이터
     FParticleFrameStats Stats;
 };
@@ -23,7 +25,7 @@ class FParticleAsyncUpdater
 public:
     FParticleAsyncUpdater() = default;
 
-    // TaskHandle(std::future)은 복사할 수 없으므로, 그냥 빈 상태로 초기화
+    // 진행 중인 작업은 복사할 수 없으므로, 그냥 빈 상태로 초기화
     FParticleAsyncUpdater(const FParticleAsyncUpdater& Other)
     {
         LastFrameStats = FParticleFrameStats();
@@ -33,7 +35,7 @@ public:
     {
         if (this != &Other)
         {
-            if (TaskHandle.valid()) TaskHandle.wait();
+            DiscardPendingResult();
             InternalClearRenderData();
             LastFrameStats = FParticleFrameStats();
         }
@@ -41,13 +43,15 @@ public:
     }
 
     FParticleAsyncUpdater(FParticleAsyncUpdater&&) = default;
-    FParticleAsyncUpdater& operator=(FParticleAsyncUpdater&&) = default;
+    FParticleAsyncUpdater& operator=(FParticleAsyncUpdater&& Other) noexcept;
     ~FParticleAsyncUpdater();
     
     // [Main Thread 읽기 전용] 이전 프레임의 통계 캐시
     FParticleFrameStats LastFrameStats;
     // [Main Thread 읽기 전용] 렌더링 데이터
     TArray<FDynamicEmitterDataBase*> RenderData;
+    // RenderData가 들어 있는 프레임 아레나 버퍼 (교체될 때까지 리셋 방지)
+    FFrameArenaPin RenderDataPin;
 
     // 작업 시작
     void KickOff(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext& Context);
@@ -63,8 +67,16 @@ public:
     bool IsBusy() const;
 
 private:
-    static FAsyncSimulationResult DoSimulationWork(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext Context);
+    static FAsyncSimulationResult DoSimulationWork(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext Context, FFrameArenaPin ArenaPin);
+    static void DestroyRenderData(TArray<FDynamicEmitterDataBase*>& InRenderData);
     void InternalClearRenderData();
-    // 비동기 작업 핸들
-    std::future<FAsyncSimulationResult> TaskHandle;
+    // 끝난 작업의 결과를 RenderData로 교체
+    void ApplyPendingResult();
+    // 작업을 기다린 뒤 결과를 버림
+    void DiscardPendingResult();
+
+    // 태스크 시스템 작업 핸들
+    FTaskHandle TaskHandle;
+    // 워커가 결과를 쓰는 곳 (업데이터가 이동해도 주소가 바뀌지 않도록 힙에 두고 재사용)
+    std::unique_ptr<FAsyncSimulationResult> PendingResult;
 };
\ No newline at end of file
@@ -60,6 +60,6 @@ struct FParticleSimulationContext
     int32 CurrentLODIndex;
 
     // 충돌 정보
-    TArray<FColliderProxy> WorldColliders; // 이번 프레임 월드에 있는 충돌체 정보
+    TArray<FColliderProxy, FFrameArenaAllocator> WorldColliders; // 이번 프레임 월드에 있는 충돌체 정보 (프레임 아레나)
     TArray<FParticleEventData> EventData; // 이번 프레임 발생한 이벤트 정보들
 };
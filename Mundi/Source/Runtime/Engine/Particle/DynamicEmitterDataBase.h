@@ -3,6 +3,7 @@
 #include "ParticleDataContainer.h"
 #include "ParticleHelper.h"
 #include "Modules/ParticleModuleRequired.h"
+#include "ParallelAlgorithms.h"
 
 struct FDynamicEmitterReplayDataBase
 {
@@ -199,11 +200,11 @@ struct FDynamicTranslucentEmitterDataBase : public FDynamicEmitterDataBase
             }
         }
 
-        // 5) Back-to-front (큰 키가 먼저)
-        OutIndices.Sort([this](int32 A, int32 B)
+        // 5) Back-to-front (큰 키가 먼저) - 실수 키 기수 정렬
+        ParallelRadixSort(OutIndices, [this](int32 Index)
             {
-                return CachedSortKeys[A] > CachedSortKeys[B];
-            });
+                return CachedSortKeys[Index];
+            }, ESortOrder::Descending);
     }
 };
 
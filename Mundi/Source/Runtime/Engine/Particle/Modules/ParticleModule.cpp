@@ -1,4 +1,16 @@
 ﻿#include "pch.h"
 #include "ParticleModule.h"
+#include "FastMath.h"
 
 IMPLEMENT_CLASS(UParticleModule)
+
+void UParticleModule::SinCos(float Angle, float& OutSin, float& OutCos) const
+{
+    if (bUseFastMath)
+    {
+        FMath::FastSinCos(Angle, OutSin, OutCos);
+        return;
+    }
+    OutSin = sinf(Angle);
+    OutCos = cosf(Angle);
+}
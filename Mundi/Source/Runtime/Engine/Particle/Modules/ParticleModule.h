@@ -103,6 +103,12 @@ public:
     bool  bEnabled = true;
     int32 SortPriority = 0;
 
+    // 삼각 함수를 FMath::Fast* 근사로 계산 (오차 ~3e-7, 위치/방향을 무작위로 뽑는 모듈만 반영)
+    bool  bUseFastMath = false;
+
+    // bUseFastMath에 따라 FMath::FastSinCos 또는 sinf/cosf
+    void SinCos(float Angle, float& OutSin, float& OutCos) const;
+
     // payload가 필요한 모듈이면 바이트 수를 정의
     virtual int32 GetRequiredBytesPerParticle() const { return 0; }
 
@@ -18,7 +18,7 @@ void UParticleModuleCollision::UpdateAsync(FParticleEmitterInstance* Owner, int3
 {
     if (!bEnabled || !Owner || Context.WorldColliders.IsEmpty()) { return; }
 
-    const TArray<FColliderProxy>& Colliders = Context.WorldColliders;
+    const TArray<FColliderProxy, FFrameArenaAllocator>& Colliders = Context.WorldColliders;
 
     BEGIN_UPDATE_LOOP
     {
@@ -42,9 +42,13 @@ void UParticleModuleLocation::SpawnAsync(FParticleEmitterInstance* Owner, int32
             float Pi = Owner->GetRandomFloat() * PI;
             float R = Owner->GetRandomFloat() * SphereRadius;
 
-            LocalOffset.X = R * sinf(Pi) * cosf(Theta);
-            LocalOffset.Y = R * sinf(Pi) * sinf(Theta);
-            LocalOffset.Z = R * cosf(Pi);
+            float SinTheta, CosTheta, SinPi, CosPi;
+            SinCos(Theta, SinTheta, CosTheta);
+            SinCos(Pi, SinPi, CosPi);
+
+            LocalOffset.X = R * SinPi * CosTheta;
+            LocalOffset.Y = R * SinPi * SinTheta;
+            LocalOffset.Z = R * CosPi;
 
             LocalOffset += StartLocation.GetValue(0.0f);
         }
@@ -56,8 +60,10 @@ void UParticleModuleLocation::SpawnAsync(FParticleEmitterInstance* Owner, int32
             float Radius = Owner->GetRandomFloat() * CylinderRadius;
             float Height = (Owner->GetRandomFloat() * 2.0f - 1.0f) * CylinderHeight * 0.5f;
 
-            LocalOffset.X = Radius * cosf(Angle);
-            LocalOffset.Y = Radius * sinf(Angle);
+            float SinAngle, CosAngle;
+            SinCos(Angle, SinAngle, CosAngle);
+            LocalOffset.X = Radius * CosAngle;
+            LocalOffset.Y = Radius * SinAngle;
             LocalOffset.Z = Height;
 
             LocalOffset += StartLocation.GetValue(0.0f);
@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "ParticleModuleVelocityCone.h"
+#include "FastMath.h"
 #include "../ParticleEmitterInstance.h"
 #include "Source/Runtime/Engine/Particle/ParticleHelper.h"
 #include "Source/Runtime/Engine/Components/ParticleSystemComponent.h"
@@ -27,7 +28,7 @@ void UParticleModuleVelocityCone::Spawn(FParticleEmitterInstance* Owner, int32 O
     float ConeHalfAngleRad = DegreesToRadians(ConeAngleDeg);
     
     // Z값(높이)을 랜덤으로 뽑아야 표면적이 균등해짐.
-    float CosAngle = cos(ConeHalfAngleRad);
+    float CosAngle = bUseFastMath ? FMath::FastCos(ConeHalfAngleRad) : cosf(ConeHalfAngleRad);
     
     // 1.0(꼭대기) ~ CosAngle(바닥) 사이의 랜덤 높이
     float Z = FMath::Lerp(CosAngle, 1.0f, Owner->GetRandomFloat());
@@ -38,8 +39,10 @@ void UParticleModuleVelocityCone::Spawn(FParticleEmitterInstance* Owner, int32 O
 
     // 로컬 공간(Z-Up)에서의 랜덤 방향 벡터
     FVector LocalDir;
-    LocalDir.X = R * cos(Pi);
-    LocalDir.Y = R * sin(Pi);
+    float SinPi, CosPi;
+    SinCos(Pi, SinPi, CosPi);
+    LocalDir.X = R * CosPi;
+    LocalDir.Y = R * SinPi;
     LocalDir.Z = Z;
     
     FQuat Rot = FQuat::FindBetweenNormals({0,0,1}, Dir);
@@ -14,8 +14,10 @@ struct FParticleDataContainer
     uint8* RawBlock = nullptr;
     uint8* ParticleData = nullptr; // 힙에 할당한 메모리 블록을 가리킨다.
     uint16* ParticleIndices = nullptr; // not allocated, this is at the end of the memory block
+    bool bFrameArenaBlock = false; // 프레임 아레나 메모리면 Free에서 해제하지 않음 (버퍼 리셋 때 회수)
 
-    void Allocate(int32 InParticleBytes, int32 InIndexCount)
+    /** Arena를 넘기면 고정된 프레임 아레나 버퍼에서 할당 */
+    void Allocate(int32 InParticleBytes, int32 InIndexCount, const FFrameArenaPin* Arena = nullptr)
     {
         Free();
 
@@ -25,7 +27,10 @@ struct FParticleDataContainer
 
         MemBlockSize = ParticleSection + IndexSection;
 
-        RawBlock = static_cast<uint8*>(FMemoryManager::Allocate(MemBlockSize, Alignment));
+        bFrameArenaBlock = Arena && Arena->IsValid();
+        RawBlock = static_cast<uint8*>(bFrameArenaBlock
+            ? Arena->Allocate(MemBlockSize, Alignment)
+            : FMemoryManager::Allocate(MemBlockSize, Alignment));
         ParticleDataNumBytes = InParticleBytes;
         ParticleIndicesNumShorts = static_cast<int32>(InIndexCount);
 
@@ -37,10 +42,14 @@ struct FParticleDataContainer
     {
         if (RawBlock)
         {
-            FMemoryManager::Deallocate(RawBlock);
+            if (!bFrameArenaBlock)
+            {
+                FMemoryManager::Deallocate(RawBlock);
+            }
             RawBlock = ParticleData = nullptr;
             ParticleIndices = nullptr;
         }
+        bFrameArenaBlock = false;
         ParticleDataNumBytes = 0;
         ParticleIndicesNumShorts = 0;
         MemBlockSize = 0;
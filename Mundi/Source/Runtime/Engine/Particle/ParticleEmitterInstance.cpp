@@ -85,6 +85,7 @@ void FParticleEmitterInstance::InitializeParticleMemory()
 
     UE_LOG("[InitializeParticleMemory] After FreeParticleMemory, restored MaxActiveParticles to: %d", MaxActiveParticles);
 
+    FMemoryTagScope TagScope(EMemoryTag::Particles);
     constexpr SIZE_T Alignment = 16;
     const SIZE_T DataSize = static_cast<SIZE_T>(MaxActiveParticles * ParticleStride);
     const SIZE_T IndicesSize = MaxActiveParticles * sizeof(uint16);
@@ -493,7 +494,7 @@ void FParticleEmitterInstance::UpdateModuleCache()
     }
 }
 
-FDynamicEmitterDataBase* FParticleEmitterInstance::CreateDynamicData()
+FDynamicEmitterDataBase* FParticleEmitterInstance::CreateDynamicData(const FFrameArenaPin& Arena)
 {
     if (ActiveParticles <= 0) return nullptr;
 
@@ -502,7 +503,7 @@ FDynamicEmitterDataBase* FParticleEmitterInstance::CreateDynamicData()
 
     if (Type == EParticleType::Sprite)
     {
-        auto* SpriteData = new FDynamicSpriteEmitterData();
+        auto* SpriteData = Arena.New<FDynamicSpriteEmitterData>();
         SpriteData->EmitterType = Type;
         SpriteData->SortMode = CachedRequiredModule->SortMode;
         SpriteData->Alignment = CachedRequiredModule->ScreenAlignment;
@@ -510,19 +511,19 @@ FDynamicEmitterDataBase* FParticleEmitterInstance::CreateDynamicData()
         SpriteData->bUseLocalSpace = CachedRequiredModule->bUseLocalSpace;
         
         // 데이터 채우기 (Memcpy)
-        BuildReplayData(SpriteData->Source);
+        BuildReplayData(SpriteData->Source, Arena);
         NewData = SpriteData;
     }
     else if (Type == EParticleType::Mesh)
     {
-        auto* MeshData = new FDynamicMeshEmitterData();
+        auto* MeshData = Arena.New<FDynamicMeshEmitterData>();
         MeshData->EmitterType = Type;
         MeshData->SortMode = CachedRequiredModule->SortMode;
         MeshData->Alignment = CachedRequiredModule->ScreenAlignment;
         MeshData->SortPriority = 0;
 
         // 데이터 채우기
-        BuildReplayData(MeshData->Source);
+        BuildReplayData(MeshData->Source, Arena);
 
         if (MeshData->Source.Mesh)
         {
@@ -530,28 +531,28 @@ FDynamicEmitterDataBase* FParticleEmitterInstance::CreateDynamicData()
         }
         else
         {
-            delete MeshData;
+            FFrameArena::Destroy(MeshData);
             NewData = nullptr;
         }
     }
     else if (Type == EParticleType::Beam)
     {
-        auto* BeamData = new FDynamicBeamEmitterData();
+        auto* BeamData = Arena.New<FDynamicBeamEmitterData>();
         BeamData->EmitterType = Type;
         BeamData->SortMode = CachedRequiredModule->SortMode;
         BeamData->SortPriority = 0;
         BeamData->bUseLocalSpace = CachedRequiredModule->bUseLocalSpace;
-        BuildReplayData(BeamData->Source);
+        BuildReplayData(BeamData->Source, Arena);
         NewData = BeamData;
     }
     else if (Type == EParticleType::Ribbon)
     {
         // RIBBON
-        auto* RibbonData = new FDynamicRibbonEmitterData();
+        auto* RibbonData = Arena.New<FDynamicRibbonEmitterData>();
         RibbonData->EmitterType = Type;
 
         // 데이터 채우기
-        BuildReplayData(RibbonData->Source);
+        BuildReplayData(RibbonData->Source, Arena);
         
         NewData = RibbonData;
     }
@@ -559,7 +560,7 @@ FDynamicEmitterDataBase* FParticleEmitterInstance::CreateDynamicData()
     return NewData;
 }
 
-void FParticleEmitterInstance::BuildReplayData(FDynamicEmitterReplayDataBase& OutData)
+void FParticleEmitterInstance::BuildReplayData(FDynamicEmitterReplayDataBase& OutData, const FFrameArenaPin& Arena)
 { 
     if (ActiveParticles <= 0 || !ParticleData)
     {
@@ -578,7 +579,7 @@ void FParticleEmitterInstance::BuildReplayData(FDynamicEmitterReplayDataBase& Ou
     const int32 ParticleBytes = ActiveParticles * ParticleStride;
     const int32 IndexCount = ActiveParticles;  // 논리적으로 살아있는 파티클 수만
 
-    OutData.DataContainer.Allocate(ParticleBytes, IndexCount);
+    OutData.DataContainer.Allocate(ParticleBytes, IndexCount, &Arena);
 
     // Data Container 재할당
     std::memcpy(
@@ -102,8 +102,9 @@ struct FParticleEmitterInstance
     /** LOD에 따른 모듈 캐싱 업데이트 */
     void UpdateModuleCache();
 
-    struct FDynamicEmitterDataBase* CreateDynamicData();
-    void BuildReplayData(FDynamicEmitterReplayDataBase& OutData);
+    /** 렌더 데이터는 Arena(고정된 프레임 아레나 버퍼)에 생성, 해제는 FFrameArena::Destroy */
+    struct FDynamicEmitterDataBase* CreateDynamicData(const FFrameArenaPin& Arena);
+    void BuildReplayData(FDynamicEmitterReplayDataBase& OutData, const FFrameArenaPin& Arena);
 
     void InitializeRibbonState();
     void UpdateRibbonTrailDistances();
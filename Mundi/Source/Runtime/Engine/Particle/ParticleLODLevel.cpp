@@ -732,6 +732,7 @@ void UParticleLODLevel::ParseAndAddModule(JSON& ModuleJson)
     if (NewModule)
     {
         FJsonSerializer::ReadBool(ModuleJson, "bEnabled", NewModule->bEnabled, true);
+        FJsonSerializer::ReadBool(ModuleJson, "bUseFastMath", NewModule->bUseFastMath, false, false);
     }
 }
 
@@ -741,6 +742,7 @@ JSON UParticleLODLevel::SerializeModule(UParticleModule* Module)
 
     JSON ModuleJson = JSON::Make(JSON::Class::Object);
     ModuleJson["bEnabled"] = Module->bEnabled;
+    ModuleJson["bUseFastMath"] = Module->bUseFastMath;
 
     // 모듈 타입 판별 및 저장
     if (auto* Lifetime = Cast<UParticleModuleLifetime>(Module))
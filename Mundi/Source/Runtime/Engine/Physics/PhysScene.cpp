@@ -101,8 +101,20 @@ const char* FPhysXCustomErrorCallback::GetErrorTypeString(PxErrorCode::Enum code
     }
 }
 
+void* FPhysXTrackedAllocator::allocate(size_t size, const char* typeName, const char* filename, int line)
+{
+    // PhysX는 16바이트 정렬을 요구 (FMemoryManager 기본 정렬과 동일)
+    FMemoryTagScope TagScope(EMemoryTag::Physics);
+    return FMemoryManager::Allocate(size, 16);
+}
+
+void FPhysXTrackedAllocator::deallocate(void* ptr)
+{
+    FMemoryManager::Deallocate(ptr);
+}
+
 // ===== FPhysXSharedResources Static Members =====
-PxDefaultAllocator FPhysXSharedResources::Allocator;
+FPhysXTrackedAllocator FPhysXSharedResources::Allocator;
 FPhysXCustomErrorCallback FPhysXSharedResources::ErrorCallback;  // 커스텀 에러 콜백 사용
 FPhysXAssertHandler FPhysXSharedResources::AssertHandler;
 PxFoundation* FPhysXSharedResources::Foundation = nullptr;
@@ -59,6 +59,14 @@ public:
     }
 };
 
+/** PhysX 할당을 FMemoryManager로 보내 Physics 메모리 태그로 집계하는 할당자 */
+class FPhysXTrackedAllocator : public PxAllocatorCallback
+{
+public:
+    virtual void* allocate(size_t size, const char* typeName, const char* filename, int line) override;
+    virtual void deallocate(void* ptr) override;
+};
+
 /**
  * @brief PhysX 에러 콜백을 UE_LOG로 출력하는 커스텀 에러 핸들러
  * 
@@ -102,7 +110,7 @@ public:
     static void ReleaseVehicleBatchQuery(PxBatchQuery* BatchQuery);
 
 private:
-    static PxDefaultAllocator Allocator;
+    static FPhysXTrackedAllocator Allocator;
     static FPhysXCustomErrorCallback ErrorCallback;  // 커스텀 에러 콜백 사용
     static FPhysXAssertHandler AssertHandler;
     static PxFoundation* Foundation;
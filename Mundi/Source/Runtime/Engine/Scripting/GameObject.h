@@ -43,7 +43,7 @@ public:
     }
 
     void SetOwner(AActor* NewOwner) { Owner = NewOwner; }
-    AActor* GetOwner() { return Owner; }
+    AActor* GetOwner() const { return Owner; }
 
     // Returns the owner's current forward direction (unit vector)
     FVector GetForward() { return Owner ? Owner->GetActorRight() : FVector(0, 0, 0); }
@@ -22,8 +22,9 @@ static void AddMethod(sol::table& T, const char* Name, void(C::*Method)(P...))
 {
     T.set_function(Name, [Method](LuaComponentProxy& Proxy, P... Args)
     {
-        if (!Proxy.Instance || Proxy.Class != C::StaticClass()) return;
-        (static_cast<C*>(Proxy.Instance)->*Method)(std::forward<P>(Args)...);
+        UObject* Instance = Proxy.Instance.Get();
+        if (!Instance || Proxy.Class != C::StaticClass()) return;
+        (static_cast<C*>(Instance)->*Method)(std::forward<P>(Args)...);
     });
 }
 
@@ -33,11 +34,12 @@ static void AddMethodR(sol::table& T, const char* Name, R(C::*Method)(P...))
 {
     T.set_function(Name, [Method](LuaComponentProxy& Proxy, P... Args) -> R
     {
-        if (!Proxy.Instance || Proxy.Class != C::StaticClass())
+        UObject* Instance = Proxy.Instance.Get();
+        if (!Instance || Proxy.Class != C::StaticClass())
         {
             if constexpr (!std::is_void_v<R>) return R{};
         }
-        return (static_cast<C*>(Proxy.Instance)->*Method)(std::forward<P>(Args)...);
+        return (static_cast<C*>(Instance)->*Method)(std::forward<P>(Args)...);
     });
 }
 
@@ -47,11 +49,12 @@ static void AddMethodR(sol::table& T, const char* Name, R(C::*Method)(P...) cons
 {
     T.set_function(Name, [Method](LuaComponentProxy& Proxy, P... Args) -> R
     {
-        if (!Proxy.Instance || Proxy.Class != C::StaticClass())
+        UObject* Instance = Proxy.Instance.Get();
+        if (!Instance || Proxy.Class != C::StaticClass())
         {
             if constexpr (!std::is_void_v<R>) return R{};
         }
-        return (static_cast<const C*>(Proxy.Instance)->*Method)(std::forward<P>(Args)...);
+        return (static_cast<const C*>(Instance)->*Method)(std::forward<P>(Args)...);
     });
 }
 
@@ -24,7 +24,8 @@ void BuildBoundClass(UClass* Class)
 
 sol::object LuaComponentProxy::Index(sol::this_state LuaState, LuaComponentProxy& Self, const char* Key)
 {
-    if (!Self.Instance) return sol::nil;
+    UObject* Instance = Self.Instance.Get();
+    if (!Instance) return sol::nil;
     sol::state_view LuaView(LuaState);
 
     BuildBoundClass(Self.Class);
@@ -45,16 +46,19 @@ sol::object LuaComponentProxy::Index(sol::this_state LuaState, LuaComponentProxy
     const FProperty* Property = ItProp->second.Property;
     switch (Property->Type)
     {
-    case EPropertyType::Float:   return sol::make_object(LuaView, *Property->GetValuePtr<float>(Self.Instance));
-    case EPropertyType::Int32:   return sol::make_object(LuaView, *Property->GetValuePtr<int>(Self.Instance));
-    case EPropertyType::FString: return sol::make_object(LuaView, *Property->GetValuePtr<FString>(Self.Instance));
-    case EPropertyType::FVector: return sol::make_object(LuaView, *Property->GetValuePtr<FVector>(Self.Instance));
+    case EPropertyType::Float:   return sol::make_object(LuaView, *Property->GetValuePtr<float>(Instance));
+    case EPropertyType::Int32:   return sol::make_object(LuaView, *Property->GetValuePtr<int>(Instance));
+    case EPropertyType::FString: return sol::make_object(LuaView, *Property->GetValuePtr<FString>(Instance));
+    case EPropertyType::FVector: return sol::make_object(LuaView, *Property->GetValuePtr<FVector>(Instance));
     default: return sol::nil;
     }
 }
 
 void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::object Obj)
 {
+    UObject* Instance = Self.Instance.Get();
+    if (!Instance) return;
+
     auto IterateClass = GBoundClasses.find(Self.Class);
     if (IterateClass == GBoundClasses.end()) return;
 
@@ -67,20 +71,20 @@ void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::
     {
     case EPropertyType::Float:
         if (Obj.get_type() == sol::type::number)
-            *Property->GetValuePtr<float>(Self.Instance) = static_cast<float>(Obj.as<double>());
+            *Property->GetValuePtr<float>(Instance) = static_cast<float>(Obj.as<double>());
         break;
     case EPropertyType::Int32:
         if (Obj.get_type() == sol::type::number)
-            *Property->GetValuePtr<int>(Self.Instance) = static_cast<int>(Obj.as<double>());
+            *Property->GetValuePtr<int>(Instance) = static_cast<int>(Obj.as<double>());
         break;
     case EPropertyType::FString:
         if (Obj.get_type() == sol::type::string)
-            *Property->GetValuePtr<FString>(Self.Instance) = Obj.as<FString>();
+            *Property->GetValuePtr<FString>(Instance) = Obj.as<FString>();
         break;
     case EPropertyType::FVector:
         if (Obj.is<FVector>())
         {
-            *Property->GetValuePtr<FVector>(Self.Instance) = Obj.as<FVector>();
+            *Property->GetValuePtr<FVector>(Instance) = Obj.as<FVector>();
         }
         else if (Obj.get_type() == sol::type::table)
         {
@@ -90,7 +94,7 @@ void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::
                 static_cast<float>(t.get_or("Y", 0.0)),
                 static_cast<float>(t.get_or("Z", 0.0))
             };
-            *Property->GetValuePtr<FVector>(Self.Instance) = tmp;
+            *Property->GetValuePtr<FVector>(Instance) = tmp;
         }
         break;
     default:
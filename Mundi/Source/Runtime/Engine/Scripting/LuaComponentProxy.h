@@ -4,6 +4,7 @@
 #include <sol/sol.hpp>
 
 #include "LuaBindingRegistry.h"
+#include "WeakObjectPtr.h"
 
 struct FBoundProp
 {
@@ -22,7 +23,8 @@ void BuildBoundClass(UClass* Class);
 
 struct LuaComponentProxy
 {
-    void* Instance = nullptr;
+    // 컴포넌트가 삭제되면 Get()이 nullptr - Lua가 프록시를 계속 들고 있어도 안전
+    TWeakObjectPtr<UObject> Instance;
     UClass* Class = nullptr;
 
     static sol::object Index(sol::this_state LuaState, LuaComponentProxy& Self, const char* Key);
@@ -19,17 +19,49 @@
 #include "Pawn.h"
 #include <tuple>
 
-sol::object MakeCompProxy(sol::state_view SolState, void* Instance, UClass* Class) {
+namespace
+{
+    /** Lua 할당을 FMemoryManager로 보내 Lua 메모리 태그로 집계 (lua_Alloc 규약) */
+    void* LuaTrackedAlloc(void* UserData, void* Ptr, size_t OldSize, size_t NewSize)
+    {
+        if (NewSize == 0)
+        {
+            FMemoryManager::Deallocate(Ptr);
+            return nullptr;
+        }
+
+        // 축소나 같은 크기 클래스 안에서의 확장은 블록을 그대로 사용 (Lua는 축소 요청이 실패하지 않는다고 가정)
+        if (Ptr && NewSize <= FMemoryManager::GetUsableSize(Ptr))
+        {
+            return Ptr;
+        }
+
+        FMemoryTagScope TagScope(EMemoryTag::Lua);
+        void* NewPtr = FMemoryManager::Allocate(NewSize, 16);
+        if (!NewPtr)
+        {
+            return nullptr;
+        }
+        if (Ptr)
+        {
+            std::memcpy(NewPtr, Ptr, OldSize < NewSize ? OldSize : NewSize);
+            FMemoryManager::Deallocate(Ptr);
+        }
+        return NewPtr;
+    }
+}
+
+sol::object MakeCompProxy(sol::state_view SolState, UObject* Instance, UClass* Class) {
     BuildBoundClass(Class);
     LuaComponentProxy Proxy;
-    Proxy.Instance = Instance;
+    Proxy.Instance = TWeakObjectPtr<UObject>(Instance);
     Proxy.Class = Class;
     return sol::make_object(SolState, std::move(Proxy));
 }
 
 FLuaManager::FLuaManager()
 {
-    Lua = new sol::state();
+    Lua = new sol::state(sol::default_at_panic, &LuaTrackedAlloc);
 
     // 랜덤 시드 초기화
     srand(static_cast<uint32>(time(nullptr)));
@@ -214,15 +246,11 @@ FLuaManager::FLuaManager()
     SharedLib.set_function("DeleteObject", sol::overload(
         [](const FGameObject& GameObject)
         {
-            for (TObjectIterator<AActor> It; It; ++It)
+            // FGameObject는 소유 액터와 1대1 - 전체 객체를 훑지 않고 바로 찾음
+            AActor* Actor = GameObject.GetOwner();
+            if (Actor && Actor->UUID == GameObject.UUID)
             {
-                AActor* Actor = *It;
-
-                if (Actor->UUID == GameObject.UUID)
-                {
-                    Actor->Destroy();   // 지연 삭제 요청 (즉시 삭제하면 터짐)
-                    break;
-                }
+                Actor->Destroy();   // 지연 삭제 요청 (즉시 삭제하면 터짐)
             }
         }
     ));
@@ -694,7 +722,7 @@ void FLuaManager::ExposeAllComponentsToLua()
             LuaComponentProxy& Proxy = Obj.as<LuaComponentProxy>();
 
             // Check if Instance and Class are valid
-            if (!Proxy.Instance || !Proxy.Class) {
+            if (!Proxy.Instance.IsValid() || !Proxy.Class) {
                 return sol::make_object(*Lua, sol::nil);
             }
 
@@ -705,7 +733,7 @@ void FLuaManager::ExposeAllComponentsToLua()
             }
 
             // Cast to SkeletalMeshComponent and get AnimInstance
-            USkeletalMeshComponent* SkelMeshComp = static_cast<USkeletalMeshComponent*>(Proxy.Instance);
+            USkeletalMeshComponent* SkelMeshComp = static_cast<USkeletalMeshComponent*>(Proxy.Instance.Get());
             UAnimInstance* AnimInstance = SkelMeshComp->GetAnimInstance();
 
             if (!AnimInstance) {
@@ -842,10 +870,10 @@ void FLuaManager::ExposeGlobalFunctions()
         "SetViewTarget", [](APlayerCameraManager* self, LuaComponentProxy& Proxy)
         {
             // 타입 안정성 확인
-            if (self && Proxy.Instance && Proxy.Class == UCameraComponent::StaticClass())
+            if (self && Proxy.Instance.IsValid() && Proxy.Class == UCameraComponent::StaticClass())
             {
                 // 프록시에서 실제 컴포넌트 포인터 추출
-                auto* CameraComp = static_cast<UCameraComponent*>(Proxy.Instance);
+                auto* CameraComp = static_cast<UCameraComponent*>(Proxy.Instance.Get());
                 self->SetViewCamera(CameraComp);
             }
         },
@@ -853,10 +881,10 @@ void FLuaManager::ExposeGlobalFunctions()
         "SetViewTargetWithBlend", [](APlayerCameraManager* self, LuaComponentProxy& Proxy, float InBlendTime)
         {
             // 타입 안정성 확인
-            if (self && Proxy.Instance && Proxy.Class == UCameraComponent::StaticClass())
+            if (self && Proxy.Instance.IsValid() && Proxy.Class == UCameraComponent::StaticClass())
             {
                 // 프록시에서 실제 컴포넌트 포인터 추출
-                auto* CameraComp = static_cast<UCameraComponent*>(Proxy.Instance);
+                auto* CameraComp = static_cast<UCameraComponent*>(Proxy.Instance.Get());
                 self->SetViewCameraWithBlend(CameraComp, InBlendTime);
             }
         },
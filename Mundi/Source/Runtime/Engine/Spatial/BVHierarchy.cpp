@@ -10,6 +10,7 @@
 #include "Vector.h"
 #include "OBB.h"
 #include "Frustum.h"
+#include "ParallelAlgorithms.h"
 #include "Picking.h" // FRay
 
 #include "StaticMeshComponent.h"
@@ -45,6 +46,17 @@ namespace {
         outTMax = tmax;
         return true;
     }
+
+    inline float SurfaceArea(const FAABB& Box)
+    {
+        const FVector D = Box.Max - Box.Min;
+        return 2.0f * (D.X * D.Y + D.Y * D.Z + D.Z * D.X);
+    }
+
+    // Binned SAH 설정 (큰 구간은 빈을 늘려 분할 후보를 촘촘하게)
+    constexpr int32 SAHMinBins = 16;
+    constexpr int32 SAHMaxBins = 32;
+    constexpr int32 SAHSubtreeSize = 1024;  // 이 개수 이하로 쪼개진 구간은 태스크 하나가 통째로 빌드
 }
 
 FBVHierarchy::FBVHierarchy(const FAABB& InBounds, int InDepth, int InMaxDepth, int InMaxObjects)
@@ -62,16 +74,29 @@ FBVHierarchy::~FBVHierarchy()
 
 void FBVHierarchy::Clear()
 {
-    // NOTE: TMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
-    StaticMeshComponentBounds = TMap<UPrimitiveComponent*, FAABB>();
+    // 진행 중인 백그라운드 빌드는 끝까지 기다린 뒤 결과를 버림
+    CancelBackgroundRebuild();
+    PendingBuild.reset();
+
+    // NOTE: TFlatMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
+    StaticMeshComponentBounds = TFlatMap<UPrimitiveComponent*, FAABB>();
     StaticMeshComponentArray = TArray<UPrimitiveComponent*>();
     Nodes = TArray<FLBVHNode>();
+    FreeNodeIndices = TArray<int32>();
+    RootIndex = -1;
+    SlotLeaves = TArray<int32>();
+    FreeSlots = TArray<int32>();
+    ComponentSlots = TFlatMap<UPrimitiveComponent*, int32>();
     Bounds = FAABB();
-    bPendingRebuild = false;
+    WeightedAreaSum = 0.0;
+    BuiltSAHCost = -1.0f;
 }
 
 void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components)
 {
+    // 곧바로 전체 빌드하므로 진행 중인 백그라운드 빌드는 필요 없음
+    CancelBackgroundRebuild();
+
     for (const auto& SMC : Components)
     {
         if (SMC)
@@ -82,8 +107,7 @@ void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components)
 
     // Level 복사 등으로 다량의 컴포넌트를 한 번에 넣는 상황 전제
     // 일반적인 update에서 budget 단위로 끊어 갱신되는 로직 우회해 강제 rebuild
-    BuildLBVH();
-    bPendingRebuild = false;
+    BuildTree();
 }
 
 void FBVHierarchy::Update(UPrimitiveComponent* InComponent)
@@ -102,7 +126,19 @@ void FBVHierarchy::Update(UPrimitiveComponent* InComponent)
     const FAABB WorldBounds = InComponent->GetWorldAABB();
 
     StaticMeshComponentBounds.Add(InComponent, WorldBounds);
-    bPendingRebuild = true;
+    if (RebuildTask.IsValid())
+    {
+        ChangedDuringRebuild.Add(InComponent);
+    }
+
+    if (const int32* Slot = ComponentSlots.Find(InComponent))
+    {
+        MoveComponent(*Slot, WorldBounds);
+    }
+    else
+    {
+        InsertComponent(InComponent, WorldBounds);
+    }
 }
 
 void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
@@ -115,17 +151,24 @@ void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
     if (StaticMeshComponentBounds.Find(InComponent))
     {
         StaticMeshComponentBounds.Remove(InComponent);
-        bPendingRebuild = true;
+        if (RebuildTask.IsValid())
+        {
+            ChangedDuringRebuild.Add(InComponent);
+        }
+        if (const int32* Slot = ComponentSlots.Find(InComponent))
+        {
+            RemoveComponent(*Slot);
+        }
     }
 }
 
 void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
 {
-    if (Nodes.empty()) return;
+    if (RootIndex < 0) return;
     //프러스텀 외부에 바운드 존재
-    if (!IsAABBVisible(InFrustum, Nodes[0].Bounds)) return;
+    if (!IsAABBVisible(InFrustum, Nodes[RootIndex].Bounds)) return;
     //프러스텀 내부에 바운드 존재 (교차 X)
-    if (!IsAABBIntersects(InFrustum, Nodes[0].Bounds))
+    if (!IsAABBIntersects(InFrustum, Nodes[RootIndex].Bounds))
     {
         for (UPrimitiveComponent* Component : StaticMeshComponentArray)
         {
@@ -141,7 +184,7 @@ void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
     }
     //프러스텀과 바운드가 교차
     TArray<int32> IdxStack;
-    IdxStack.push_back({ 0 });
+    IdxStack.push_back({ RootIndex });
 
     while (!IdxStack.empty())
     {
@@ -177,11 +220,12 @@ void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
 void FBVHierarchy::DebugDraw(URenderer* Renderer) const
 {
     if (!Renderer) return;
-    if (Nodes.empty()) return;
+    if (RootIndex < 0) return;
 
     for (size_t i = 0; i < Nodes.size(); ++i)
     {
         const FLBVHNode& N = Nodes[i];
+        if (N.IsFree()) continue;
         const FVector Min = N.Bounds.Min;
         const FVector Max = N.Bounds.Max;
         const FVector4 LineColor(1.0f, N.IsLeaf() ? 0.2f : 0.8f, 0.0f, 1.0f);
@@ -220,36 +264,62 @@ void FBVHierarchy::DebugDraw(URenderer* Renderer) const
 
 int FBVHierarchy::TotalNodeCount() const
 {
-    return static_cast<int>(Nodes.size());
+    return static_cast<int>(Nodes.size() - FreeNodeIndices.size());
 }
 
 int FBVHierarchy::TotalActorCount() const
 {
-    return static_cast<int>(StaticMeshComponentArray.size());
+    return ComponentSlots.Num();
 }
 
 int FBVHierarchy::MaxOccupiedDepth() const
 {
-    return (Nodes.empty()) ? 0 : (int)std::ceil(std::log2((double)Nodes.size() + 1));
+    // 부분 갱신으로 균형이 깨질 수 있으므로 실제 깊이를 셈
+    if (RootIndex < 0) return 0;
+    int MaxDepthFound = 0;
+    TArray<std::pair<int32, int>> Stack;
+    Stack.push_back({ RootIndex, 1 });
+    while (!Stack.empty())
+    {
+        const auto [Idx, NodeDepth] = Stack.back();
+        Stack.pop_back();
+        MaxDepthFound = std::max(MaxDepthFound, NodeDepth);
+        if (!Nodes[Idx].IsLeaf())
+        {
+            Stack.push_back({ Nodes[Idx].Left, NodeDepth + 1 });
+            Stack.push_back({ Nodes[Idx].Right, NodeDepth + 1 });
+        }
+    }
+    return MaxDepthFound;
+}
+
+float FBVHierarchy::GetSAHCost() const
+{
+    if (RootIndex < 0) return 0.0f;
+    const float RootArea = SurfaceArea(Nodes[RootIndex].Bounds);
+    return RootArea > 0.0f ? static_cast<float>(WeightedAreaSum / RootArea) : 0.0f;
 }
 
 void FBVHierarchy::DebugDump() const
 {
-    UE_LOG("===== BVHierachy (LBVH) DUMP BEGIN =====\r\n");
+    const char* MethodName = BuildMethod == EBVHBuildMethod::BinnedSAH ? "Binned SAH" : "LBVH";
+    UE_LOG("===== BVHierachy (%s) DUMP BEGIN =====\r\n", MethodName);
     char buf[256];
-    std::snprintf(buf, sizeof(buf), "nodes=%zu, components=%zu\r\n", Nodes.size(), StaticMeshComponentArray.size());
+    std::snprintf(buf, sizeof(buf), "nodes=%d, components=%d, root=%d, sah=%.2f (built %.2f)\r\n",
+        TotalNodeCount(), TotalActorCount(), RootIndex, GetSAHCost(), BuiltSAHCost);
     UE_LOG(buf);
     for (size_t i = 0; i < Nodes.size(); ++i)
     {
         const auto& n = Nodes[i];
+        if (n.IsFree()) continue;
         std::snprintf(buf, sizeof(buf),
-            "[%zu] L=%d R=%d F=%d C=%d | [(%.1f,%.1f,%.1f)-(%.1f,%.1f,%.1f)]\r\n",
-            i, n.Left, n.Right, n.First, n.Count,
+            "[%zu] P=%d L=%d R=%d F=%d C=%d | [(%.1f,%.1f,%.1f)-(%.1f,%.1f,%.1f)]\r\n",
+            i, n.Parent, n.Left, n.Right, n.First, n.Count,
             n.Bounds.Min.X, n.Bounds.Min.Y, n.Bounds.Min.Z,
             n.Bounds.Max.X, n.Bounds.Max.Y, n.Bounds.Max.Z);
         UE_LOG(buf);
     }
-    UE_LOG("===== BVHierachy (LBVH) DUMP END =====\r\n");
+    UE_LOG("===== BVHierachy (%s) DUMP END =====\r\n", MethodName);
 }
 
 // Morton helpers
@@ -269,58 +339,92 @@ namespace
     }
 }
 
-void FBVHierarchy::BuildLBVH()
+void FBVHierarchy::GatherSnapshot(TArray<UPrimitiveComponent*>& OutComponents, TArray<FAABB>& OutBounds) const
 {
-    StaticMeshComponentArray = StaticMeshComponentBounds.GetKeys();
-    const int N = StaticMeshComponentArray.Num();
-    Nodes = TArray<FLBVHNode>();
+    OutComponents.Reserve(StaticMeshComponentBounds.Num());
+    OutBounds.Reserve(StaticMeshComponentBounds.Num());
+    for (const auto& Pair : StaticMeshComponentBounds)
+    {
+        OutComponents.Add(Pair.first);
+        OutBounds.Add(Pair.second);
+    }
+}
 
-    if (N == 0)
+void FBVHierarchy::BuildTree()
+{
+    TArray<UPrimitiveComponent*> Components;
+    TArray<FAABB> ComponentBounds;
+    GatherSnapshot(Components, ComponentBounds);
+
+    FBuildResult Result;
+    BuildNodes(Components, ComponentBounds, MaxObjects, BuildMethod, Result);
+    ApplyBuildResult(Result);
+}
+
+void FBVHierarchy::SetBuildMethod(EBVHBuildMethod InMethod)
+{
+    if (BuildMethod == InMethod)
     {
-        Bounds = FAABB();
         return;
     }
 
-    bool bHasBounds = false;
-    for (const auto& Pair : StaticMeshComponentBounds)
+    BuildMethod = InMethod;
+    if (!StaticMeshComponentBounds.IsEmpty())
     {
-        const FAABB& Bound = Pair.second;
-        if (!bHasBounds)
-        {
-            Bounds = Bound;
-            bHasBounds = true;
-        }
-        else
-        {
-            Bounds = FAABB::Union(Bounds, Bound);
-        }
+        // 이전 방식으로 만들던 결과는 버림
+        CancelBackgroundRebuild();
+        BuildTree();
     }
+}
 
-    if (!bHasBounds)
+void FBVHierarchy::BuildNodes(const TArray<UPrimitiveComponent*>& InComponents, const TArray<FAABB>& InBounds, int InMaxObjects, EBVHBuildMethod InMethod, FBuildResult& Out)
+{
+    const int N = InComponents.Num();
+    Out.Nodes = TArray<FLBVHNode>();
+    Out.Components = TArray<UPrimitiveComponent*>();
+    Out.Bounds = FAABB();
+
+    if (N == 0)
     {
-        Bounds = FAABB();
         return;
     }
 
-    TArray<uint32> Codes;
-    Codes.resize(N);
-    const FVector Min = Bounds.Min;
-    const FVector Extent = Bounds.GetHalfExtent();
+    Out.Bounds = InBounds[0];
+    for (int i = 1; i < N; ++i)
+    {
+        Out.Bounds = FAABB::Union(Out.Bounds, InBounds[i]);
+    }
 
-    for (int i = 0; i < N; ++i)
+    if (InMethod == EBVHBuildMethod::BinnedSAH)
+    {
+        BuildBinnedSAH(InComponents, InBounds, InMaxObjects, Out);
+    }
+    else
     {
-        UPrimitiveComponent* Component = StaticMeshComponentArray[i];
-        const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
-        const FVector Center = Bound ? Bound->GetCenter() : Component->GetWorldAABB().GetCenter();
+        BuildMorton(InComponents, InBounds, InMaxObjects, Out);
+    }
+}
 
-        const auto Normalize = [](float Value, float MinValue, float ExtHalf)
+void FBVHierarchy::BuildMorton(const TArray<UPrimitiveComponent*>& InComponents, const TArray<FAABB>& InBounds, int InMaxObjects, FBuildResult& Out)
+{
+    const int N = InComponents.Num();
+    const FVector Min = Out.Bounds.Min;
+    const FVector Extent = Out.Bounds.GetHalfExtent();
+
+    const auto Normalize = [](float Value, float MinValue, float ExtHalf)
+        {
+            if (ExtHalf > 0.0f)
             {
-                if (ExtHalf > 0.0f)
-                {
-                    return std::clamp((Value - MinValue) / (ExtHalf * 2.0f), 0.0f, 1.0f);
-                }
-                return 0.5f;
-            };
+                return std::clamp((Value - MinValue) / (ExtHalf * 2.0f), 0.0f, 1.0f);
+            }
+            return 0.5f;
+        };
+
+    TArray<std::pair<int32, uint32>> IndexCodePairs;
+    IndexCodePairs.resize(N);
+    for (int i = 0; i < N; ++i)
+    {
+        const FVector Center = InBounds[i].GetCenter();
 
         const float Nx = Normalize(Center.X, Min.X, Extent.X);
         const float Ny = Normalize(Center.Y, Min.Y, Extent.Y);
@@ -330,77 +434,711 @@ void FBVHierarchy::BuildLBVH()
         const uint32 Iy = static_cast<uint32>(Ny * 1023.0f);
         const uint32 Iz = static_cast<uint32>(Nz * 1023.0f);
 
-        Codes[i] = Morton3D(Ix, Iy, Iz);
+        IndexCodePairs[i] = { i, Morton3D(Ix, Iy, Iz) };
     }
 
-    TArray<std::pair<UPrimitiveComponent*, uint32>> ComponentCodePairs;
-    ComponentCodePairs.resize(N);
-    for (int i = 0; i < N; ++i)
-    {
-        ComponentCodePairs[i] = { StaticMeshComponentArray[i], Codes[i] };
-    }
-
-    std::sort(ComponentCodePairs.begin(), ComponentCodePairs.end(),
-        [](const auto& LHS, const auto& RHS)
+    // 모턴 코드 기수 정렬 (안정 정렬이라 같은 코드의 순서가 빌드마다 같음)
+    ParallelRadixSort(IndexCodePairs, [](const std::pair<int32, uint32>& Pair)
         {
-            return LHS.second < RHS.second;
+            return Pair.second;
         });
 
+    TArray<FAABB> SortedBounds;
+    SortedBounds.resize(N);
+    Out.Components.resize(N);
     for (int i = 0; i < N; ++i)
     {
-        StaticMeshComponentArray[i] = ComponentCodePairs[i].first;
+        Out.Components[i] = InComponents[IndexCodePairs[i].first];
+        SortedBounds[i] = InBounds[IndexCodePairs[i].first];
     }
 
-    Nodes.reserve(std::max(1, 2 * N));
-    Nodes.clear();
-    BuildRange(0, N);
+    Out.Nodes.reserve(std::max(1, 2 * N));
+    BuildRange(Out, SortedBounds, InMaxObjects, 0, N);
 }
 
-int FBVHierarchy::BuildRange(int s, int e)
+int FBVHierarchy::BuildRange(FBuildResult& Out, const TArray<FAABB>& SortedBounds, int InMaxObjects, int s, int e)
 {
-    int nodeIdx = static_cast<int>(Nodes.size());
-    Nodes.push_back(FLBVHNode{});
-    FLBVHNode& node = Nodes[nodeIdx];
+    int nodeIdx = static_cast<int>(Out.Nodes.size());
+    Out.Nodes.push_back(FLBVHNode{});
 
     int count = e - s;
-    if (count <= MaxObjects)
+    if (count <= InMaxObjects)
     {
+        FAABB Accumulated = SortedBounds[s];
+        for (int i = s + 1; i < e; ++i)
+        {
+            Accumulated = FAABB::Union(Accumulated, SortedBounds[i]);
+        }
+
+        FLBVHNode& node = Out.Nodes[nodeIdx];
         node.First = s;
         node.Count = count;
-        bool bInitialized = false;
-        FAABB Accumulated;
-        for (int i = s; i < e; ++i)
+        node.Bounds = Accumulated;
+        return nodeIdx;
+    }
+
+    int mid = (s + e) / 2;
+    int L = BuildRange(Out, SortedBounds, InMaxObjects, s, mid);
+    int R = BuildRange(Out, SortedBounds, InMaxObjects, mid, e);
+    FLBVHNode& node = Out.Nodes[nodeIdx];
+    node.Left = L; node.Right = R; node.First = -1; node.Count = 0;
+    node.Bounds = FAABB::Union(Out.Nodes[L].Bounds, Out.Nodes[R].Bounds);
+    Out.Nodes[L].Parent = nodeIdx;
+    Out.Nodes[R].Parent = nodeIdx;
+    return nodeIdx;
+}
+
+/**
+ * Prims[0, Count)를 중심점 기준 빈 SAH 비용이 가장 작은 축/경계로 나누고 왼쪽 개수를 반환 (항상 1 ~ Count-1)
+ * 중심점이 모두 같으면 절반으로 나눔
+ */
+int32 FBVHierarchy::PartitionBinnedSAH(FSAHPrim* Prims, int32 Count)
+{
+    // 둘이면 어떻게 나눠도 1:1
+    if (Count == 2)
+    {
+        return 1;
+    }
+
+    FVector CenterMin = Prims[0].Center;
+    FVector CenterMax = CenterMin;
+    for (int32 i = 1; i < Count; ++i)
+    {
+        CenterMin = CenterMin.ComponentMin(Prims[i].Center);
+        CenterMax = CenterMax.ComponentMax(Prims[i].Center);
+    }
+
+    // 빈이 원소보다 많으면 빈 빈만 늘어나므로 작은 구간은 원소 수만큼만 사용
+    const int32 NumBins = Count >= SAHSubtreeSize ? SAHMaxBins : std::min(Count, SAHMinBins);
+    float Scales[3];
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        const float Extent = CenterMax[Axis] - CenterMin[Axis];
+        Scales[Axis] = Extent > 0.0f ? NumBins / Extent : 0.0f;
+    }
+
+    // 세 축을 한 번에 비닝 (빈 상자는 뒤집힌 상태로 시작해 조건 없이 합침)
+    const FAABB Empty(FVector(FLT_MAX, FLT_MAX, FLT_MAX), FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX));
+    FAABB BinBounds[3][SAHMaxBins];
+    int32 BinCounts[3][SAHMaxBins] = {};
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        std::fill(BinBounds[Axis], BinBounds[Axis] + NumBins, Empty);
+    }
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const FVector& Center = Prims[i].Center;
+        const FAABB& Box = Prims[i].Bounds;
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            const int32 Bin = std::min(NumBins - 1, static_cast<int32>((Center[Axis] - CenterMin[Axis]) * Scales[Axis]));
+            BinBounds[Axis][Bin] = FAABB::Union(BinBounds[Axis][Bin], Box);
+            ++BinCounts[Axis][Bin];
+        }
+    }
+
+    float BestCost = FLT_MAX;
+    int32 BestAxis = -1;
+    int32 BestSplit = 0;
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        if (Scales[Axis] <= 0.0f)
         {
-            UPrimitiveComponent* Component = StaticMeshComponentArray[i];
-            if (!Component)
+            continue;
+        }
+
+        // 오른쪽부터 누적한 면적/개수, 왼쪽으로 훑으며 경계 Split(왼쪽 = 빈 [0, Split))의 비용 계산
+        float RightAreas[SAHMaxBins];
+        int32 RightCounts[SAHMaxBins];
+        FAABB Accumulated = Empty;
+        int32 AccumulatedCount = 0;
+        for (int32 Bin = NumBins - 1; Bin > 0; --Bin)
+        {
+            Accumulated = FAABB::Union(Accumulated, BinBounds[Axis][Bin]);
+            AccumulatedCount += BinCounts[Axis][Bin];
+            RightAreas[Bin] = AccumulatedCount ? SurfaceArea(Accumulated) : 0.0f;
+            RightCounts[Bin] = AccumulatedCount;
+        }
+
+        Accumulated = Empty;
+        AccumulatedCount = 0;
+        for (int32 Split = 1; Split < NumBins; ++Split)
+        {
+            Accumulated = FAABB::Union(Accumulated, BinBounds[Axis][Split - 1]);
+            AccumulatedCount += BinCounts[Axis][Split - 1];
+            if (AccumulatedCount == 0 || RightCounts[Split] == 0)
             {
                 continue;
             }
 
-            const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
-            const FAABB LocalBound = Bound ? *Bound : Component->GetWorldAABB();
-            if (!bInitialized)
+            const float Cost = SurfaceArea(Accumulated) * AccumulatedCount + RightAreas[Split] * RightCounts[Split];
+            if (Cost < BestCost)
+            {
+                BestCost = Cost;
+                BestAxis = Axis;
+                BestSplit = Split;
+            }
+        }
+    }
+
+    if (BestAxis < 0)
+    {
+        return Count / 2;
+    }
+
+    const float AxisMin = CenterMin[BestAxis];
+    const float AxisScale = Scales[BestAxis];
+    FSAHPrim* Mid = std::partition(Prims, Prims + Count, [&](const FSAHPrim& Prim)
+        {
+            return static_cast<int32>((Prim.Center[BestAxis] - AxisMin) * AxisScale) < BestSplit;
+        });
+    return static_cast<int32>(Mid - Prims);
+}
+
+void FBVHierarchy::BuildBinnedSAH(const TArray<UPrimitiveComponent*>& InComponents, const TArray<FAABB>& InBounds, int InMaxObjects, FBuildResult& Out)
+{
+    const int N = InComponents.Num();
+
+    TArray<FSAHPrim> Prims;
+    Prims.resize(N);
+    for (int i = 0; i < N; ++i)
+    {
+        Prims[i] = FSAHPrim{ InBounds[i], InBounds[i].GetCenter(), i };
+    }
+
+    // 1) 위쪽 분할: SAHSubtreeSize 이하가 된 구간은 자리만 잡아 두고 서브트리 목록에 넣음
+    TArray<FSAHSubtree> Subtrees;
+    Out.Nodes.reserve(std::max(1, 2 * N));
+    BuildRangeSAH(Out.Nodes, Prims, InMaxObjects, 0, N, &Subtrees);
+    const int32 NumTopNodes = Out.Nodes.Num();
+
+    // 2) 서브트리는 서로 겹치지 않는 Prims 구간만 건드리므로 태스크마다 독립적으로 빌드
+    ParallelFor(Subtrees.Num(), [&](int32 Index)
+        {
+            FSAHSubtree& Subtree = Subtrees[Index];
+            Subtree.Nodes.reserve(2 * (Subtree.Last - Subtree.First));
+            BuildRangeSAH(Subtree.Nodes, Prims, InMaxObjects, Subtree.First, Subtree.Last, nullptr);
+        });
+
+    // 3) 서브트리 루트는 잡아 둔 자리에, 나머지는 뒤에 붙이며 인덱스를 옮김
+    for (FSAHSubtree& Subtree : Subtrees)
+    {
+        const int32 Base = Out.Nodes.Num() - 1;
+        const auto Remap = [&](int32 Local)
+            {
+                return Local < 0 ? -1 : (Local == 0 ? Subtree.NodeIndex : Base + Local);
+            };
+
+        for (int32 Local = 0; Local < Subtree.Nodes.Num(); ++Local)
+        {
+            FLBVHNode Node = Subtree.Nodes[Local];
+            Node.Left = Remap(Node.Left);
+            Node.Right = Remap(Node.Right);
+            if (Local == 0)
             {
-                Accumulated = LocalBound;
-                bInitialized = true;
+                Node.Parent = Out.Nodes[Subtree.NodeIndex].Parent;
+                Out.Nodes[Subtree.NodeIndex] = Node;
             }
             else
             {
-                Accumulated = FAABB::Union(Accumulated, LocalBound);
+                Node.Parent = Remap(Node.Parent);
+                Out.Nodes.push_back(Node);
             }
         }
-        node.Bounds = bInitialized ? Accumulated : Bounds;
+    }
+
+    // 위쪽 내부 노드는 서브트리가 채워진 뒤에야 바운드를 알 수 있음 (자식 인덱스가 항상 부모보다 큼)
+    if (!Subtrees.IsEmpty())
+    {
+        for (int32 i = NumTopNodes - 1; i >= 0; --i)
+        {
+            FLBVHNode& Node = Out.Nodes[i];
+            if (!Node.IsLeaf())
+            {
+                Node.Bounds = FAABB::Union(Out.Nodes[Node.Left].Bounds, Out.Nodes[Node.Right].Bounds);
+            }
+        }
+    }
+
+    Out.Components.resize(N);
+    for (int i = 0; i < N; ++i)
+    {
+        Out.Components[i] = InComponents[Prims[i].Index];
+    }
+}
+
+int FBVHierarchy::BuildRangeSAH(TArray<FLBVHNode>& OutNodes, TArray<FSAHPrim>& Prims, int InMaxObjects, int s, int e, TArray<FSAHSubtree>* OutSubtrees)
+{
+    int nodeIdx = static_cast<int>(OutNodes.size());
+    OutNodes.push_back(FLBVHNode{});
+
+    int count = e - s;
+    if (count <= InMaxObjects)
+    {
+        FAABB Accumulated = Prims[s].Bounds;
+        for (int i = s + 1; i < e; ++i)
+        {
+            Accumulated = FAABB::Union(Accumulated, Prims[i].Bounds);
+        }
+
+        FLBVHNode& node = OutNodes[nodeIdx];
+        node.First = s;
+        node.Count = count;
+        node.Bounds = Accumulated;
         return nodeIdx;
     }
 
-    int mid = (s + e) / 2;
-    int L = BuildRange(s, mid);
-    int R = BuildRange(mid, e);
+    if (OutSubtrees && count <= SAHSubtreeSize)
+    {
+        OutSubtrees->Add(FSAHSubtree{ nodeIdx, s, e, {} });
+        return nodeIdx;
+    }
+
+    int mid = s + PartitionBinnedSAH(Prims.data() + s, count);
+    int L = BuildRangeSAH(OutNodes, Prims, InMaxObjects, s, mid, OutSubtrees);
+    int R = BuildRangeSAH(OutNodes, Prims, InMaxObjects, mid, e, OutSubtrees);
+    FLBVHNode& node = OutNodes[nodeIdx];
     node.Left = L; node.Right = R; node.First = -1; node.Count = 0;
-    node.Bounds = FAABB::Union(Nodes[L].Bounds, Nodes[R].Bounds);
+    node.Bounds = FAABB::Union(OutNodes[L].Bounds, OutNodes[R].Bounds);
+    OutNodes[L].Parent = nodeIdx;
+    OutNodes[R].Parent = nodeIdx;
     return nodeIdx;
 }
 
+void FBVHierarchy::ApplyBuildResult(FBuildResult& Result)
+{
+    Nodes = std::move(Result.Nodes);
+    StaticMeshComponentArray = std::move(Result.Components);
+    Bounds = Result.Bounds;
+    RootIndex = Nodes.empty() ? -1 : 0;
+    FreeNodeIndices.clear();
+    FreeSlots.clear();
+
+    // 슬롯 -> 리프, 컴포넌트 -> 슬롯 역참조와 SAH 합계를 새 트리 기준으로 다시 만듦
+    SlotLeaves.clear();
+    SlotLeaves.resize(StaticMeshComponentArray.Num(), -1);
+    ComponentSlots = TFlatMap<UPrimitiveComponent*, int32>();
+    ComponentSlots.Reserve(StaticMeshComponentArray.Num());
+    WeightedAreaSum = 0.0;
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        const FLBVHNode& Node = Nodes[i];
+        if (Node.IsLeaf())
+        {
+            for (int32 Slot = Node.First; Slot < Node.First + Node.Count; ++Slot)
+            {
+                SlotLeaves[Slot] = i;
+                ComponentSlots.Add(StaticMeshComponentArray[Slot], Slot);
+            }
+        }
+        WeightedAreaSum += static_cast<double>(SurfaceArea(Node.Bounds)) * Node.GetCostWeight();
+    }
+    BuiltSAHCost = GetSAHCost();
+}
+
+bool FBVHierarchy::NeedsRebuild() const
+{
+    if (RootIndex < 0 || RebuildTask.IsValid())
+    {
+        return false;
+    }
+
+    // 전체 빌드 없이 삽입만으로 만들어진 트리는 한 번 정리
+    if (BuiltSAHCost < 0.0f)
+    {
+        return ComponentSlots.Num() > 1;
+    }
+    return GetSAHCost() > std::max(BuiltSAHCost, 1.0f) * RebuildCostRatio;
+}
+
+void FBVHierarchy::KickBackgroundRebuild()
+{
+    // 스냅샷은 게임 스레드에서 복사 (워커는 컴포넌트에 접근하지 않음)
+    TArray<UPrimitiveComponent*> Components;
+    TArray<FAABB> ComponentBounds;
+    GatherSnapshot(Components, ComponentBounds);
+
+    if (!PendingBuild)
+    {
+        PendingBuild = std::make_unique<FBuildResult>();
+    }
+
+    FBuildResult* Out = PendingBuild.get();
+    const int LeafSize = MaxObjects;
+    const EBVHBuildMethod Method = BuildMethod;
+    RebuildTask = FTaskSystem::Launch([Out, LeafSize, Method, Components = std::move(Components), ComponentBounds = std::move(ComponentBounds)]()
+    {
+        BuildNodes(Components, ComponentBounds, LeafSize, Method, *Out);
+    });
+}
+
+void FBVHierarchy::ApplyBackgroundRebuild()
+{
+    RebuildTask.Wait();
+    RebuildTask.Reset();
+    ApplyBuildResult(*PendingBuild);
+
+    // 스냅샷 이후 제거된 컴포넌트를 먼저 비움
+    // (남겨 두면 같은 리프의 다른 슬롯을 옮기다 리프가 통째로 해제되어 슬롯 역참조가 깨짐)
+    TArray<int32> RemovedSlots;
+    for (UPrimitiveComponent* Component : ChangedDuringRebuild)
+    {
+        const int32* Slot = ComponentSlots.Find(Component);
+        if (Slot && !StaticMeshComponentBounds.Contains(Component))
+        {
+            RemovedSlots.Add(*Slot);
+            StaticMeshComponentArray[*Slot] = nullptr;
+            ComponentSlots.Remove(Component);
+        }
+    }
+    for (int32 Slot : RemovedSlots)
+    {
+        // 앞선 DetachSlot에서 리프가 이미 해제됐으면 건너뜀
+        if (SlotLeaves[Slot] >= 0)
+        {
+            DetachSlot(Slot);
+        }
+    }
+
+    // 남은 변경(이동, 추가)을 새 트리에 다시 반영
+    for (UPrimitiveComponent* Component : ChangedDuringRebuild)
+    {
+        if (const FAABB* WorldBounds = StaticMeshComponentBounds.Find(Component))
+        {
+            if (const int32* Slot = ComponentSlots.Find(Component))
+            {
+                MoveComponent(*Slot, *WorldBounds);
+            }
+            else
+            {
+                InsertComponent(Component, *WorldBounds);
+            }
+        }
+    }
+    ChangedDuringRebuild = TFlatSet<UPrimitiveComponent*>();
+}
+
+void FBVHierarchy::CancelBackgroundRebuild()
+{
+    // 워커가 PendingBuild에 쓰고 있을 수 있으므로 끝날 때까지 기다린 뒤 버림
+    RebuildTask.Wait();
+    RebuildTask.Reset();
+    ChangedDuringRebuild = TFlatSet<UPrimitiveComponent*>();
+}
+
+void FBVHierarchy::InsertComponent(UPrimitiveComponent* InComponent, const FAABB& WorldBounds)
+{
+    int32 Slot;
+    if (!FreeSlots.IsEmpty())
+    {
+        Slot = FreeSlots.Pop();
+        StaticMeshComponentArray[Slot] = InComponent;
+    }
+    else
+    {
+        Slot = StaticMeshComponentArray.Num();
+        StaticMeshComponentArray.Add(InComponent);
+        SlotLeaves.Add(-1);
+    }
+
+    const int32 Leaf = AllocateNode();
+    Nodes[Leaf].First = Slot;
+    Nodes[Leaf].Count = 1;
+    SetNodeBounds(Leaf, WorldBounds);
+    SlotLeaves[Slot] = Leaf;
+    ComponentSlots.Add(InComponent, Slot);
+    InsertLeaf(Leaf);
+}
+
+void FBVHierarchy::MoveComponent(int32 Slot, const FAABB& WorldBounds)
+{
+    const int32 Leaf = SlotLeaves[Slot];
+    const FLBVHNode& Node = Nodes[Leaf];
+
+    if (Node.Count == 1)
+    {
+        if (Node.Bounds.Contains(WorldBounds) && WorldBounds.Contains(Node.Bounds))
+        {
+            return; // 바운드 그대로
+        }
+
+        // 부모 박스 안에서 움직이면 리핏만, 벗어나면 떼어 내 가장 싼 위치에 다시 삽입
+        const int32 Parent = Node.Parent;
+        if (Parent < 0 || Nodes[Parent].Bounds.Contains(WorldBounds))
+        {
+            SetNodeBounds(Leaf, WorldBounds);
+            RefitUpward(Parent);
+        }
+        else
+        {
+            RemoveLeaf(Leaf);
+            SetNodeBounds(Leaf, WorldBounds);
+            InsertLeaf(Leaf);
+        }
+        return;
+    }
+
+    // 여러 컴포넌트가 모인 리프(전체 빌드 결과): 리프 박스 안이면 리핏, 벗어나면 단독 리프로 옮김
+    if (Node.Bounds.Contains(WorldBounds))
+    {
+        FAABB LeafBounds;
+        ComputeLeafBounds(Node, LeafBounds);
+        SetNodeBounds(Leaf, LeafBounds);
+        RefitUpward(Nodes[Leaf].Parent);
+        return;
+    }
+
+    UPrimitiveComponent* Component = StaticMeshComponentArray[Slot];
+    DetachSlot(Slot);
+    InsertComponent(Component, WorldBounds);
+}
+
+void FBVHierarchy::RemoveComponent(int32 Slot)
+{
+    ComponentSlots.Remove(StaticMeshComponentArray[Slot]);
+    DetachSlot(Slot);
+}
+
+void FBVHierarchy::DetachSlot(int32 Slot)
+{
+    const int32 Leaf = SlotLeaves[Slot];
+    StaticMeshComponentArray[Slot] = nullptr;
+
+    FAABB LeafBounds;
+    if (ComputeLeafBounds(Nodes[Leaf], LeafBounds))
+    {
+        // 남은 컴포넌트가 있으면 빈 슬롯은 다음 전체 빌드 때 정리
+        SetNodeBounds(Leaf, LeafBounds);
+        RefitUpward(Nodes[Leaf].Parent);
+        return;
+    }
+
+    // 빈 리프는 트리에서 떼고, 슬롯은 단독 리프용으로 재사용
+    const FLBVHNode& Node = Nodes[Leaf];
+    for (int32 i = Node.First; i < Node.First + Node.Count; ++i)
+    {
+        SlotLeaves[i] = -1;
+        FreeSlots.Add(i);
+    }
+    RemoveLeaf(Leaf);
+    FreeNode(Leaf);
+}
+
+bool FBVHierarchy::ComputeLeafBounds(const FLBVHNode& Leaf, FAABB& OutBounds) const
+{
+    bool bInitialized = false;
+    for (int32 i = Leaf.First; i < Leaf.First + Leaf.Count; ++i)
+    {
+        const FAABB* Bound = StaticMeshComponentArray[i] ? StaticMeshComponentBounds.Find(StaticMeshComponentArray[i]) : nullptr;
+        if (!Bound)
+        {
+            continue;
+        }
+        OutBounds = bInitialized ? FAABB::Union(OutBounds, *Bound) : *Bound;
+        bInitialized = true;
+    }
+    return bInitialized;
+}
+
+int32 FBVHierarchy::AllocateNode()
+{
+    if (!FreeNodeIndices.IsEmpty())
+    {
+        const int32 Index = FreeNodeIndices.Pop();
+        Nodes[Index] = FLBVHNode{};
+        return Index;
+    }
+    Nodes.Add(FLBVHNode{});
+    return Nodes.Num() - 1;
+}
+
+void FBVHierarchy::FreeNode(int32 NodeIndex)
+{
+    FLBVHNode& Node = Nodes[NodeIndex];
+    WeightedAreaSum -= static_cast<double>(SurfaceArea(Node.Bounds)) * Node.GetCostWeight();
+    Node = FLBVHNode{};
+    FreeNodeIndices.Add(NodeIndex);
+}
+
+void FBVHierarchy::SetNodeBounds(int32 NodeIndex, const FAABB& NewBounds)
+{
+    FLBVHNode& Node = Nodes[NodeIndex];
+    WeightedAreaSum += static_cast<double>(SurfaceArea(NewBounds) - SurfaceArea(Node.Bounds)) * Node.GetCostWeight();
+    Node.Bounds = NewBounds;
+}
+
+void FBVHierarchy::ReplaceChild(int32 ParentIndex, int32 OldChild, int32 NewChild)
+{
+    FLBVHNode& Parent = Nodes[ParentIndex];
+    if (Parent.Left == OldChild)
+    {
+        Parent.Left = NewChild;
+    }
+    else
+    {
+        Parent.Right = NewChild;
+    }
+}
+
+void FBVHierarchy::InsertLeaf(int32 Leaf)
+{
+    const FAABB LeafBounds = Nodes[Leaf].Bounds;
+    if (RootIndex < 0)
+    {
+        RootIndex = Leaf;
+        Nodes[Leaf].Parent = -1;
+        Bounds = LeafBounds;
+        return;
+    }
+
+    // 형제 찾기 (Box2D 방식 하강): 여기서 새 부모를 만드는 비용과 자식으로 내려가는 비용(조상 확장분 포함) 비교
+    int32 Index = RootIndex;
+    while (!Nodes[Index].IsLeaf())
+    {
+        const FLBVHNode& Node = Nodes[Index];
+        const float Area = SurfaceArea(Node.Bounds);
+        const float CombinedArea = SurfaceArea(FAABB::Union(Node.Bounds, LeafBounds));
+        const float Cost = 2.0f * CombinedArea;
+        const float InheritanceCost = 2.0f * (CombinedArea - Area);
+
+        const auto DescendCost = [&](int32 Child)
+            {
+                const FLBVHNode& ChildNode = Nodes[Child];
+                const float NewArea = SurfaceArea(FAABB::Union(ChildNode.Bounds, LeafBounds));
+                return (ChildNode.IsLeaf() ? NewArea : NewArea - SurfaceArea(ChildNode.Bounds)) + InheritanceCost;
+            };
+        const float CostLeft = DescendCost(Node.Left);
+        const float CostRight = DescendCost(Node.Right);
+
+        if (Cost < CostLeft && Cost < CostRight)
+        {
+            break;
+        }
+        Index = CostLeft < CostRight ? Node.Left : Node.Right;
+    }
+
+    const int32 Sibling = Index;
+    const int32 OldParent = Nodes[Sibling].Parent;
+    const int32 NewParent = AllocateNode();
+    Nodes[NewParent].Parent = OldParent;
+    Nodes[NewParent].Left = Sibling;
+    Nodes[NewParent].Right = Leaf;
+    SetNodeBounds(NewParent, FAABB::Union(Nodes[Sibling].Bounds, LeafBounds));
+    Nodes[Sibling].Parent = NewParent;
+    Nodes[Leaf].Parent = NewParent;
+
+    if (OldParent < 0)
+    {
+        RootIndex = NewParent;
+    }
+    else
+    {
+        ReplaceChild(OldParent, Sibling, NewParent);
+    }
+    RefitUpward(OldParent);
+}
+
+void FBVHierarchy::RemoveLeaf(int32 Leaf)
+{
+    if (Leaf == RootIndex)
+    {
+        RootIndex = -1;
+        Bounds = FAABB();
+        return;
+    }
+
+    // 부모를 없애고 형제를 조부모에 바로 붙임
+    const int32 Parent = Nodes[Leaf].Parent;
+    const int32 GrandParent = Nodes[Parent].Parent;
+    const int32 Sibling = Nodes[Parent].Left == Leaf ? Nodes[Parent].Right : Nodes[Parent].Left;
+
+    Nodes[Sibling].Parent = GrandParent;
+    if (GrandParent < 0)
+    {
+        RootIndex = Sibling;
+    }
+    else
+    {
+        ReplaceChild(GrandParent, Parent, Sibling);
+    }
+    FreeNode(Parent);
+    Nodes[Leaf].Parent = -1;
+    RefitUpward(GrandParent);
+}
+
+void FBVHierarchy::RefitUpward(int32 NodeIndex)
+{
+    while (NodeIndex >= 0)
+    {
+        const FLBVHNode& Node = Nodes[NodeIndex];
+        SetNodeBounds(NodeIndex, FAABB::Union(Nodes[Node.Left].Bounds, Nodes[Node.Right].Bounds));
+        RotateNode(NodeIndex);
+        NodeIndex = Nodes[NodeIndex].Parent;
+    }
+
+    if (RootIndex >= 0)
+    {
+        Bounds = Nodes[RootIndex].Bounds;
+    }
+}
+
+void FBVHierarchy::RotateNode(int32 NodeIndex)
+{
+    // 자식 하나와 반대쪽 손자를 바꿔 바뀌는 자식의 표면적이 줄면 회전 (NodeIndex 자신의 박스는 그대로)
+    // 후보: Left <-> Right의 자식 둘, Right <-> Left의 자식 둘
+    const int32 B = Nodes[NodeIndex].Left;
+    const int32 C = Nodes[NodeIndex].Right;
+
+    int32 BestMoveDown = -1;   // 내려갈 자식
+    int32 BestMoveUp = -1;     // 올라올 손자
+    int32 BestNewParent = -1;  // 손자의 부모였던 자식 (회전 후 BestMoveDown의 부모)
+    float BestDelta = 0.0f;
+
+    const auto Consider = [&](int32 MoveDown, int32 Other)
+        {
+            const FLBVHNode& OtherNode = Nodes[Other];
+            if (OtherNode.IsLeaf())
+            {
+                return;
+            }
+            const float OtherArea = SurfaceArea(OtherNode.Bounds);
+            const FAABB& MoveDownBounds = Nodes[MoveDown].Bounds;
+
+            // MoveDown <-> Other.Left 이면 Other = MoveDown + Other.Right
+            const float DeltaLeft = SurfaceArea(FAABB::Union(MoveDownBounds, Nodes[OtherNode.Right].Bounds)) - OtherArea;
+            if (DeltaLeft < BestDelta)
+            {
+                BestDelta = DeltaLeft;
+                BestMoveDown = MoveDown;
+                BestMoveUp = OtherNode.Left;
+                BestNewParent = Other;
+            }
+            const float DeltaRight = SurfaceArea(FAABB::Union(MoveDownBounds, Nodes[OtherNode.Left].Bounds)) - OtherArea;
+            if (DeltaRight < BestDelta)
+            {
+                BestDelta = DeltaRight;
+                BestMoveDown = MoveDown;
+                BestMoveUp = OtherNode.Right;
+                BestNewParent = Other;
+            }
+        };
+    Consider(B, C);
+    Consider(C, B);
+
+    if (BestMoveDown < 0)
+    {
+        return;
+    }
+
+    ReplaceChild(NodeIndex, BestMoveDown, BestMoveUp);
+    Nodes[BestMoveUp].Parent = NodeIndex;
+    ReplaceChild(BestNewParent, BestMoveUp, BestMoveDown);
+    Nodes[BestMoveDown].Parent = BestNewParent;
+
+    const FLBVHNode& NewParentNode = Nodes[BestNewParent];
+    SetNodeBounds(BestNewParent, FAABB::Union(Nodes[NewParentNode.Left].Bounds, Nodes[NewParentNode.Right].Bounds));
+}
+
 void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const
 {
     OutActor = nullptr;
@@ -410,10 +1148,10 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
         OutBestT = std::numeric_limits<float>::infinity();
     }
 
-    if (Nodes.empty()) return;
+    if (RootIndex < 0) return;
 
     float tminRoot, tmaxRoot;
-    if (!RayAABB_IntersectT(Ray, Nodes[0].Bounds, tminRoot, tmaxRoot)) return;
+    if (!RayAABB_IntersectT(Ray, Nodes[RootIndex].Bounds, tminRoot, tmaxRoot)) return;
 
     struct HeapItem
     {
@@ -423,7 +1161,7 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
     };
 
     std::priority_queue<HeapItem> heap;
-    heap.push({ 0, tminRoot });
+    heap.push({ RootIndex, tminRoot });
 
     const float Epsilon = 1e-3f;
     bool isPick = false;
@@ -496,24 +1234,30 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
 
 void FBVHierarchy::FlushRebuild()
 {
-    if (bPendingRebuild)
+    // 끝난 백그라운드 빌드가 있으면 교체 (아직이면 부분 갱신된 트리를 계속 사용)
+    if (RebuildTask.IsValid() && RebuildTask.IsCompleted())
     {
-        BuildLBVH();
-        bPendingRebuild = false;
+        ApplyBackgroundRebuild();
+    }
+
+    if (NeedsRebuild())
+    {
+        KickBackgroundRebuild();
     }
 }
 
 template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
-TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
+FBVHierarchy::FComponentQueryResult FBVHierarchy::QueryIntersectedComponentsGeneric(
     const BoundType& InBound,
     NodeIntersectFunc NodeIntersects,
     ComponentIntersectFunc ComponentIntersects) const
 {
-    TSet<UPrimitiveComponent*> IntersectedComponents;
-    if (Nodes.empty())
-        return TArray<UPrimitiveComponent*>();
-    TArray<int32> IdxStack;
-    IdxStack.push_back({ 0 });
+    // 컴포넌트는 StaticMeshComponentArray에 한 번씩만 들어있으므로 중복 제거용 Set이 필요 없음
+    FComponentQueryResult IntersectedComponents;
+    if (RootIndex < 0)
+        return IntersectedComponents;
+    TArray<int32, TInlineAllocator<64>> IdxStack;
+    IdxStack.push_back({ RootIndex });
 
     while (!IdxStack.empty())
     {
@@ -533,7 +1277,7 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
                     const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
                     if (ComponentIntersects(Box, InBound))
                     {
-                        IntersectedComponents.insert(Component);
+                        IntersectedComponents.Add(Component);
                     }
                 }
             }
@@ -544,11 +1288,11 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
             }
         }
     }
-    return IntersectedComponents.Array();
+    return IntersectedComponents;
 }
 
 // FAABB 오버로드
-TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FAABB& InBound) const
+FBVHierarchy::FComponentQueryResult FBVHierarchy::QueryIntersectedComponents(const FAABB& InBound) const
 {
     return QueryIntersectedComponentsGeneric(
         InBound,
@@ -558,7 +1302,7 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FAAB
 }
 
 // FOBB 오버로드
-TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FOBB& InBound) const
+FBVHierarchy::FComponentQueryResult FBVHierarchy::QueryIntersectedComponents(const FOBB& InBound) const
 {
     return QueryIntersectedComponentsGeneric(
         InBound,
@@ -568,7 +1312,7 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FOBB
 }
 
 // FBoundingSphere 오버로드
-TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FBoundingSphere& InBound) const
+FBVHierarchy::FComponentQueryResult FBVHierarchy::QueryIntersectedComponents(const FBoundingSphere& InBound) const
 {
     return QueryIntersectedComponentsGeneric(
         InBound,
@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include "TaskSystem.h"
 
 struct FFrustum;
 struct FRay; // forward declaration for ray type
@@ -7,6 +8,13 @@ class AActor;
 struct FOBB;
 struct FBoundingSphere;
 
+// 전체 빌드 방식 (월드마다 UWorldPartitionManager::SetBVHBuildMethod로 선택)
+enum class EBVHBuildMethod : uint8
+{
+    LBVH,       // 모턴 코드 정렬 후 가운데 분할 - 빌드가 가장 빠름
+    BinnedSAH,  // 축마다 빈(bin)으로 나눠 SAH 비용이 가장 작은 곳을 분할 - 뭉친 씬에서 쿼리가 빠름
+};
+
 /**
  * @brief Broad phase BVH based on UPrimitiveComponent
  */
@@ -27,16 +35,20 @@ public:
     void Clear();
 
     void BulkUpdate(const TArray<UPrimitiveComponent*>& Components);
+    // Update/Remove는 트리를 바로 부분 갱신합니다. (리프 리핏, 리프 삽입/삭제 + 회전)
     void Update(UPrimitiveComponent* InComponent);
     void Remove(UPrimitiveComponent* InComponent);
 
+    // 끝난 백그라운드 빌드를 반영하고, SAH 비용이 마지막 전체 빌드의 RebuildCostRatio배를 넘으면 새 빌드를 시작
     void FlushRebuild();
 
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
     void QueryFrustum(const FFrustum& InFrustum);
-    TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
-    TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
-    TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
+    // 쿼리 결과는 대부분 소수이므로 내부 버퍼에 담아 프레임당 힙 할당을 피함
+    using FComponentQueryResult = TArray<UPrimitiveComponent*, TInlineAllocator<64>>;
+    FComponentQueryResult QueryIntersectedComponents(const FAABB& InBound) const;
+    FComponentQueryResult QueryIntersectedComponents(const FOBB& InBound) const;
+    FComponentQueryResult QueryIntersectedComponents(const FBoundingSphere& InBound) const;
 
     void DebugDraw(URenderer* Renderer) const;
 
@@ -47,6 +59,18 @@ public:
     void DebugDump() const;
     const FAABB& GetBounds() const { return Bounds; }
 
+    // 전체 빌드 방식 - 바뀌면 진행 중인 빌드를 버리고 현재 컴포넌트로 바로 다시 빌드
+    void SetBuildMethod(EBVHBuildMethod InMethod);
+    EBVHBuildMethod GetBuildMethod() const { return BuildMethod; }
+
+    // SAH 비용 (노드 표면적 합 / 루트 표면적, 리프는 슬롯 수만큼 가중)
+    float GetSAHCost() const;
+    float GetBuiltSAHCost() const { return BuiltSAHCost; }
+    bool IsRebuildInFlight() const { return RebuildTask.IsValid(); }
+
+    // 부분 갱신으로 나빠진 트리를 다시 빌드하는 기준 (현재 비용 / 빌드 직후 비용)
+    static constexpr float RebuildCostRatio = 1.3f;
+
     // 프러스텀 기준으로 오클루더(내부노드 AABB) / 오클루디(리프의 액터들) 수집
     // VP는 행벡터 기준(네 컨벤션): p' = p * VP
 
@@ -55,32 +79,103 @@ private:
     struct FLBVHNode
     {
         FAABB Bounds;
+        int32 Parent = -1;
         int32 Left = -1;
         int32 Right = -1;
         int32 First = -1;
         int32 Count = 0;
         bool IsLeaf() const { return Count > 0; }
+        bool IsFree() const { return Count == 0 && Left < 0; }
+        float GetCostWeight() const { return IsLeaf() ? static_cast<float>(Count) : 1.0f; }
+    };
+
+    // 스냅샷(컴포넌트, 바운드)으로 만든 트리 - 워커 스레드에서도 만들 수 있도록 멤버에 접근하지 않음
+    struct FBuildResult
+    {
+        TArray<FLBVHNode> Nodes;
+        TArray<UPrimitiveComponent*> Components;
+        FAABB Bounds;
     };
-    void BuildLBVH();
+    static void BuildNodes(const TArray<UPrimitiveComponent*>& InComponents, const TArray<FAABB>& InBounds, int InMaxObjects, EBVHBuildMethod InMethod, FBuildResult& Out);
+    static void BuildMorton(const TArray<UPrimitiveComponent*>& InComponents, const TArray<FAABB>& InBounds, int InMaxObjects, FBuildResult& Out);
+    static int BuildRange(FBuildResult& Out, const TArray<FAABB>& SortedBounds, int InMaxObjects, int s, int e);
+
+    // Binned SAH: 위쪽 분할은 호출 스레드에서 하고, 작아진 서브트리는 태스크마다 따로 만든 뒤 이어 붙임
+    // 분할은 인덱스 대신 바운드/중심점을 함께 담은 원소를 직접 옮겨 연속으로 읽음
+    struct FSAHPrim
+    {
+        FAABB Bounds;
+        FVector Center;
+        int32 Index;
+    };
+    struct FSAHSubtree
+    {
+        int32 NodeIndex;    // 서브트리 루트가 들어갈 자리 (Out.Nodes)
+        int32 First;
+        int32 Last;
+        TArray<FLBVHNode> Nodes;
+    };
+    static void BuildBinnedSAH(const TArray<UPrimitiveComponent*>& InComponents, const TArray<FAABB>& InBounds, int InMaxObjects, FBuildResult& Out);
+    static int BuildRangeSAH(TArray<FLBVHNode>& OutNodes, TArray<FSAHPrim>& Prims, int InMaxObjects, int s, int e, TArray<FSAHSubtree>* OutSubtrees);
+    static int32 PartitionBinnedSAH(FSAHPrim* Prims, int32 Count);
+
+    void GatherSnapshot(TArray<UPrimitiveComponent*>& OutComponents, TArray<FAABB>& OutBounds) const;
+    void BuildTree();
+    void ApplyBuildResult(FBuildResult& Result);
+
+    // 백그라운드 빌드
+    bool NeedsRebuild() const;
+    void KickBackgroundRebuild();
+    void ApplyBackgroundRebuild();
+    void CancelBackgroundRebuild();
+
+    // 부분 갱신
+    void InsertComponent(UPrimitiveComponent* InComponent, const FAABB& WorldBounds);
+    void MoveComponent(int32 Slot, const FAABB& WorldBounds);
+    void RemoveComponent(int32 Slot);
+    void DetachSlot(int32 Slot);
+    bool ComputeLeafBounds(const FLBVHNode& Leaf, FAABB& OutBounds) const;
+
+    int32 AllocateNode();
+    void FreeNode(int32 NodeIndex);
+    void InsertLeaf(int32 Leaf);
+    void RemoveLeaf(int32 Leaf);
+    void RefitUpward(int32 NodeIndex);
+    void RotateNode(int32 NodeIndex);
+    void SetNodeBounds(int32 NodeIndex, const FAABB& NewBounds);
+    void ReplaceChild(int32 ParentIndex, int32 OldChild, int32 NewChild);
 
 private:
     template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
-    TArray<UPrimitiveComponent*> QueryIntersectedComponentsGeneric(const BoundType& InBound
+    FComponentQueryResult QueryIntersectedComponentsGeneric(const BoundType& InBound
         , NodeIntersectFunc NodeIntersects
         , ComponentIntersectFunc ComponentIntersects) const;
 
-    int BuildRange(int s, int e);
-
     int Depth;
     int MaxDepth;
     int MaxObjects;
     FAABB Bounds;
+    EBVHBuildMethod BuildMethod = EBVHBuildMethod::LBVH;
 
-    TMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
+    TFlatMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
     TArray<UPrimitiveComponent*> StaticMeshComponentArray;
 
-    // LBVH nodes
+    // LBVH nodes (빈 노드는 FreeNodeIndices에서 재사용)
     TArray<FLBVHNode> Nodes;
-
-    bool bPendingRebuild = false;
+    TArray<int32> FreeNodeIndices;
+    int32 RootIndex = -1;
+
+    // StaticMeshComponentArray 슬롯별 리프 (-1이면 빈 슬롯) / 컴포넌트별 슬롯
+    TArray<int32> SlotLeaves;
+    TArray<int32> FreeSlots;
+    TFlatMap<UPrimitiveComponent*, int32> ComponentSlots;
+
+    // 살아 있는 노드의 표면적 * 가중치 합 (SetNodeBounds/FreeNode에서 갱신)
+    double WeightedAreaSum = 0.0;
+    float BuiltSAHCost = -1.0f;
+
+    // 백그라운드 빌드 결과와 빌드 중 바뀐 컴포넌트 (반영 시 다시 적용)
+    FTaskHandle RebuildTask;
+    std::unique_ptr<FBuildResult> PendingBuild;
+    TFlatSet<UPrimitiveComponent*> ChangedDuringRebuild;
 };
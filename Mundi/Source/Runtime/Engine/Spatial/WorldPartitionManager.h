@@ -8,6 +8,7 @@ class UStaticMeshComponent;
 
 class FOctree;
 class FBVHierarchy;
+enum class EBVHBuildMethod : uint8;
 
 struct FRay;
 struct FAABB;
@@ -44,6 +45,10 @@ public:
 	/** BVH 게터 */
 	FBVHierarchy* GetBVH() const { return BVH; }
 
+	/** BVH 전체 빌드 방식 (LBVH / Binned SAH) - 바꾸면 등록된 컴포넌트로 바로 다시 빌드 */
+	void SetBVHBuildMethod(EBVHBuildMethod InMethod);
+	EBVHBuildMethod GetBVHBuildMethod() const;
+
 private:
 
 	// 싱글톤 
@@ -55,7 +60,7 @@ private:
 	void ClearBVHierarchy();
 	
 	TQueue<UPrimitiveComponent*> ComponentDirtyQueue; // 추가 혹은 갱신이 필요한 요소의 대기 큐
-	TSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
+	TFlatSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
 	FOctree* SceneOctree = nullptr;
 	FBVHierarchy* BVH = nullptr;
 };
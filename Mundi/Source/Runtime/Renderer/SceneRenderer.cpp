@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "SceneRenderer.h"
+#include "ParallelAlgorithms.h"
 
 // FSceneRenderer가 사용하는 모든 헤더 포함
 #include "World.h"
@@ -296,7 +297,7 @@ void FSceneRenderer::RenderShadowMaps()
 	if (!LightManager) return;
 
 	// 2. 그림자 캐스터(Caster) 메시 수집
-	TArray<FMeshBatchElement> ShadowMeshBatches;
+	TArray<FMeshBatchElement, FFrameArenaAllocator> ShadowMeshBatches;
 	for (UMeshComponent* MeshComponent : Proxies.Meshes)
 	{
 		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
@@ -504,7 +505,7 @@ void FSceneRenderer::RenderShadowMaps()
 	RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(OriginViewProjBuffer));
 }
 
-void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches)
+void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement, FFrameArenaAllocator>& InShadowBatches)
 {
 	// 1. 뎁스 전용 셰이더 로드
 	UShader* DepthVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/DepthOnly_VS.hlsl");
@@ -1022,7 +1023,7 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 	}
 
 	// --- 2. 정렬 (Sort) ---
-	MeshBatchElements.Sort();
+	ParallelSort(MeshBatchElements);
 
 	// --- 3. 그리기 (Draw) ---
 	{
@@ -1080,8 +1081,8 @@ void FSceneRenderer::RenderParticlePass()
 		ParticleComp->CollectMeshBatches(MeshBatchElements, View);
 	}
 
-	TArray<FMeshBatchElement> MeshParticleBatchElements;
-	TArray<FMeshBatchElement> SpriteParticleBatchElements;
+	TArray<FMeshBatchElement, FFrameArenaAllocator> MeshParticleBatchElements;
+	TArray<FMeshBatchElement, FFrameArenaAllocator> SpriteParticleBatchElements;
 
 	for (const FMeshBatchElement& Batch : MeshBatchElements)
 	{
@@ -1099,14 +1100,14 @@ void FSceneRenderer::RenderParticlePass()
 
 	FParticleStatManager::GetInstance().AddDrawCalls(SpriteParticleBatchElements.Num());
 	FParticleStatManager::GetInstance().AddDrawCalls(MeshParticleBatchElements.Num());
-	SpriteParticleBatchElements.Sort();
+	ParallelSort(SpriteParticleBatchElements);
 	if (!SpriteParticleBatchElements.IsEmpty())
 	{
 		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly);
 		DrawMeshBatches(SpriteParticleBatchElements, true);
 	}
 	
-	MeshParticleBatchElements.Sort();
+	ParallelSort(MeshParticleBatchElements);
 	if (!MeshParticleBatchElements.IsEmpty())
 	{
 		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
@@ -1173,7 +1174,7 @@ void FSceneRenderer::RenderDecalPass()
 
 		// 1. Decal의 World AABB와 충돌한 모든 StaticMeshComponent 쿼리
 		const FOBB DecalOBB = Decal->GetWorldOBB();
-		TArray<UPrimitiveComponent*> IntersectedStaticMeshComponents = BVH->QueryIntersectedComponents(DecalOBB);
+		FBVHierarchy::FComponentQueryResult IntersectedStaticMeshComponents = BVH->QueryIntersectedComponents(DecalOBB);
 
 		// 2. 충돌한 모든 visible Actor의 PrimitiveComponent를 TargetPrimitives에 추가
 		// Actor에 기본으로 붙어있는 TextRenderComponent, BoundingBoxComponent는 decal 적용 안되게 하기 위해,
@@ -1532,7 +1533,7 @@ void FSceneRenderer::RenderFinalOverlayLines()
 }
 
 // 수집한 Batch 그리기
-void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
+void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement, FFrameArenaAllocator>& InMeshBatches, bool bClearListAfterDraw)
 {
 	if (InMeshBatches.IsEmpty()) return;
 	constexpr UINT ParticleInstanceDataSlot = 14;
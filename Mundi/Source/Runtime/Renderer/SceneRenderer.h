@@ -93,7 +93,7 @@ private:
 	void RenderSceneDepthPath();
 	void RenderSkybox();
 	void RenderShadowMaps();
-	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches);
+	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement, FFrameArenaAllocator>& InShadowBatches);
 
 	/** @brief 렌더링에 필요한 포인터들이 유효한지 확인합니다. */
 	bool IsValid() const;
@@ -113,7 +113,7 @@ private:
 	/** @brief 불투명(Opaque) 객체들을 렌더링하는 패스입니다. */
 	void RenderOpaquePass(EViewMode InRenderViewMode);
 
-	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
+	void DrawMeshBatches(TArray<FMeshBatchElement, FFrameArenaAllocator>& InMeshBatches, bool bClearListAfterDraw);
 
 	void RenderParticlePass();
 	void RenderDecalPass();
@@ -155,7 +155,7 @@ private:
 	TArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
 
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
-	TArray<FMeshBatchElement> MeshBatchElements;
+	TArray<FMeshBatchElement, FFrameArenaAllocator> MeshBatchElements;
 
 	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
 	std::unique_ptr<FTileLightCuller> TileLightCuller;
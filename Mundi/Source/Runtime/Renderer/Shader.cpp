@@ -66,21 +66,20 @@ uint64 UShader::GenerateShaderKey(const TArray<FShaderMacro>& InMacros)
 	SortedNames = UniqueMacroMap.GetKeys();
 	SortedNames.Sort([](const FName& A, const FName& B)
 		{
-			return A.ComparisonIndex < B.ComparisonIndex;
+			return A.FastLess(B);
 		});
 
-	// 3. FName의 해시를 조합하여 최종 키 해시 생성
-	// (FName의 GetTypeHash()는 내부적으로 정수 인덱스를 사용하므로 매우 빠릅니다.)
-	uint64 KeyHash = 0;
+	// 3. (이름, 정의)의 FName 인덱스를 나란히 모아 한 번에 해시
+	// (GetTypeHash()는 정수 인덱스를 그대로 돌려주므로 HashCombine만으로는 충돌이 잦습니다.)
+	TArray<uint64> Words;
+	Words.reserve(SortedNames.Num() * 2);
 	for (const FName& Name : SortedNames)
 	{
-		const FName& Definition = UniqueMacroMap[Name];
-
-		KeyHash = HashCombine(KeyHash, GetTypeHash(Name));
-		KeyHash = HashCombine(KeyHash, GetTypeHash(Definition));
+		Words.Add(GetTypeHash(Name));
+		Words.Add(GetTypeHash(UniqueMacroMap[Name]));
 	}
 
-	return KeyHash;
+	return FastHash::HashBytes(Words.data(), Words.size() * sizeof(uint64));
 }
 
 FString UShader::GenerateMacrosToString(const TArray<FShaderMacro>& InMacros)
@@ -89,7 +88,7 @@ FString UShader::GenerateMacrosToString(const TArray<FShaderMacro>& InMacros)
 	TArray<FShaderMacro> SortedMacros = InMacros;
 	SortedMacros.Sort([](const FShaderMacro& A, const FShaderMacro& B)
 		{
-			return A.Name.ComparisonIndex < B.Name.ComparisonIndex;
+			return A.Name.FastLess(B.Name);
 		});
 
 	FString Key;
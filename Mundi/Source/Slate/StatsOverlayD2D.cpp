@@ -497,10 +497,10 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
+		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes.load()) / (1024.0 * 1024.0);
 
 		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, FMemoryManager::TotalAllocationCount);
+		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %llu", Mb, FMemoryManager::TotalAllocationCount.load());
 
 		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, Rc, BrushBlack, BrushLightGreen);
@@ -3,6 +3,7 @@
 #include "ObjectFactory.h"
 #include "GlobalConsole.h"
 #include "StatsOverlayD2D.h"
+#include "MemoryManager.h"
 #include "USlateManager.h"
 #include <windows.h>
 #include <cstdarg>
@@ -49,6 +50,10 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT");
 	HelpCommandList.Add("STAT FPS");
 	HelpCommandList.Add("STAT MEMORY");
+	HelpCommandList.Add("STAT MEMPOOL");
+	HelpCommandList.Add("STAT MEMTAG");
+	HelpCommandList.Add("STAT MEMTAG SNAPSHOT");
+	HelpCommandList.Add("STAT MEMTAG DIFF");
 	HelpCommandList.Add("STAT PICKING");
 	HelpCommandList.Add("STAT DECAL");
 	HelpCommandList.Add("STAT ALL");
@@ -540,6 +545,8 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("STAT commands:");
 		AddLog("- STAT FPS");
 		AddLog("- STAT MEMORY");
+		AddLog("- STAT MEMPOOL");
+		AddLog("- STAT MEMTAG [SNAPSHOT|DIFF]");
 		AddLog("- STAT PICKING");
 		AddLog("- STAT DECAL");
 		AddLog("- STAT ALL");
@@ -556,6 +563,26 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleMemory();
 		AddLog("STAT MEMORY TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT MEMPOOL") == 0)
+	{
+		FMemoryManager::DumpSizeClassReport();
+		UE_LOG("Frame arena: %u buffers, %.2f MB reserved", FFrameArena::GetBufferCount(), FFrameArena::GetReservedBytes() / (1024.0 * 1024.0));
+	}
+	else if (Stricmp(command_line, "STAT MEMTAG") == 0)
+	{
+		FMemoryManager::DumpTagReport();
+	}
+	else if (Stricmp(command_line, "STAT MEMTAG SNAPSHOT") == 0)
+	{
+		FMemoryManager::GetTagStats(MemoryTagSnapshot);
+		AddLog("Memory tag snapshot saved (%d tags)", MemoryTagSnapshot.Num());
+	}
+	else if (Stricmp(command_line, "STAT MEMTAG DIFF") == 0)
+	{
+		TArray<FMemoryTagStats> Current;
+		FMemoryManager::GetTagStats(Current);
+		FMemoryManager::DumpTagDiff(MemoryTagSnapshot, Current);
+	}
 	else if (Stricmp(command_line, "STAT PICKING") == 0)
 	{
 		UStatsOverlayD2D::Get().TogglePicking();
@@ -2,6 +2,7 @@
 #include <mutex>
 #include "Widget.h"
 #include "Vector.h"
+#include "MemoryManager.h"
 #include "ImGui/imgui.h"
 
 /**
@@ -37,6 +38,9 @@ private:
 	TArray<FString> History;
 	int32 HistoryPos;
 
+	// STAT MEMTAG SNAPSHOT 으로 저장한 태그 통계 (STAT MEMTAG DIFF 기준)
+	TArray<FMemoryTagStats> MemoryTagSnapshot;
+
 	// UI state
 	bool AutoScroll;
 	bool ScrollToBottom;
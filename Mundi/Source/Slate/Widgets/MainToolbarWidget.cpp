@@ -3,6 +3,7 @@
 #include "ImGui/imgui.h"
 #include "Level.h"
 #include "JsonSerializer.h"
+#include "CookedScene.h"
 #include "SelectionManager.h"
 #include "CameraActor.h"
 #include "EditorEngine.h"
@@ -599,6 +600,9 @@ void UMainToolbarWidget::OnSaveScene()
         {
             UE_LOG("MainToolbar: Scene saved: %s", SelectedPath.generic_u8string().c_str());
             EditorINI["LastUsedLevel"] = WideToUTF8(fs::relative(SelectedPath));
+#ifdef USE_COOKED_SCENE
+            FCookedScene::CookFile(SelectedPath);
+#endif
         }
         else
         {
@@ -637,10 +641,8 @@ void UMainToolbarWidget::OnLoadScene()
         GWorld->GetSelectionManager()->ClearSelection();
 
         std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-        JSON LevelJsonData;
-        if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, SelectedPath))
+        if (NewLevel->LoadFromFile(SelectedPath))
         {
-            NewLevel->Serialize(true, LevelJsonData);
             EditorINI["LastUsedLevel"] = WideToUTF8(fs::relative(SelectedPath));
         }
         else
@@ -12,6 +12,8 @@
 #include "CameraComponent.h"
 #include "CameraActor.h"
 #include "StatsOverlayD2D.h"
+#include "WorldPartitionManager.h"
+#include "BVHierarchy.h"
 
 #include "StaticMeshActor.h"
 //#include "SkeletalMeshActor.h"
@@ -1552,6 +1554,20 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			ImGui::SetTooltip("BVH(Bounding Volume Hierarchy) 디버그 시각화를 표시합니다.");
 		}
 
+		// BVH 빌드 방식 (월드별)
+		if (UWorldPartitionManager* Partition = ViewportClient->GetWorld()->GetPartitionManager())
+		{
+			bool bSAHBuild = Partition->GetBVHBuildMethod() == EBVHBuildMethod::BinnedSAH;
+			if (ImGui::Checkbox(" BVH SAH 빌드", &bSAHBuild))
+			{
+				Partition->SetBVHBuildMethod(bSAHBuild ? EBVHBuildMethod::BinnedSAH : EBVHBuildMethod::LBVH);
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("이 월드의 BVH를 Binned SAH로 빌드합니다. 빌드는 느리지만 뭉친 씬에서 피킹/AABB 쿼리가 빨라집니다.");
+			}
+		}
+
 		// Grid
 		bool bGrid = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Grid);
 		if (ImGui::Checkbox("##Grid", &bGrid))
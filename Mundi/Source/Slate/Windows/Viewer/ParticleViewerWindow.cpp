@@ -1067,6 +1067,9 @@ void SParticleViewerWindow::OnRender()
                         if (ImGui::IsItemHovered()) ImGui::SetTooltip("원기둥 높이\nZ축 방향 범위");
                         break;
                     }
+
+                    ImGui::Checkbox("Fast Math##Location", &LocationModule->bUseFastMath);
+                    if (ImGui::IsItemHovered()) ImGui::SetTooltip("Sphere/Cylinder의 sin/cos를 근사 함수로 계산\n오차 ~3e-7, 스폰이 많은 에미터에 사용");
                 }
                 else if (auto* VelocityModule = Cast<UParticleModuleVelocity>(SelectedModule))
                 {
@@ -1139,6 +1142,10 @@ void SParticleViewerWindow::OnRender()
                         ConeModule->Direction.Normalize();
                     }
                     if (ImGui::IsItemHovered()) ImGui::SetTooltip("방향 벡터를 단위 벡터로 정규화\n길이 1로 만들어 일관된 동작 보장");
+
+                    ImGui::Spacing();
+                    ImGui::Checkbox("Fast Math##Cone", &ConeModule->bUseFastMath);
+                    if (ImGui::IsItemHovered()) ImGui::SetTooltip("방향 샘플링의 sin/cos를 근사 함수로 계산\n오차 ~3e-7, 스폰이 많은 에미터에 사용");
                 }
                 else if (auto* ColorModule = Cast<UParticleModuleColor>(SelectedModule))
                 {
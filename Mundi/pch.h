@@ -4,6 +4,8 @@
 // Uncomment to enable DDS texture caching (faster loading, uses Data/TextureCache/)
 #define USE_DDS_CACHE
 #define USE_OBJ_CACHE
+// .scene을 쿠킹한 바이너리를 DDC("Scene" 버킷)에 만들고, 최신이면 JSON 대신 사용
+#define USE_COOKED_SCENE
 
 #define IMGUI_DEFINE_MATH_OPERATORS	// Imgui에서 곡선 표시를 위한 전용 벡터 연산자 활성화
 
@@ -52,10 +54,16 @@
 #include "ResourceData.h"
 #include "VertexData.h"
 #include "UEContainer.h"
+#include "FlatHashMap.h"
+#include "InlineArray.h"
+#include "LockFreeQueue.h"
+#include "FrameArena.h"
+#include "TaskSystem.h"
 #include "Name.h"
 #include "PathUtils.h"
 #include "Object.h"
 #include "ObjectFactory.h"
+#include "WeakObjectPtr.h"
 #include "ObjectMacros.h"
 #include "Enums.h"
 #include "GlobalConsole.h"